@@ -0,0 +1,96 @@
+// Host soak: 100Hz logic tick (LogicTick + PMIC cache) against its 10 ms deadline.
+// Simulates one hour of ticks with scripted button activity and a UI task draining the
+// event queue at the 16fps render rate; fails (exit 1) if p99.9 exceeds the deadline
+// or an event is dropped.
+// This measures only the logic's own CPU time and queue behaviour: there is no scheduler,
+// preemption, M5.update() or I2C contention here, so it does NOT verify the on-device
+// latency target. That needs LOOP_SOAK_BENCH (core2-lab env) on hardware, which measures
+// wake-up lateness with esp_timer_get_time().
+// Build/run: pio run -e native-soak -t exec
+#include "LogicTick.h"
+#include "TickLatencyHistogram.h"
+#include "BatteryTelemetry.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+namespace {
+
+constexpr uint32_t kSimulatedMs = 60u * 60u * 1000u;
+constexpr uint32_t kDeadlineUs = LogicTick::kPeriodMs * 1000u;
+constexpr uint32_t kRenderIntervalMs = 62; // UI drain interval (16fps grid, floor)
+
+// Deterministic pseudo-random press script (LCG)
+uint32_t g_seed = 12345u;
+uint32_t nextRandom() {
+    g_seed = g_seed * 1664525u + 1013904223u;
+    return g_seed >> 8;
+}
+
+} // namespace
+
+int main() {
+    ButtonEventQueue queue;
+    LogicTick logic(&queue);
+    BatteryTelemetry battery;
+    TickLatencyHistogram histogram(kDeadlineUs);
+
+    bool level[3] = { false, false, false };
+    uint32_t releaseAtMs[3] = { 0, 0, 0 };
+    uint32_t nextDrainMs = 0;
+    uint32_t events = 0;
+    uint32_t shortPresses = 0;
+    uint32_t longPresses = 0;
+
+    for (uint32_t nowMs = 0; nowMs < kSimulatedMs; nowMs += LogicTick::kPeriodMs) {
+        // Script: presses of 80-1200 ms (short and long) on random buttons
+        for (int i = 0; i < 3; ++i) {
+            if (level[i] && nowMs >= releaseAtMs[i]) level[i] = false;
+        }
+        if (nextRandom() % 200u == 0) {
+            const int btn = static_cast<int>(nextRandom() % 3u);
+            if (!level[btn]) {
+                level[btn] = true;
+                releaseAtMs[btn] = nowMs + 80u + nextRandom() % 1120u;
+            }
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        logic.tick(static_cast<int64_t>(nowMs) * 1000, level[0], level[1], level[2]); // monotonic µs
+        if (battery.isSampleDue(nowMs)) {
+            battery.addSample(nowMs, 80 - static_cast<int>(nowMs / 120000u), 3900, false);
+        }
+        const auto end = std::chrono::steady_clock::now();
+        histogram.record(static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count()));
+
+        if (nowMs >= nextDrainMs) {
+            ButtonEvents e;
+            while (queue.pop(e)) {
+                ++events;
+                for (int i = 0; i < 3; ++i) {
+                    if (e.shortPress & (1u << i)) ++shortPresses;
+                    if (e.longPress & (1u << i)) ++longPresses;
+                }
+            }
+            nextDrainMs = nowMs + kRenderIntervalMs;
+        }
+    }
+
+    const uint32_t p999 = histogram.percentileUs(999);
+    std::printf("[SOAK] logic tick, %u ticks (%u s simulated), %u event batches\n",
+                static_cast<unsigned>(histogram.count()), static_cast<unsigned>(kSimulatedMs / 1000u),
+                static_cast<unsigned>(events));
+    std::printf("  p50 / p99 / p99.9 : %u / %u / %u us (bin %u us)\n",
+                static_cast<unsigned>(histogram.percentileUs(500)), static_cast<unsigned>(histogram.percentileUs(990)),
+                static_cast<unsigned>(p999), static_cast<unsigned>(TickLatencyHistogram::kBinUs));
+    std::printf("  max               : %u us\n", static_cast<unsigned>(histogram.maxUs()));
+    std::printf("  deadline misses   : %u (deadline %u us)\n", static_cast<unsigned>(histogram.misses()),
+                static_cast<unsigned>(kDeadlineUs));
+    std::printf("  dropped events    : %u\n", static_cast<unsigned>(queue.dropped()));
+    std::printf("  short / long      : %u / %u\n", static_cast<unsigned>(shortPresses), static_cast<unsigned>(longPresses));
+    // The script produces both kinds; none means the tick was fed the wrong time unit
+    const bool pass = p999 <= kDeadlineUs && queue.dropped() == 0 && shortPresses > 0 && longPresses > 0;
+    std::printf("  result            : %s\n", pass ? "PASS" : "FAIL");
+    return pass ? 0 : 1;
+}
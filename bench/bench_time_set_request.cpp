@@ -0,0 +1,53 @@
+// Host benchmark: legacy per-key jsonExtract* vs single-pass parseTimeSetRequest.
+// Build/run: pio run -e native-bench -t exec
+#include "TimeSyncCore.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+namespace {
+
+constexpr int kIterations = 200000;
+const char kBody[] = "{\"epochMs\":1754892706965,\"tzOffsetMin\":540,\"token\":\"0123456789abcdef\"}";
+
+// Prevents the optimizer from discarding results
+volatile int64_t g_sink = 0;
+
+template <typename Fn>
+double nsPerOp(Fn fn) {
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kIterations; ++i) {
+        fn();
+    }
+    const auto end = std::chrono::steady_clock::now();
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    return static_cast<double>(ns) / kIterations;
+}
+
+} // namespace
+
+int main() {
+    const double legacy = nsPerOp([]() {
+        // Mirrors the former handler: String -> std::string, then one search per key
+        const std::string body(kBody);
+        int64_t epochMs = 0;
+        int tzOffsetMin = 0;
+        std::string token;
+        TimeSyncCore::jsonExtractInt64(body, "epochMs", epochMs);
+        TimeSyncCore::jsonExtractInt(body, "tzOffsetMin", tzOffsetMin);
+        TimeSyncCore::jsonExtractString(body, "token", token);
+        g_sink = g_sink + epochMs + tzOffsetMin + static_cast<int64_t>(token.size());
+    });
+    const double singlePass = nsPerOp([]() {
+        TimeSyncCore::TimeSetRequest req{};
+        TimeSyncCore::parseTimeSetRequest(kBody, sizeof(kBody) - 1, req);
+        g_sink = g_sink + req.epochMs + req.tzOffsetMin + static_cast<int64_t>(req.tokenLen);
+    });
+    std::printf("[BENCH] /time/set parse (%d iterations)\n", kIterations);
+    std::printf("  legacy jsonExtract*   : %8.1f ns/op\n", legacy);
+    std::printf("  parseTimeSetRequest   : %8.1f ns/op\n", singlePass);
+    std::printf("  speedup               : %8.2fx\n", singlePass > 0.0 ? legacy / singlePass : 0.0);
+    return 0;
+}
@@ -0,0 +1,21 @@
+// libFuzzer harness for TimeSyncCore::parseTimeSetRequest (POST /time/set body).
+// Build/run: pio run -e native-fuzz && .pio/build/native-fuzz/program -max_total_time=60
+#include "TimeSyncCore.h"
+
+#include <cstddef>
+#include <cstdint>
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+    const char* body = reinterpret_cast<const char*>(data);
+    TimeSyncCore::TimeSetRequest req{};
+    const TimeSyncCore::ParseResult result = TimeSyncCore::parseTimeSetRequest(body, size, req);
+    if (result == TimeSyncCore::ParseResult::Ok) {
+        // The token view must stay inside the input buffer and within the bound
+        if (req.token == nullptr || req.token < body || req.token + req.tokenLen > body + size ||
+            req.tokenLen > TimeSyncCore::kTimeSetTokenMaxLen) {
+            __builtin_trap();
+        }
+    }
+    (void)TimeSyncCore::parseResultCode(result);
+    return 0;
+}
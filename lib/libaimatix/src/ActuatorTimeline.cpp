@@ -0,0 +1,69 @@
+#include "ActuatorTimeline.h"
+
+bool ActuatorTimeline::BacklightTrack::onDeadline(uint32_t nowMs, uint32_t& nextMs) {
+    engine.update(nowMs, out);
+    if (!engine.isActive()) return false;
+    nextMs = engine.nextUpdateAtMs(nowMs);
+    return true;
+}
+
+bool ActuatorTimeline::HapticsTrack::onDeadline(uint32_t nowMs, uint32_t& nextMs) {
+    seq.update(nowMs, out);
+    if (!seq.isActive()) return false;
+    nextMs = seq.nextChangeAtMs(nowMs);
+    return true;
+}
+
+ActuatorTimeline::ActuatorTimeline(IBacklight* backlight, IVibrationOutput* vibration)
+    : backlightTrack_(), hapticsTrack_(), scheduler_(), backlightId_(TimelineScheduler::kNoTrack),
+      hapticsId_(TimelineScheduler::kNoTrack) {
+    backlightTrack_.out = backlight;
+    hapticsTrack_.out = vibration;
+    backlightId_ = scheduler_.addTrack(&backlightTrack_);
+    hapticsId_ = scheduler_.addTrack(&hapticsTrack_);
+}
+
+void ActuatorTimeline::playBacklight(const BacklightPattern& pattern, uint32_t nowMs) {
+    if (backlightTrack_.out == nullptr) return;
+    backlightTrack_.engine.play(pattern, nowMs);
+    if (backlightTrack_.engine.isActive()) {
+        scheduler_.schedule(backlightId_, nowMs); // first edge is due now
+    } else {
+        scheduler_.cancel(backlightId_);
+    }
+}
+
+void ActuatorTimeline::playHaptics(const HapticPattern& pattern, uint32_t nowMs) {
+    if (hapticsTrack_.out == nullptr) return;
+    hapticsTrack_.seq.loadPattern(pattern.segments, pattern.count, pattern.repeat);
+    hapticsTrack_.seq.start(nowMs);
+    if (hapticsTrack_.seq.isActive()) {
+        scheduler_.schedule(hapticsId_, nowMs);
+    } else {
+        scheduler_.cancel(hapticsId_);
+    }
+}
+
+void ActuatorTimeline::playAlert(const BacklightPattern& backlight, const HapticPattern& haptics, uint32_t nowMs) {
+    // 同一の時刻原点で開始（以後の辺はどちらもこの原点からの相対時刻）
+    playBacklight(backlight, nowMs);
+    playHaptics(haptics, nowMs);
+}
+
+void ActuatorTimeline::stopBacklight() {
+    backlightTrack_.engine.stop();
+    scheduler_.cancel(backlightId_);
+}
+
+void ActuatorTimeline::stopHaptics() {
+    if (hapticsTrack_.seq.isActive()) {
+        hapticsTrack_.seq.stop(hapticsTrack_.out);
+    }
+    scheduler_.cancel(hapticsId_);
+}
+
+void ActuatorTimeline::setBrightness(uint8_t brightness) {
+    if (backlightTrack_.out == nullptr) return;
+    backlightTrack_.out->setBrightness(brightness);
+    backlightTrack_.engine.noteBrightness(brightness);
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+#include "TimelineScheduler.h"
+#include "BacklightEngine.h"
+#include "VibrationSequencer.h"
+#include "IBacklight.h"
+#include "IVibration.h"
+
+/**
+ * All timed actuator output (backlight keyframes, vibration segments) on one
+ * TimelineScheduler. Pure logic: the owner calls runDue() when the earliest deadline
+ * (nextDeadline()) is reached, from a single timer on device.
+ * playAlert() starts both tracks on the same time origin, so patterns with equal
+ * periods stay phase-aligned (a pulse lands exactly on its flash).
+ */
+class ActuatorTimeline {
+public:
+    // Either output may be nullptr (e.g. no vibration motor on Fire)
+    ActuatorTimeline(IBacklight* backlight, IVibrationOutput* vibration);
+
+    void playBacklight(const BacklightPattern& pattern, uint32_t nowMs);
+    void playHaptics(const HapticPattern& pattern, uint32_t nowMs);
+    void playAlert(const BacklightPattern& backlight, const HapticPattern& haptics, uint32_t nowMs);
+    // Backlight keeps its level (caller restores); vibration is switched off
+    void stopBacklight();
+    void stopHaptics();
+    void stopAll() { stopBacklight(); stopHaptics(); }
+
+    // Direct write outside any pattern (settings/baseline restore)
+    void setBrightness(uint8_t brightness);
+    bool isBacklightActive() const { return backlightTrack_.engine.isActive(); }
+    bool isHapticsActive() const { return hapticsTrack_.seq.isActive(); }
+    uint8_t getLastBrightness() const { return backlightTrack_.engine.getLastBrightness(); }
+
+    size_t runDue(uint32_t nowMs) { return scheduler_.runDue(nowMs); }
+    bool nextDeadline(uint32_t& outMs) const { return scheduler_.nextDeadline(outMs); }
+
+private:
+    struct BacklightTrack : public ITimelineTrack {
+        bool onDeadline(uint32_t nowMs, uint32_t& nextMs) override;
+        BacklightEngine engine;
+        IBacklight* out = nullptr;
+    };
+    struct HapticsTrack : public ITimelineTrack {
+        bool onDeadline(uint32_t nowMs, uint32_t& nextMs) override;
+        VibrationSequencer seq;
+        IVibrationOutput* out = nullptr;
+    };
+
+    BacklightTrack backlightTrack_;
+    HapticsTrack hapticsTrack_;
+    TimelineScheduler scheduler_;
+    TimelineScheduler::TrackId backlightId_;
+    TimelineScheduler::TrackId hapticsId_;
+};
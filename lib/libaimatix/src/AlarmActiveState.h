@@ -2,62 +2,54 @@
 
 #include "StateManager.h"
 #include <cstdint>
-#include <vector>
-#include "BacklightSequencer.h"
+#include "AlertPatterns.h"
+#include "IBacklightAnimator.h"
 #include "IBacklight.h"
 #include "ISettingsLogic.h"
+#include "AlarmFireJitter.h"
 #include "ui_constants.h"
 
-// AlarmActiveState delegates visual alert to BacklightSequencer.
-// It enqueues a fixed non-repeating pattern on enter, restores the
+// AlarmActiveState delegates visual alert to an IBacklightAnimator.
+// It plays AlertPatterns::kAlarmFlash (+ phase-aligned kAlarmPulse haptics) on enter, restores the
 // pre-alarm brightness on finish or immediate stop, and returns to main state.
+// Entry is timestamped for AlarmFireJitter (scheduled deadline vs. actual entry) when set.
 class AlarmActiveState : public IState {
 public:
     AlarmActiveState(StateManager* manager,
                      IState* mainState,
-                     BacklightSequencer* backlightSeq,
+                     IBacklightAnimator* backlightAnim,
                      IBacklight* backlightOut,
                      ISettingsLogic* settings = nullptr)
         : manager_(manager),
           mainState_(mainState),
-          backlightSeq_(backlightSeq),
+          backlightAnim_(backlightAnim),
           backlightOut_(backlightOut),
           settings_(settings),
+          fireJitter_(nullptr),
           baselineBrightness_(DEFAULT_LCD_BRIGHTNESS),
           started_(false) {}
 
+    void setFireJitter(AlarmFireJitter* jitter) { fireJitter_ = jitter; }
+
     void onEnter() override {
+        if (fireJitter_) {
+            fireJitter_->onEntered();
+        }
         // Capture baseline brightness to restore later (settings -> seq -> default)
         if (settings_) {
             const int s = settings_->getLcdBrightness();
             if (s >= 0 && s <= 255) {
                 baselineBrightness_ = static_cast<uint8_t>(s);
             }
-        } else if (backlightSeq_) {
-            baselineBrightness_ = backlightSeq_->getLastBrightness();
+        } else if (backlightAnim_) {
+            baselineBrightness_ = backlightAnim_->getLastBrightness();
         } else {
             baselineBrightness_ = DEFAULT_LCD_BRIGHTNESS;
         }
 
-        // Build 1-second pattern @16fps:
-        // [255x2f, 0x2f] x3 + [0x4f] = 16 frames
-        if (backlightSeq_) {
-            backlightSeq_->clear();
-            for (int i = 0; i < 3; ++i) {
-                backlightSeq_->enqueueStep(255, 2);
-                backlightSeq_->enqueueStep(0, 2);
-            }
-            backlightSeq_->enqueueStep(0, 4);
-            // Repeat 4 times total (4 seconds) by enqueuing the 1s pattern 3 more times
-            for (int r = 0; r < 3; ++r) {
-                for (int i = 0; i < 3; ++i) {
-                    backlightSeq_->enqueueStep(255, 2);
-                    backlightSeq_->enqueueStep(0, 2);
-                }
-                backlightSeq_->enqueueStep(0, 4);
-            }
-            backlightSeq_->setRepeat(false);
-            backlightSeq_->start();
+        // 1s of [255 125ms, 0 125ms] x3 + 0 250ms, 4 loops (const table, no allocation)
+        if (backlightAnim_) {
+            backlightAnim_->playAlert(AlertPatterns::kAlarmFlash, AlertPatterns::kAlarmPulse);
             started_ = true;
         }
     }
@@ -69,8 +61,8 @@ public:
     }
 
     void onDraw() override {
-        // Auto-exit when sequence finished (tick is driven by main loop)
-        if (started_ && backlightSeq_ && !backlightSeq_->isActive()) {
+        // Auto-exit when the pattern finished (the animator runs on its own timer)
+        if (started_ && backlightAnim_ && !backlightAnim_->isActive()) {
             restoreBaseline_();
             if (manager_ && mainState_) { manager_->setState(mainState_); }
             started_ = false;
@@ -86,8 +78,8 @@ public:
 
 private:
     void restoreBaseline_() {
-        if (backlightSeq_) {
-            backlightSeq_->stop(backlightOut_);
+        if (backlightAnim_) {
+            backlightAnim_->stop();
         }
         if (backlightOut_) {
             backlightOut_->setBrightness(baselineBrightness_);
@@ -102,9 +94,10 @@ private:
 
     StateManager* manager_;
     IState* mainState_;
-    BacklightSequencer* backlightSeq_;
+    IBacklightAnimator* backlightAnim_;
     IBacklight* backlightOut_;
     ISettingsLogic* settings_;
+    AlarmFireJitter* fireJitter_;
     uint8_t baselineBrightness_;
     bool started_;
 };
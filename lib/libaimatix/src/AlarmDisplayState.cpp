@@ -6,7 +6,7 @@
 #include <vector>
 
 // 外部変数（既存のアラームリスト）
-extern std::vector<time_t> alarm_times;
+extern AlarmStore alarm_times;
 
 void AlarmDisplayState::onEnter() {
     if (view == nullptr) {
@@ -14,21 +14,31 @@ void AlarmDisplayState::onEnter() {
     }
     
     view->clear();
-    view->showTitle("ALARMS", BATTERY_WARNING_THRESHOLD, false);
+    drawTitle();
     view->showHints("UP", "DOWN", "DEL");
+    differ.invalidate();
+    frame = captureFrame();
     forceDraw();
 }
 
 void AlarmDisplayState::onExit() {
-    // 状態をクリアして次回のonEnter時に強制更新を有効にする
-    lastDisplayedAlarms.clear();
-    lastSelectedIndex = 0;
+    // 次回の onEnter で全フィールドを描き直す
+    differ.invalidate();
 }
 
 void AlarmDisplayState::onDraw() {
+    onDraw(captureFrame());
+}
+
+void AlarmDisplayState::onDraw(const FrameContext& current) {
+    frame = current;
     if (view == nullptr) {
         return;
     }
+    // 電池表示は表示値が変わったときだけ再描画
+    if (battery.changed()) {
+        drawTitle();
+    }
     
     // ハイブリッドアプローチ: リアルタイム更新とユーザー操作の両立
     if (shouldUpdateRealTime()) {
@@ -42,38 +52,21 @@ void AlarmDisplayState::forceDraw() {
     }
     
     // リアルタイム削除: 過去のアラームを削除
-    time_t now = 0;
     if (timeService != nullptr) {
-        now = timeService->now();
-        AlarmLogic::removePastAlarms(alarm_times, now);
+        AlarmLogic::removePastAlarms(alarm_times, frame.now);
     }
     
     // アラームリストを取得（毎回最新の状態を取得）
-    const std::vector<time_t> alarms = getAlarmList();
+    const std::vector<time_t>& alarms = getAlarmList();
     
     // 選択位置の調整（アラーム消化後も適切に調整）
     adjustSelectionIndex();
     
-    // ちらつき防止：変更があった場合のみ更新
-    bool needsUpdate = false;
-    
-    // 初期表示時は強制的に更新
-    if (lastDisplayedAlarms.empty()) {
-        needsUpdate = true;
-    } else {
-        // アラームリストの変更をチェック
-        if (alarms != lastDisplayedAlarms) {
-            needsUpdate = true;
-        }
-        
-        // 選択位置の変更をチェック
-        if (selectedIndex != lastSelectedIndex) {
-            needsUpdate = true;
-        }
-    }
-    
-    // 変更がない場合は何もしない（ちらつき防止）
-    if (!needsUpdate) {
+    // ちらつき防止：一覧（世代番号）か選択位置が変わった場合のみ更新
+    AlarmListViewModel model;
+    model.alarms = alarm_times.generation();
+    model.selected = static_cast<uint32_t>(selectedIndex);
+    if (differ.diff(model) == 0) {
         return;
     }
     
@@ -85,13 +78,14 @@ void AlarmDisplayState::forceDraw() {
         // アラームリスト表示
         view->showAlarmList(alarms, selectedIndex);
     }
-    
-    // 現在の状態を記憶
-    lastDisplayedAlarms = alarms;
-    lastSelectedIndex = selectedIndex;
 }
 
 void AlarmDisplayState::onButtonA() {
+    onButtonA(captureFrame());
+}
+
+void AlarmDisplayState::onButtonA(const FrameContext& current) {
+    frame = current;
     updateLastUserAction();
     moveUp();
     // 選択位置変更後に画面を再描画
@@ -99,6 +93,11 @@ void AlarmDisplayState::onButtonA() {
 }
 
 void AlarmDisplayState::onButtonB() {
+    onButtonB(captureFrame());
+}
+
+void AlarmDisplayState::onButtonB(const FrameContext& current) {
+    frame = current;
     updateLastUserAction();
     moveDown();
     // 選択位置変更後に画面を再描画
@@ -106,11 +105,21 @@ void AlarmDisplayState::onButtonB() {
 }
 
 void AlarmDisplayState::onButtonC() {
+    onButtonC(captureFrame());
+}
+
+void AlarmDisplayState::onButtonC(const FrameContext& current) {
+    frame = current;
     updateLastUserAction();
     deleteSelectedAlarm();
 }
 
 void AlarmDisplayState::onButtonALongPress() {
+    onButtonALongPress(captureFrame());
+}
+
+void AlarmDisplayState::onButtonALongPress(const FrameContext& current) {
+    frame = current;
     updateLastUserAction();
     moveToTop();
     // 選択位置変更後に画面を再描画
@@ -118,6 +127,11 @@ void AlarmDisplayState::onButtonALongPress() {
 }
 
 void AlarmDisplayState::onButtonBLongPress() {
+    onButtonBLongPress(captureFrame());
+}
+
+void AlarmDisplayState::onButtonBLongPress(const FrameContext& current) {
+    frame = current;
     updateLastUserAction();
     moveToBottom();
     // 選択位置変更後に画面を再描画
@@ -125,6 +139,11 @@ void AlarmDisplayState::onButtonBLongPress() {
 }
 
 void AlarmDisplayState::onButtonCLongPress() {
+    onButtonCLongPress(captureFrame());
+}
+
+void AlarmDisplayState::onButtonCLongPress(const FrameContext& current) {
+    frame = current;
     updateLastUserAction();
     // メイン画面に戻る
     if (manager != nullptr && mainDisplayState != nullptr) {
@@ -132,13 +151,13 @@ void AlarmDisplayState::onButtonCLongPress() {
     }
 }
 
-auto AlarmDisplayState::getAlarmList() const -> std::vector<time_t> {
-    // 外部変数からアラームリストを取得
-    return AlarmLogic::getAlarms(alarm_times);
+auto AlarmDisplayState::getAlarmList() -> const std::vector<time_t>& {
+    // 外部変数のアラームリストをそのまま参照（AlarmStore は常に時刻順）
+    return alarm_times.times();
 }
 
 auto AlarmDisplayState::adjustSelectionIndex() -> void {
-    const std::vector<time_t> alarms = getAlarmList();
+    const std::vector<time_t>& alarms = getAlarmList();
     if (alarms.empty()) {
         selectedIndex = 0;
         return;
@@ -152,7 +171,7 @@ auto AlarmDisplayState::adjustSelectionIndex() -> void {
 
 auto AlarmDisplayState::deleteSelectedAlarm() -> void {
     // 画面上で選択されている時刻を取得
-    const std::vector<time_t> displayedAlarms = getAlarmList();
+    const std::vector<time_t>& displayedAlarms = getAlarmList();
     if (selectedIndex >= displayedAlarms.size()) {
         return; // 選択位置が無効
     }
@@ -160,9 +179,7 @@ auto AlarmDisplayState::deleteSelectedAlarm() -> void {
     const time_t selectedTime = displayedAlarms[selectedIndex];
     
     // 実体リストから一致するものを削除（valueベース削除）
-    const auto iterator = std::find(alarm_times.begin(), alarm_times.end(), selectedTime);
-    if (iterator != alarm_times.end()) {
-        alarm_times.erase(iterator);
+    if (alarm_times.erase(selectedTime)) {
         // 削除成功 - 即座に画面を再描画
         forceDraw();
     }
@@ -177,7 +194,7 @@ auto AlarmDisplayState::moveUp() -> void {
 }
 
 auto AlarmDisplayState::moveDown() -> void {
-    const std::vector<time_t> alarms = getAlarmList();
+    const std::vector<time_t>& alarms = getAlarmList();
     if (selectedIndex < alarms.size() - 1) {
         selectedIndex++;
     }
@@ -189,7 +206,7 @@ auto AlarmDisplayState::moveToTop() -> void {
 }
 
 auto AlarmDisplayState::moveToBottom() -> void {
-    const std::vector<time_t> alarms = getAlarmList();
+    const std::vector<time_t>& alarms = getAlarmList();
     if (!alarms.empty()) {
         selectedIndex = alarms.size() - 1;
     }
@@ -197,17 +214,19 @@ auto AlarmDisplayState::moveToBottom() -> void {
 
 auto AlarmDisplayState::shouldUpdateRealTime() const -> bool {
     // ユーザー操作から一定時間経過していればリアルタイム更新
-    return (getCurrentMillis(timeService) - lastUserAction) > UPDATE_PAUSE_DURATION;
+    return (frame.monoUs - lastUserActionUs) > UPDATE_PAUSE_DURATION_US;
 }
 
 auto AlarmDisplayState::updateLastUserAction() -> void {
-    lastUserAction = getCurrentMillis(timeService);
+    lastUserActionUs = frame.monoUs;
 }
 
-// 静的メソッドとして定義
-unsigned long AlarmDisplayState::getCurrentMillis(const std::shared_ptr<ITimeService>& timeService) {
-    if (timeService) {
-        return timeService->monotonicMillis();
-    }
-    return 0;
-} 
\ No newline at end of file
+FrameContext AlarmDisplayState::captureFrame() const {
+    // 時刻サービスが無いとき（テスト等）は時刻 0・単調時計 0（消化しない）
+    return timeService ? FrameContext::capture(timeService.get()) : FrameContext::at(0);
+}
+
+void AlarmDisplayState::drawTitle() {
+    const BatteryStatus bat = battery.take();
+    view->showTitle("ALARMS", bat.percent, bat.charging);
+}
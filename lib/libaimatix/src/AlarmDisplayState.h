@@ -3,19 +3,31 @@
 #include "AlarmLogic.h"
 #include "IAlarmDisplayView.h"
 #include "ITimeService.h"
+#include "IPowerTelemetry.h"
+#include "ViewModelDiffer.h"
 #include <vector>
 #include <string>
 #include <ctime>
 #include <memory>
 
+// アラーム管理画面の表示内容（POD）。一覧は AlarmStore の世代番号（ベクタのコピーは持たない）
+struct AlarmListViewModel {
+    enum Field : uint8_t { List, Selection, kFieldCount };
+    uint32_t alarms;
+    uint32_t selected;
+
+    uint32_t fingerprint(size_t field) const { return field == List ? alarms : selected; }
+};
+
 class AlarmDisplayState : public IState {
 public:
     AlarmDisplayState(StateManager* mgr, IAlarmDisplayView* view = nullptr, 
                      std::shared_ptr<ITimeService> timeService = nullptr)
         : manager(mgr), view(view), timeService(timeService), selectedIndex(0), mainDisplayState(nullptr), 
-          lastUserAction(0), lastSelectedIndex(0) {}
+          lastUserActionUs(0), frame(FrameContext::at(0)) {}
     
     void setMainDisplayState(IState* mainState) { mainDisplayState = mainState; }
+    void setPowerTelemetry(const IPowerTelemetry* telemetry) { battery.setSource(telemetry); }
     
     void onEnter() override;
     void onExit() override;
@@ -26,6 +38,14 @@ public:
     void onButtonALongPress() override;
     void onButtonBLongPress() override;
     void onButtonCLongPress() override;
+    // フレーム時刻付き（消化/一時停止の判定はこのフレームの時刻で行う）
+    void onDraw(const FrameContext& frame) override;
+    void onButtonA(const FrameContext& frame) override;
+    void onButtonB(const FrameContext& frame) override;
+    void onButtonC(const FrameContext& frame) override;
+    void onButtonALongPress(const FrameContext& frame) override;
+    void onButtonBLongPress(const FrameContext& frame) override;
+    void onButtonCLongPress(const FrameContext& frame) override;
     
     void setView(IAlarmDisplayView* v) { view = v; }
     void setTimeService(std::shared_ptr<ITimeService> s) { timeService = s; }
@@ -40,17 +60,18 @@ private:
     std::shared_ptr<ITimeService> timeService;
     IState* mainDisplayState;
     size_t selectedIndex;
-    unsigned long lastUserAction;
+    int64_t lastUserActionUs; // 単調時計（64bit µs: 折り返しなし）
+    FrameContext frame;       // 処理中のフレームの時刻（入口ごとに差し替え）
     
-    // ちらつき防止用：前回の表示状態を記憶
-    std::vector<time_t> lastDisplayedAlarms;
-    size_t lastSelectedIndex;
+    // ちらつき防止: ビューへ渡した一覧/選択位置との差分
+    ViewModelDiffer<AlarmListViewModel> differ;
+    TitleBatteryIndicator battery;
     
     // ハイブリッドアプローチ用の定数
-    static constexpr unsigned long UPDATE_PAUSE_DURATION = 3000; // 3秒
+    static constexpr int64_t UPDATE_PAUSE_DURATION_US = 3000000; // 3秒
     
-    // アラームリストを取得（外部変数から）
-    std::vector<time_t> getAlarmList() const;
+    // アラームリストを取得（外部変数の AlarmStore をコピーせずに参照）
+    const std::vector<time_t>& getAlarmList();
     
     // 選択位置の調整
     void adjustSelectionIndex();
@@ -68,9 +89,10 @@ private:
     bool shouldUpdateRealTime() const;
     void updateLastUserAction();
     
-    // 静的メソッド
-    static unsigned long getCurrentMillis(const std::shared_ptr<ITimeService>& timeService);
+    // フレーム時刻を持たない入口（onEnter/従来の入口）用: その場で時刻を取る
+    FrameContext captureFrame() const;
     
     // 強制描画（初期表示とリアルタイム更新用）
     void forceDraw();
+    void drawTitle();
 }; 
\ No newline at end of file
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "AlarmStore.h"
+#include "ITimeService.h"
+#include "TickLatencyHistogram.h"
+
+// Alarm firing accuracy: for each alarm, the scheduled deadline (AlarmStore, monotonic us)
+// versus the actual entry into AlarmActiveState, aggregated into a latency histogram.
+// AlarmActiveState calls onEntered(); the loop takes the last sample for the log.
+// Only an entry in the same frame as the batch removal counts: alarms that elapsed while another
+// screen was shown (removed there without ringing) or entries without a time source are ignored.
+class AlarmFireJitter {
+public:
+	// Lateness above this counts as a miss (a precise wakeup should stay well inside one frame)
+	static constexpr uint32_t kLateBudgetUs = 10000;
+	// Removal and entry further apart than this are not the same frame
+	static constexpr int64_t kSameFrameUs = 50000;
+
+	struct Sample {
+		int64_t scheduledUs; // earliest deadline of the batch
+		int64_t enteredUs;
+		uint32_t lateUs;     // enteredUs - scheduledUs
+		uint8_t alarms;      // alarms fired by the batch (recorded ones)
+	};
+
+	AlarmFireJitter(const AlarmStore* store, const ITimeService* clock)
+		: store_(store), clock_(clock), histogram_(kLateBudgetUs), seenBatches_(store ? store->firedBatches() : 0),
+		sample_(), hasSample_(false) {}
+
+	void onEntered() {
+		if (store_ == nullptr || clock_ == nullptr) return;
+		const uint32_t batches = store_->firedBatches();
+		if (batches == seenBatches_ || store_->firedCount() == 0) return;
+		seenBatches_ = batches;
+		const int64_t enteredUs = clock_->monotonicMicros();
+		if (enteredUs - store_->firedAtUs() > kSameFrameUs) return;
+		for (size_t i = 0; i < store_->firedCount(); ++i) histogram_.record(lateness(enteredUs, store_->firedDeadlineUs(i)));
+		sample_.scheduledUs = store_->firedDeadlineUs(0);
+		sample_.enteredUs = enteredUs;
+		sample_.lateUs = lateness(enteredUs, sample_.scheduledUs);
+		sample_.alarms = static_cast<uint8_t>(store_->firedCount());
+		hasSample_ = true;
+	}
+
+	// Latest sample not yet taken (one per AlarmActiveState entry)
+	bool takeSample(Sample& out) {
+		if (!hasSample_) return false;
+		out = sample_;
+		hasSample_ = false;
+		return true;
+	}
+
+	const TickLatencyHistogram& histogram() const { return histogram_; }
+
+private:
+	// Clamped to the histogram range (an entry is never before the deadline it fired on)
+	static uint32_t lateness(int64_t enteredUs, int64_t scheduledUs) {
+		const int64_t late = enteredUs - scheduledUs;
+		if (late <= 0) return 0;
+		return late > static_cast<int64_t>(UINT32_MAX) ? UINT32_MAX : static_cast<uint32_t>(late);
+	}
+
+	const AlarmStore* store_;
+	const ITimeService* clock_;
+	TickLatencyHistogram histogram_;
+	uint32_t seenBatches_;
+	Sample sample_;
+	bool hasSample_;
+};
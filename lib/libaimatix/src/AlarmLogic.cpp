@@ -1,8 +1,6 @@
 #include "AlarmLogic.h"
 #include "PartialInputLogic.h"
 #include <algorithm>
-#include <sstream>
-#include <iomanip>
 #include <cstdio> // For printf
 #include "TimeThreadSafe.h"
 
@@ -53,19 +51,137 @@ int AlarmLogic::getRemainPercent(int remainSec, int totalSec) {
     return percent;
 }
 
-void AlarmLogic::getAlarmTimeStrings(const std::vector<time_t>& alarms, std::vector<std::string>& out) {
+namespace {
+// "HH:MM" を out に追加（std::string / FrameString 共通）
+template <class List>
+void appendAlarmTimeStrings(const std::vector<time_t>& alarms, List& out) {
     out.clear();
     for (const time_t& t : alarms) {
         std::tm tm_alarm{};
         if (!TimeThreadSafe::toLocalTime(t, tm_alarm)) {
             continue;
         }
-        std::ostringstream oss;
-        oss << std::setfill('0') << std::setw(2) << tm_alarm.tm_hour << ":"
-            << std::setw(2) << tm_alarm.tm_min;
-        out.push_back(oss.str());
+        char buf[8];
+        snprintf(buf, sizeof(buf), "%02d:%02d", tm_alarm.tm_hour, tm_alarm.tm_min);
+        out.emplace_back(buf);
     }
-} 
+}
+
+// 追加できるか（最大数/重複）。vector 版と AlarmStore 版で共通
+bool canAddAlarm(const std::vector<time_t>& alarms, time_t alarmTime, AlarmLogic::AddAlarmResult& result, std::string& errorMsg) {
+    // 最大数チェック
+    constexpr size_t MAX_ALARMS = 5;
+    if (alarms.size() >= MAX_ALARMS) {
+        result = AlarmLogic::AddAlarmResult::ErrorMaxReached;
+        errorMsg = "Max alarms reached (5)";
+        return false;
+    }
+    
+    // 重複チェック
+    for (const time_t& existing : alarms) {
+        if (existing == alarmTime) {
+            result = AlarmLogic::AddAlarmResult::ErrorDuplicate;
+            errorMsg = "Duplicate alarm time";
+            return false;
+        }
+    }
+    return true;
+}
+
+// 部分的な入力状態（digits[4], entered[4]）から次に来るその時刻を求める
+bool partialInputToAlarmTime(
+    time_t now,
+    const int* digits,
+    const bool* entered,
+    time_t& alarmTime,
+    AlarmLogic::AddAlarmResult& result,
+    std::string& errorMsg
+) {
+    // 入力チェック
+    if (digits == nullptr || entered == nullptr) {
+        result = AlarmLogic::AddAlarmResult::ErrorInvalid;
+        errorMsg = "Invalid input data";
+        return false;
+    }
+    
+    // 部分的な入力状態を完全な時分に変換（PartialInputLogicを使用）
+    const PartialInputLogic::ParsedTime parsedTime = PartialInputLogic::parsePartialInput(digits, entered);
+    if (!parsedTime.isValid) {
+        result = AlarmLogic::AddAlarmResult::ErrorInvalid;
+        errorMsg = "Invalid time format";
+        return false;
+    }
+    
+    int hour = parsedTime.hour;
+    int minute = parsedTime.minute;
+    
+    // 時分を直接指定してアラーム追加
+    struct tm now_tm_buf{};
+    if (!TimeThreadSafe::toLocalTime(now, now_tm_buf)) {
+        result = AlarmLogic::AddAlarmResult::ErrorInvalid;
+        errorMsg = "Invalid current time";
+        return false;
+    }
+    
+    struct tm alarm_tm = now_tm_buf;
+    alarm_tm.tm_sec = 0;
+    alarm_tm.tm_isdst = -1;
+    
+    // 時が指定されていない場合の処理
+    if (!parsedTime.hourSpecified) {
+        // 分のみで過去か未来かを判定
+        if (minute <= now_tm_buf.tm_min) {
+            // 分が現在分以下なら、次の時間の同じ分として設定
+            hour = (now_tm_buf.tm_hour + 1) % HOURS_24;
+        } else {
+            // 分が現在分より大きいなら、現在時間の同じ分として設定
+            hour = now_tm_buf.tm_hour;
+        }
+    } else {
+        // 時が指定されている場合：通常の処理
+        // 分繰り上げ
+        if (minute >= MINUTES_60) { 
+            hour += minute / MINUTES_60; 
+            minute = minute % MINUTES_60; 
+        }
+        // 時繰り上げ
+        const int add_day = hour / HOURS_24;
+        hour = hour % HOURS_24;
+        alarm_tm.tm_mday += add_day;
+        
+        // 時刻をセット
+        alarm_tm.tm_hour = hour;
+        alarm_tm.tm_min = minute;
+        
+        const time_t candidate = mktime(&alarm_tm);
+        
+        // 現在時刻も秒を0にして比較（秒の差で誤判定されるのを防ぐ）
+        struct tm now_tm_compare = now_tm_buf;
+        now_tm_compare.tm_sec = 0;
+        const time_t now_compare = mktime(&now_tm_compare);
+        
+        if (candidate <= now_compare) {
+            // 過去時刻の場合：翌日の同じ時刻として処理
+            alarm_tm.tm_mday += 1;
+        }
+    }
+    
+    alarm_tm.tm_hour = hour;
+    alarm_tm.tm_min = minute;
+    
+    alarmTime = mktime(&alarm_tm);
+    return true;
+}
+} // namespace
+
+void AlarmLogic::getAlarmTimeStrings(const std::vector<time_t>& alarms, std::vector<std::string>& out) {
+    appendAlarmTimeStrings(alarms, out);
+}
+
+void AlarmLogic::getAlarmTimeStrings(const std::vector<time_t>& alarms, FrameStringList& out) {
+    appendAlarmTimeStrings(alarms, out);
+}
+
 
 // addAlarm: 入力値をアラームとして追加。エラー時はresult, errorMsgに理由を格納。
 bool AlarmLogic::addAlarm(std::vector<time_t>& alarms, time_t now, time_t input, AddAlarmResult& result, std::string& errorMsg) {
@@ -141,23 +257,10 @@ bool AlarmLogic::addAlarm(std::vector<time_t>& alarms, time_t now, time_t input,
     
     const time_t alarmTime = mktime(&alarm_tm);
     
-    // 最大数チェック
-    constexpr int MAX_ALARMS = 5;
-    if (alarms.size() >= MAX_ALARMS) {
-        result = AddAlarmResult::ErrorMaxReached;
-        errorMsg = "Max alarms reached (5)";
+    if (!canAddAlarm(alarms, alarmTime, result, errorMsg)) {
         return false;
     }
     
-    // 重複チェック
-    for (const time_t& existing : alarms) {
-        if (existing == alarmTime) {
-            result = AddAlarmResult::ErrorDuplicate;
-            errorMsg = "Duplicate alarm time";
-            return false;
-        }
-    }
-    
     alarms.push_back(alarmTime);
     std::sort(alarms.begin(), alarms.end());
     result = AddAlarmResult::Success;
@@ -166,23 +269,10 @@ bool AlarmLogic::addAlarm(std::vector<time_t>& alarms, time_t now, time_t input,
 
 // 絶対時刻（time_t）をアラームとして追加。エラー時はresult, errorMsgに理由を格納。
 bool AlarmLogic::addAlarmAtTime(std::vector<time_t>& alarms, time_t alarmTime, AddAlarmResult& result, std::string& errorMsg) {
-    // 最大数チェック
-    constexpr int MAX_ALARMS = 5;
-    if (alarms.size() >= MAX_ALARMS) {
-        result = AddAlarmResult::ErrorMaxReached;
-        errorMsg = "Max alarms reached (5)";
+    if (!canAddAlarm(alarms, alarmTime, result, errorMsg)) {
         return false;
     }
     
-    // 重複チェック
-    for (const time_t& existing : alarms) {
-        if (existing == alarmTime) {
-            result = AddAlarmResult::ErrorDuplicate;
-            errorMsg = "Duplicate alarm time";
-            return false;
-        }
-    }
-    
     alarms.push_back(alarmTime);
     std::sort(alarms.begin(), alarms.end());
     result = AddAlarmResult::Success;
@@ -198,97 +288,15 @@ bool AlarmLogic::addAlarmFromPartialInput(
     AddAlarmResult& result, 
     std::string& errorMsg
 ) {
-    // 入力チェック
-    if (digits == nullptr || entered == nullptr) {
-        result = AddAlarmResult::ErrorInvalid;
-        errorMsg = "Invalid input data";
-        return false;
-    }
-    
-    // 部分的な入力状態を完全な時分に変換（PartialInputLogicを使用）
-    const PartialInputLogic::ParsedTime parsedTime = PartialInputLogic::parsePartialInput(digits, entered);
-    if (!parsedTime.isValid) {
-        result = AddAlarmResult::ErrorInvalid;
-        errorMsg = "Invalid time format";
+    time_t alarmTime = 0;
+    if (!partialInputToAlarmTime(now, digits, entered, alarmTime, result, errorMsg)) {
         return false;
     }
     
-    int hour = parsedTime.hour;
-    int minute = parsedTime.minute;
-    
-    // 時分を直接指定してアラーム追加
-    struct tm now_tm_buf{};
-    if (!TimeThreadSafe::toLocalTime(now, now_tm_buf)) {
-        result = AddAlarmResult::ErrorInvalid;
-        errorMsg = "Invalid current time";
-        return false;
-    }
-    
-    struct tm alarm_tm = now_tm_buf;
-    alarm_tm.tm_sec = 0;
-    alarm_tm.tm_isdst = -1;
-    
-    // 時が指定されていない場合の処理
-    if (!parsedTime.hourSpecified) {
-        // 分のみで過去か未来かを判定
-        if (minute <= now_tm_buf.tm_min) {
-            // 分が現在分以下なら、次の時間の同じ分として設定
-            hour = (now_tm_buf.tm_hour + 1) % HOURS_24;
-        } else {
-            // 分が現在分より大きいなら、現在時間の同じ分として設定
-            hour = now_tm_buf.tm_hour;
-        }
-    } else {
-        // 時が指定されている場合：通常の処理
-        // 分繰り上げ
-        if (minute >= MINUTES_60) { 
-            hour += minute / MINUTES_60; 
-            minute = minute % MINUTES_60; 
-        }
-        // 時繰り上げ
-        const int add_day = hour / HOURS_24;
-        hour = hour % HOURS_24;
-        alarm_tm.tm_mday += add_day;
-        
-        // 時刻をセット
-        alarm_tm.tm_hour = hour;
-        alarm_tm.tm_min = minute;
-        
-        const time_t candidate = mktime(&alarm_tm);
-        
-        // 現在時刻も秒を0にして比較（秒の差で誤判定されるのを防ぐ）
-        struct tm now_tm_compare = now_tm_buf;
-        now_tm_compare.tm_sec = 0;
-        const time_t now_compare = mktime(&now_tm_compare);
-        
-        if (candidate <= now_compare) {
-            // 過去時刻の場合：翌日の同じ時刻として処理
-            alarm_tm.tm_mday += 1;
-        }
-    }
-    
-    alarm_tm.tm_hour = hour;
-    alarm_tm.tm_min = minute;
-    
-    const time_t alarmTime = mktime(&alarm_tm);
-    
-    // 最大数チェック
-    constexpr int MAX_ALARMS_PARTIAL = 5;
-    if (alarms.size() >= MAX_ALARMS_PARTIAL) {
-        result = AddAlarmResult::ErrorMaxReached;
-        errorMsg = "Max alarms reached (5)";
+    if (!canAddAlarm(alarms, alarmTime, result, errorMsg)) {
         return false;
     }
     
-    // 重複チェック
-    for (const time_t& existing : alarms) {
-        if (existing == alarmTime) {
-            result = AddAlarmResult::ErrorDuplicate;
-            errorMsg = "Duplicate alarm time";
-            return false;
-        }
-    }
-    
     // アラーム追加
     alarms.push_back(alarmTime);
     std::sort(alarms.begin(), alarms.end());
@@ -316,4 +324,42 @@ std::vector<time_t> AlarmLogic::getAlarms(const std::vector<time_t>& alarms) {
     std::vector<time_t> sortedAlarms{alarms};
     std::sort(sortedAlarms.begin(), sortedAlarms.end());
     return sortedAlarms;
-} 
\ No newline at end of file
+} 
+// --- AlarmStore 版 ---
+// 起動時の既定アラーム（+10秒など）は経過時間で鳴る相対アラーム
+void AlarmLogic::initAlarms(AlarmStore& alarms, time_t now) {
+    alarms.clear();
+    alarms.insert(now + SECONDS_10, AlarmKind::Relative);
+    alarms.insert(now + SECONDS_30, AlarmKind::Relative);
+    alarms.insert(now + SECONDS_60, AlarmKind::Relative);
+    alarms.insert(now + SECONDS_120, AlarmKind::Relative);
+}
+
+// 消化するものがないフレームでは世代番号を進めない（判定は AlarmStore の単調時計上の締め切り）
+size_t AlarmLogic::removePastAlarms(AlarmStore& alarms, time_t now) {
+    return alarms.removeDue(now);
+}
+
+bool AlarmLogic::addAlarmAtTime(AlarmStore& alarms, time_t alarmTime, AlarmKind kind, AddAlarmResult& result, std::string& errorMsg) {
+    if (!canAddAlarm(alarms.times(), alarmTime, result, errorMsg)) {
+        return false;
+    }
+    alarms.insert(alarmTime, kind);
+    result = AddAlarmResult::Success;
+    return true;
+}
+
+bool AlarmLogic::addAlarmFromPartialInput(
+    AlarmStore& alarms,
+    time_t now,
+    const int* digits,
+    const bool* entered,
+    AddAlarmResult& result,
+    std::string& errorMsg
+) {
+    time_t alarmTime = 0;
+    if (!partialInputToAlarmTime(now, digits, entered, alarmTime, result, errorMsg)) {
+        return false;
+    }
+    return addAlarmAtTime(alarms, alarmTime, AlarmKind::Absolute, result, errorMsg);
+}
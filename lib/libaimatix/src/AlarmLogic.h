@@ -2,6 +2,8 @@
 #include <vector>
 #include <ctime>
 #include <string>
+#include "FrameArena.h"
+#include "AlarmStore.h"
 
 class AlarmLogic {
 public:
@@ -15,6 +17,8 @@ public:
     static int getRemainPercent(int remainSec, int totalSec);
     // アラームリストの時刻文字列を取得
     static void getAlarmTimeStrings(const std::vector<time_t>& alarms, std::vector<std::string>& out);
+    // 同上（描画用: フレームアリーナ上のリスト）
+    static void getAlarmTimeStrings(const std::vector<time_t>& alarms, FrameStringList& out);
 
     enum class AddAlarmResult {
         Success,
@@ -44,4 +48,19 @@ public:
     
     // アラームリストを取得（時刻順でソート済み）
     static std::vector<time_t> getAlarms(const std::vector<time_t>& alarms);
+
+    // AlarmStore 版（世代番号/単調時計の締め切りを管理。読み出し系は alarms.times() を渡す）
+    static void initAlarms(AlarmStore& alarms, time_t now);
+    // 消化した件数を返す
+    static size_t removePastAlarms(AlarmStore& alarms, time_t now);
+    // kind: REL+ は Relative（時計の段差に影響されない）、時刻指定は Absolute
+    static bool addAlarmAtTime(AlarmStore& alarms, time_t alarmTime, AlarmKind kind, AddAlarmResult& result, std::string& errorMsg);
+    static bool addAlarmFromPartialInput(
+        AlarmStore& alarms,
+        time_t now,
+        const int* digits,
+        const bool* entered,
+        AddAlarmResult& result,
+        std::string& errorMsg
+    );
 }; 
\ No newline at end of file
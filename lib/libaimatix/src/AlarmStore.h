@@ -0,0 +1,186 @@
+#pragma once
+#include <vector>
+#include <ctime>
+#include <cstdint>
+#include <cstddef>
+#include "EventBus.h"
+#include "ITimeService.h"
+
+// 絶対アラーム（時刻指定: 壁時計に追従）/ 相対アラーム（REL+ や起動時の +10 秒等: 経過時間に追従）
+enum class AlarmKind : uint8_t { Absolute, Relative };
+
+/**
+ * アラームの入れ物（発火順 = 時刻順）。変更のたびに世代番号を進めるので、
+ * 表示側は世代番号 1 つの比較で変化を検出でき、読み出しはコピーせず const 参照/イテレータで行う。
+ * setEventBus() すると変更を AlarmAdded/AlarmRemoved/AlarmFired として発行する。
+ *
+ * 発火判定は 64bit µs の単調時計（setTimeSource() の monotonicMicros）上の締め切りで行い、
+ * 時刻同期などで壁時計が段差を持っても相対アラームがまとめて鳴ったり遅れたりしない。
+ * 壁時計が動いたら rebase(): 絶対アラームは締め切りを取り直し、相対アラームは表示時刻を取り直す。
+ * 時刻源が無いとき（ホストテスト等）は締め切り = 壁時計秒 × 10^6 で、従来どおり壁時計で判定する。
+ */
+class AlarmStore {
+public:
+    typedef std::vector<time_t>::const_iterator const_iterator;
+
+    // 直近の消化バッチで覚えておく締め切りの数（計測用。超えた分は記録しない）
+    static constexpr size_t kFiredRecord = 8;
+
+    AlarmStore() : generation_(1), bus_(nullptr), clock_(nullptr), firedBatches_(0), firedCount_(0), firedAtUs_(0) {}
+
+    void setEventBus(EventBus* bus) { bus_ = bus; }
+    void setTimeSource(const ITimeService* clock) { clock_ = clock; }
+
+    // --- 読み出し（コピーなし）: 壁時計の時刻（表示用）を発火順に ---
+    const std::vector<time_t>& times() const { return times_; }
+    const_iterator begin() const { return times_.begin(); }
+    const_iterator end() const { return times_.end(); }
+    const time_t* data() const { return times_.data(); }
+    size_t size() const { return times_.size(); }
+    bool empty() const { return times_.empty(); }
+    time_t front() const { return times_.front(); }
+    time_t back() const { return times_.back(); }
+    time_t operator[](size_t index) const { return times_[index]; }
+    // 単調時計上の締め切り（µs）と種類
+    int64_t deadlineUs(size_t index) const { return entries_[index].deadlineUs; }
+    AlarmKind kind(size_t index) const { return entries_[index].kind; }
+    // 0 にはならない（消費側は 0 を「未表示」に使える）
+    uint32_t generation() const { return generation_; }
+    // 最も早い締め切り（タイマーで起床する時刻）。空なら false
+    bool nextDeadlineUs(int64_t& out) const {
+        if (entries_.empty()) return false;
+        out = entries_.front().deadlineUs;
+        return true;
+    }
+    // 直近の removeDue で消化したアラームの締め切りと消化した時刻（単調時計。発火の遅れの計測用）。
+    // firedBatches() は消化のあった removeDue の回数で、同じバッチを二重に数えないために使う
+    uint32_t firedBatches() const { return firedBatches_; }
+    int64_t firedAtUs() const { return firedAtUs_; }
+    size_t firedCount() const { return firedCount_; }
+    int64_t firedDeadlineUs(size_t index) const { return firedDeadlinesUs_[index]; }
+
+    // --- 変更（世代番号を進める） ---
+    // 壁時計の時刻 t に鳴るアラームを締め切り順の位置へ挿入（同時刻は後ろへ）
+    void insert(time_t t, AlarmKind kind = AlarmKind::Absolute) {
+        Entry entry;
+        entry.deadlineUs = deadlineFor(t);
+        entry.kind = kind;
+        size_t pos = entries_.size();
+        while (pos > 0 && entries_[pos - 1].deadlineUs > entry.deadlineUs) --pos;
+        entries_.insert(entries_.begin() + static_cast<std::ptrdiff_t>(pos), entry);
+        times_.insert(times_.begin() + static_cast<std::ptrdiff_t>(pos), t);
+        bump();
+        publish(EventTopic::AlarmAdded, t);
+    }
+    // 最後に鳴るアラームを削除
+    void pop_back() {
+        if (times_.empty()) return;
+        const time_t t = times_.back();
+        removeAt(times_.size() - 1);
+        publish(EventTopic::AlarmRemoved, t);
+    }
+    // 値の一致する最初の 1 件を削除
+    bool erase(time_t t) {
+        for (size_t i = 0; i < times_.size(); ++i) {
+            if (times_[i] != t) continue;
+            removeAt(i);
+            publish(EventTopic::AlarmRemoved, t);
+            return true;
+        }
+        return false;
+    }
+    // 締め切りを過ぎたアラームを消化して件数を返す。何も消えないフレームでは世代番号は変わらない。
+    // wallNow は時刻源が無いときだけ使う
+    size_t removeDue(time_t wallNow) {
+        const int64_t nowUs = clock_ != nullptr ? clock_->monotonicMicros() : static_cast<int64_t>(wallNow) * kUsPerSec;
+        size_t due = 0;
+        while (due < entries_.size() && entries_[due].deadlineUs <= nowUs) ++due;
+        if (due == 0) return 0;
+        firedCount_ = due < kFiredRecord ? due : kFiredRecord;
+        for (size_t i = 0; i < firedCount_; ++i) firedDeadlinesUs_[i] = entries_[i].deadlineUs;
+        ++firedBatches_;
+        firedAtUs_ = nowUs;
+        entries_.erase(entries_.begin(), entries_.begin() + static_cast<std::ptrdiff_t>(due));
+        times_.erase(times_.begin(), times_.begin() + static_cast<std::ptrdiff_t>(due));
+        bump();
+        publish(EventTopic::AlarmFired, static_cast<int64_t>(due));
+        return due;
+    }
+    void clear() {
+        if (times_.empty()) return;
+        times_.clear();
+        entries_.clear();
+        bump();
+        publish(EventTopic::AlarmRemoved, 0);
+    }
+
+    // 壁時計と単調時計の対応を取り直す（時刻設定/同期/TZ 変更の通知、スルーの吸収）。
+    // 絶対アラーム: 表示時刻はそのまま締め切りを再計算。相対アラーム: 締め切りはそのまま表示時刻を再計算。
+    // 表示（時刻/並び）が変わったら true（世代番号も進む）
+    bool rebase() {
+        if (clock_ == nullptr || entries_.empty()) return false;
+        const int64_t wallUs = clock_->nowMicros();
+        const int64_t monoUs = clock_->monotonicMicros();
+        bool changed = false;
+        for (size_t i = 0; i < entries_.size(); ++i) {
+            Entry& e = entries_[i];
+            if (e.kind == AlarmKind::Absolute) {
+                e.deadlineUs = monoUs + (static_cast<int64_t>(times_[i]) * kUsPerSec - wallUs);
+            } else {
+                // 最も近い秒へ（2 つの時計の読み出し間隔で 1 秒ずれないように）
+                const time_t wall = static_cast<time_t>(floorDiv(e.deadlineUs - monoUs + wallUs + kUsPerSec / 2, kUsPerSec));
+                changed = changed || wall != times_[i];
+                times_[i] = wall;
+            }
+        }
+        // 種類が混在すると順序が入れ替わり得る（件数は数件なので挿入ソート）
+        for (size_t i = 1; i < entries_.size(); ++i) {
+            for (size_t j = i; j > 0 && entries_[j - 1].deadlineUs > entries_[j].deadlineUs; --j) {
+                const Entry e = entries_[j]; entries_[j] = entries_[j - 1]; entries_[j - 1] = e;
+                const time_t t = times_[j]; times_[j] = times_[j - 1]; times_[j - 1] = t;
+                changed = true;
+            }
+        }
+        if (!changed) return false;
+        bump();
+        return true;
+    }
+
+private:
+    struct Entry {
+        int64_t deadlineUs;
+        AlarmKind kind;
+    };
+    static constexpr int64_t kUsPerSec = 1000000;
+
+    static int64_t floorDiv(int64_t a, int64_t b) {
+        const int64_t q = a / b;
+        return (a % b != 0 && ((a < 0) != (b < 0))) ? q - 1 : q;
+    }
+    // 壁時計の時刻 t を単調時計の締め切りへ（現在の対応で換算）
+    int64_t deadlineFor(time_t t) const {
+        if (clock_ == nullptr) return static_cast<int64_t>(t) * kUsPerSec;
+        return clock_->monotonicMicros() + (static_cast<int64_t>(t) * kUsPerSec - clock_->nowMicros());
+    }
+    void removeAt(size_t index) {
+        entries_.erase(entries_.begin() + static_cast<std::ptrdiff_t>(index));
+        times_.erase(times_.begin() + static_cast<std::ptrdiff_t>(index));
+        bump();
+    }
+    void bump() {
+        if (++generation_ == 0) generation_ = 1;
+    }
+    void publish(EventTopic topic, int64_t value) {
+        if (bus_ != nullptr) bus_->publish(topic, value);
+    }
+
+    std::vector<time_t> times_;   // 壁時計の時刻（表示/AlarmLogic 用）
+    std::vector<Entry> entries_;  // times_ と同じ並び
+    uint32_t generation_;
+    EventBus* bus_;
+    const ITimeService* clock_;
+    uint32_t firedBatches_;
+    size_t firedCount_;
+    int64_t firedAtUs_;
+    int64_t firedDeadlinesUs_[kFiredRecord];
+};
@@ -0,0 +1,45 @@
+#include "AlertPatterns.h"
+#include <cstddef>
+
+namespace AlertPatterns {
+
+namespace {
+
+template <typename T, size_t N>
+constexpr uint8_t countOf(const T (&)[N]) { return static_cast<uint8_t>(N); }
+
+const BacklightKeyframe kAlarmFlashFrames[] = {
+	{   0, 255, 0 },
+	{ 125,   0, 0 },
+	{ 250, 255, 0 },
+	{ 375,   0, 0 },
+	{ 500, 255, 0 },
+	{ 625,   0, 0 }, // dark until 1000ms
+};
+
+// One second per row, 4 rows: ends together with kAlarmFlash (4 loops of 1s)
+const VibrationSequencer::Segment kAlarmPulseSegments[] = {
+	{ 125, 100 }, { 125, 0 }, { 125, 100 }, { 125, 0 }, { 125, 100 }, { 375, 0 },
+	{ 125, 100 }, { 125, 0 }, { 125, 100 }, { 125, 0 }, { 125, 100 }, { 375, 0 },
+	{ 125, 100 }, { 125, 0 }, { 125, 100 }, { 125, 0 }, { 125, 100 }, { 375, 0 },
+	{ 125, 100 }, { 125, 0 }, { 125, 100 }, { 125, 0 }, { 125, 100 }, { 375, 0 },
+};
+
+const BacklightKeyframe kBootDemoFrames[] = {
+	{    0,   0, 0 },
+	{ 1000, 255, 1 },
+	{ 1500,   0, 0 },
+};
+
+const VibrationSequencer::Segment kButtonPressSegments[] = { { 100, 100 } };
+const VibrationSequencer::Segment kButtonLongPressSegments[] = { { 80, 100 }, { 80, 0 }, { 80, 100 } }; // double tick
+
+} // namespace
+
+const BacklightPattern kAlarmFlash = { kAlarmFlashFrames, countOf(kAlarmFlashFrames), 1000, 4 };
+const HapticPattern kAlarmPulse = { kAlarmPulseSegments, countOf(kAlarmPulseSegments), false };
+const BacklightPattern kBootDemo = { kBootDemoFrames, countOf(kBootDemoFrames), 2000, 1 };
+const HapticPattern kButtonPress = { kButtonPressSegments, countOf(kButtonPressSegments), false };
+const HapticPattern kButtonLongPress = { kButtonLongPressSegments, countOf(kButtonLongPressSegments), false };
+
+} // namespace AlertPatterns
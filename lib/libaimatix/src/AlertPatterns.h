@@ -0,0 +1,23 @@
+#pragma once
+
+#include "BacklightEngine.h"
+#include "VibrationSequencer.h"
+
+/**
+ * Built-in backlight/haptic patterns, compiled once into const (flash) tables.
+ * Patterns meant to be played together share the same period so that, started on
+ * one time origin (ActuatorTimeline::playAlert), their edges coincide.
+ */
+namespace AlertPatterns {
+
+// Alarm: 3 flashes (125ms on / 125ms off) + 250ms dark per second, 4 seconds
+extern const BacklightPattern kAlarmFlash;
+// Alarm haptics: one pulse per flash (same 1s period as kAlarmFlash, 4 seconds)
+extern const HapticPattern kAlarmPulse;
+// Boot demo: fade in over 1s, hold 0.5s, off for 0.5s
+extern const BacklightPattern kBootDemo;
+// Button feedback (Core2): press = one 100ms tick, long press = double tick
+extern const HapticPattern kButtonPress;
+extern const HapticPattern kButtonLongPress;
+
+} // namespace AlertPatterns
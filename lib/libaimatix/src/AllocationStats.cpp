@@ -0,0 +1,81 @@
+#include "AllocationStats.h"
+
+#include <cstdlib>
+#include <new>
+
+namespace {
+AllocationStats::ContextFilter g_filter = nullptr;
+// 単一コンテキスト（フィルタで限定）でのみ更新するため atomic は不要
+uint32_t g_count = 0;
+uint32_t g_bytes = 0;
+}
+
+namespace AllocationStats {
+
+void setContextFilter(ContextFilter filter) { g_filter = filter; }
+
+Snapshot snapshot() { return Snapshot{ g_count, g_bytes }; }
+
+void record(size_t bytes) {
+    if (g_filter != nullptr && !g_filter()) return;
+    ++g_count;
+    g_bytes += static_cast<uint32_t>(bytes);
+}
+
+} // namespace AllocationStats
+
+#ifdef ALLOC_STATS_WRAP_MALLOC
+// -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc: every C allocation passes through here
+extern "C" {
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t n, size_t size);
+void* __real_realloc(void* p, size_t size);
+
+void* __wrap_malloc(size_t size) {
+    AllocationStats::record(size);
+    return __real_malloc(size);
+}
+void* __wrap_calloc(size_t n, size_t size) {
+    AllocationStats::record(n * size);
+    return __real_calloc(n, size);
+}
+void* __wrap_realloc(void* p, size_t size) {
+    AllocationStats::record(size);
+    return __real_realloc(p, size);
+}
+}
+#define ALLOC_STATS_RAW_MALLOC __real_malloc
+#else
+#define ALLOC_STATS_RAW_MALLOC std::malloc
+#endif
+
+namespace {
+void* countedNew(size_t size) {
+    AllocationStats::record(size);
+    // 0 バイト要求でも一意なポインタを返す
+    void* p = ALLOC_STATS_RAW_MALLOC(size == 0 ? 1 : size);
+    if (p == nullptr) {
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS)
+        throw std::bad_alloc();
+#else
+        std::abort();
+#endif
+    }
+    return p;
+}
+}
+
+void* operator new(size_t size) { return countedNew(size); }
+void* operator new[](size_t size) { return countedNew(size); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    AllocationStats::record(size);
+    return ALLOC_STATS_RAW_MALLOC(size == 0 ? 1 : size);
+}
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    AllocationStats::record(size);
+    return ALLOC_STATS_RAW_MALLOC(size == 0 ? 1 : size);
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+void operator delete[](void* p, size_t) noexcept { std::free(p); }
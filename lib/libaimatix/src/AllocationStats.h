@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Heap allocation accounting.
+ * AllocationStats.cpp replaces the global operator new/delete (all builds), and with
+ * ALLOC_STATS_WRAP_MALLOC plus -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc it also
+ * counts C allocations (Arduino String, IDF components). Counting is limited to the
+ * context accepted by the filter (device: the loop task), so other tasks do not
+ * pollute per-frame numbers.
+ */
+namespace AllocationStats {
+
+struct Snapshot {
+    uint32_t count;  // allocations (new, malloc, calloc, realloc growth)
+    uint32_t bytes;  // bytes requested
+};
+
+typedef bool (*ContextFilter)();
+
+// nullptr (default) counts every context
+void setContextFilter(ContextFilter filter);
+Snapshot snapshot();
+// Called by the hooks; exposed for custom allocators
+void record(size_t bytes);
+
+} // namespace AllocationStats
+
+/**
+ * Per-frame view over AllocationStats: beginFrame()/endFrame() around one loop
+ * iteration. Keeps the last frame, the worst frame and how many frames allocated.
+ */
+class FrameAllocationMonitor {
+public:
+    FrameAllocationMonitor() : start_{0, 0}, last_{0, 0}, worst_{0, 0}, frames_(0), allocatingFrames_(0) {}
+
+    void beginFrame() { start_ = AllocationStats::snapshot(); }
+
+    // Returns the allocations made since beginFrame()
+    AllocationStats::Snapshot endFrame() {
+        const AllocationStats::Snapshot now = AllocationStats::snapshot();
+        last_.count = now.count - start_.count;
+        last_.bytes = now.bytes - start_.bytes;
+        if (last_.count > worst_.count) worst_ = last_;
+        ++frames_;
+        if (last_.count != 0) ++allocatingFrames_;
+        return last_;
+    }
+
+    AllocationStats::Snapshot lastFrame() const { return last_; }
+    AllocationStats::Snapshot worstFrame() const { return worst_; }
+    uint32_t frames() const { return frames_; }
+    uint32_t allocatingFrames() const { return allocatingFrames_; }
+    void resetPeaks() { worst_ = AllocationStats::Snapshot{0, 0}; frames_ = 0; allocatingFrames_ = 0; }
+
+private:
+    AllocationStats::Snapshot start_;
+    AllocationStats::Snapshot last_;
+    AllocationStats::Snapshot worst_;
+    uint32_t frames_;
+    uint32_t allocatingFrames_;
+};
@@ -0,0 +1,107 @@
+#include "BacklightEngine.h"
+
+namespace {
+
+// round(255 * (i / 255)^2.2), clamped to >= 1 for i > 0
+const uint8_t kGammaLut[256] = {
+	  0,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   2,   2,   2,   2,   2,   2,   2,
+	  3,   3,   3,   3,   3,   4,   4,   4,   4,   5,   5,   5,   5,   6,   6,   6,
+	  6,   7,   7,   7,   8,   8,   8,   9,   9,   9,  10,  10,  11,  11,  11,  12,
+	 12,  13,  13,  13,  14,  14,  15,  15,  16,  16,  17,  17,  18,  18,  19,  19,
+	 20,  20,  21,  22,  22,  23,  23,  24,  25,  25,  26,  26,  27,  28,  28,  29,
+	 30,  30,  31,  32,  33,  33,  34,  35,  35,  36,  37,  38,  39,  39,  40,  41,
+	 42,  43,  43,  44,  45,  46,  47,  48,  49,  49,  50,  51,  52,  53,  54,  55,
+	 56,  57,  58,  59,  60,  61,  62,  63,  64,  65,  66,  67,  68,  69,  70,  71,
+	 73,  74,  75,  76,  77,  78,  79,  81,  82,  83,  84,  85,  87,  88,  89,  90,
+	 91,  93,  94,  95,  97,  98,  99, 100, 102, 103, 105, 106, 107, 109, 110, 111,
+	113, 114, 116, 117, 119, 120, 121, 123, 124, 126, 127, 129, 130, 132, 133, 135,
+	137, 138, 140, 141, 143, 145, 146, 148, 149, 151, 153, 154, 156, 158, 159, 161,
+	163, 165, 166, 168, 170, 172, 173, 175, 177, 179, 181, 182, 184, 186, 188, 190,
+	192, 194, 196, 197, 199, 201, 203, 205, 207, 209, 211, 213, 215, 217, 219, 221,
+	223, 225, 227, 229, 231, 234, 236, 238, 240, 242, 244, 246, 248, 251, 253, 255,
+};
+
+} // namespace
+
+constexpr uint32_t BacklightEngine::kRampStepMs;
+
+uint8_t BacklightEngine::gammaToPwm(uint8_t level) {
+	return kGammaLut[level];
+}
+
+uint8_t BacklightEngine::pwmToLevel(uint8_t pwm) {
+	// The LUT is monotonic: binary search for the first entry >= pwm
+	int lo = 0;
+	int hi = 255;
+	while (lo < hi) {
+		const int mid = (lo + hi) / 2;
+		if (kGammaLut[mid] < pwm) lo = mid + 1; else hi = mid;
+	}
+	return static_cast<uint8_t>(lo);
+}
+
+uint8_t BacklightEngine::levelAt(const BacklightPattern& pattern, uint32_t offsetMs) {
+	// Patterns are a handful of keyframes: a linear scan is cheaper than anything cleverer
+	uint8_t i = 0;
+	while (i + 1 < pattern.count && pattern.frames[i + 1].atMs <= offsetMs) ++i;
+	const BacklightKeyframe& from = pattern.frames[i];
+	if (i + 1 >= pattern.count || offsetMs < from.atMs) return from.level;
+	const BacklightKeyframe& to = pattern.frames[i + 1];
+	if (!to.ramp) return from.level;
+	const int32_t span = static_cast<int32_t>(to.atMs) - from.atMs;
+	const int32_t t = static_cast<int32_t>(offsetMs) - from.atMs;
+	const int32_t delta = static_cast<int32_t>(to.level) - from.level;
+	return static_cast<uint8_t>(from.level + (delta * t) / span);
+}
+
+void BacklightEngine::play(const BacklightPattern& pattern, uint32_t nowMs) {
+	if (pattern.frames == nullptr || pattern.count == 0 || pattern.lengthMs == 0) {
+		active_ = false;
+		return;
+	}
+	pattern_ = &pattern;
+	startMs_ = nowMs;
+	active_ = true;
+	written_ = false; // first update always writes
+}
+
+bool BacklightEngine::offsetAt(uint32_t nowMs, uint32_t& offsetMs) const {
+	const uint32_t elapsed = nowMs - startMs_;
+	const uint32_t length = pattern_->lengthMs;
+	if (pattern_->loops != 0 && elapsed / length >= pattern_->loops) return false;
+	offsetMs = elapsed % length;
+	return true;
+}
+
+void BacklightEngine::update(uint32_t nowMs, IBacklight* output) {
+	if (!active_ || output == nullptr) return;
+	uint32_t offset = 0;
+	if (!offsetAt(nowMs, offset)) {
+		// Settle on the final level even if the wakeup for the last edge was late, then keep it
+		active_ = false;
+		offset = pattern_->lengthMs - 1u;
+	}
+	const uint8_t pwm = gammaToPwm(levelAt(*pattern_, offset));
+	if (written_ && pwm == lastBrightness_) return;
+	output->setBrightness(pwm);
+	lastBrightness_ = pwm;
+	written_ = true;
+}
+
+uint32_t BacklightEngine::nextUpdateAtMs(uint32_t nowMs) const {
+	if (!active_) return nowMs;
+	uint32_t offset = 0;
+	if (!offsetAt(nowMs, offset)) return nowMs;
+	const BacklightPattern& p = *pattern_;
+	uint8_t i = 0;
+	while (i + 1 < p.count && p.frames[i + 1].atMs <= offset) ++i;
+	if (i + 1 < p.count) {
+		const BacklightKeyframe& next = p.frames[i + 1];
+		const uint32_t untilNext = next.atMs - offset;
+		if (next.ramp && untilNext > kRampStepMs) return nowMs + kRampStepMs;
+		return nowMs + untilNext;
+	}
+	// Holding the last keyframe: next event is the loop point (or the end)
+	return nowMs + (p.lengthMs - offset);
+}
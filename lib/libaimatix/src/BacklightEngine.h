@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstdint>
+#include "IBacklight.h"
+
+/**
+ * Millisecond keyframe for BacklightEngine.
+ * level is perceptual (0-255); the engine maps it to PWM through a gamma 2.2 LUT.
+ */
+struct BacklightKeyframe {
+	uint16_t atMs;  // offset from the start of the pattern (ascending, first = 0)
+	uint8_t level;  // perceptual brightness at atMs
+	uint8_t ramp;   // 0: jump at atMs, 1: linear fade from the previous keyframe
+};
+
+/**
+ * Immutable pattern (keep instances in flash: static const, see AlertPatterns).
+ * After the last keyframe the level holds until lengthMs, then the pattern loops.
+ */
+struct BacklightPattern {
+	const BacklightKeyframe* frames;
+	uint8_t count;
+	uint16_t lengthMs;
+	uint8_t loops; // 0 = forever
+};
+
+/**
+ * BacklightEngine evaluates a BacklightPattern at arbitrary millisecond times.
+ * It is pure logic: a timer-driven caller invokes update() at nextUpdateAtMs(),
+ * so fades and flashes do not depend on the frame rate or render load.
+ * The output is written only when the PWM value changes; a finished pattern settles
+ * on its final level and keeps it (like BacklightSequencer).
+ */
+class BacklightEngine {
+public:
+	// Update interval while a fade is in progress (~125Hz is smooth on the LCD backlight)
+	static constexpr uint32_t kRampStepMs = 8;
+
+	BacklightEngine() : pattern_(nullptr), active_(false), startMs_(0), lastBrightness_(0), written_(false) {}
+
+	void play(const BacklightPattern& pattern, uint32_t nowMs);
+	// Stop without touching the output (caller restores its own baseline)
+	void stop() { active_ = false; }
+
+	void update(uint32_t nowMs, IBacklight* output);
+	// Absolute time of the next output change (only meaningful while isActive())
+	uint32_t nextUpdateAtMs(uint32_t nowMs) const;
+
+	bool isActive() const { return active_; }
+	uint8_t getLastBrightness() const { return lastBrightness_; }
+	// Remember a brightness applied outside the engine (keeps getLastBrightness() honest)
+	void noteBrightness(uint8_t brightness) { lastBrightness_ = brightness; written_ = true; }
+
+	// Perceptual level (0-255) → PWM duty (0-255); 0 stays off, any other level is at least 1
+	static uint8_t gammaToPwm(uint8_t level);
+	// Inverse: lowest perceptual level whose PWM reaches pwm (fades that start at a raw brightness)
+	static uint8_t pwmToLevel(uint8_t pwm);
+	// Perceptual level of pattern at offset (0 <= offsetMs < lengthMs)
+	static uint8_t levelAt(const BacklightPattern& pattern, uint32_t offsetMs);
+
+private:
+	// Position inside the current loop; false once a finite pattern is over
+	bool offsetAt(uint32_t nowMs, uint32_t& offsetMs) const;
+
+	const BacklightPattern* pattern_;
+	bool active_;
+	uint32_t startMs_;
+	uint8_t lastBrightness_;
+	bool written_;
+};
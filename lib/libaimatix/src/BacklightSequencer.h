@@ -9,6 +9,7 @@
  * It is pure logic and assumes caller invokes tick() at a fixed frame cadence
  * (e.g., 16 fps). When non-repeating sequence finishes, it keeps the last
  * brightness (do not change output further).
+ * Timer-driven, millisecond patterns use BacklightEngine instead.
  */
 class BacklightSequencer {
 public:
@@ -0,0 +1,38 @@
+#include "BatteryTelemetry.h"
+
+BatteryTelemetry::BatteryTelemetry()
+    : status_{ -1, false, 0 }, generation_(0), levelQ16_(0), millivoltsQ16_(0), lastSampleMs_(0), hasSample_(false) {}
+
+bool BatteryTelemetry::isSampleDue(uint32_t nowMs) const {
+    return !hasSample_ || (nowMs - lastSampleMs_) >= kSampleIntervalMs;
+}
+
+void BatteryTelemetry::addSample(uint32_t nowMs, int levelPercent, uint16_t millivolts, bool charging) {
+    lastSampleMs_ = nowMs;
+    if (levelPercent < 0 || levelPercent > 100) return;
+
+    const int32_t levelSample = static_cast<int32_t>(levelPercent) * 16;
+    const int32_t mvSample = static_cast<int32_t>(millivolts) * 16;
+    const bool restart = !hasSample_ || charging != status_.charging;
+    if (restart) {
+        levelQ16_ = levelSample;
+        millivoltsQ16_ = mvSample;
+    } else {
+        levelQ16_ += (levelSample - levelQ16_) / 4;
+        millivoltsQ16_ += (mvSample - millivoltsQ16_) / 4;
+    }
+    hasSample_ = true;
+    status_.millivolts = static_cast<uint16_t>((millivoltsQ16_ + 8) / 16);
+
+    // 表示値から 0.75% 以上離れたときだけ丸め直す（境界付近のちらつき防止）
+    int shown = status_.percent;
+    const int32_t diff = levelQ16_ - static_cast<int32_t>(shown) * 16;
+    if (restart || diff >= kHysteresisQ16 || diff <= -kHysteresisQ16) {
+        shown = static_cast<int>((levelQ16_ + 8) / 16);
+    }
+    if (restart || shown != status_.percent) {
+        status_.percent = shown;
+        status_.charging = charging;
+        ++generation_;
+    }
+}
@@ -0,0 +1,34 @@
+#pragma once
+#include <cstdint>
+#include "IPowerTelemetry.h"
+
+/**
+ * BatteryTelemetry smooths raw PMIC samples and caches the result.
+ * Pure logic: the device adapter reads the PMIC when isSampleDue() and feeds addSample();
+ * everything else (title bars, warnings) reads the cache.
+ * - Level and voltage: exponential moving average (1/4 weight, 1/16 fixed point)
+ * - Displayed percent: hysteresis of kHysteresisQ16 so noise around a step does not flicker
+ * - A charging state change takes the new sample as is (the level jumps on plug/unplug)
+ */
+class BatteryTelemetry : public IPowerTelemetry {
+public:
+    static constexpr uint32_t kSampleIntervalMs = 10000;
+    static constexpr int kHysteresisQ16 = 12; // 0.75%
+
+    BatteryTelemetry();
+
+    bool isSampleDue(uint32_t nowMs) const;
+    // levelPercent < 0 or > 100 is ignored (PMIC read failed)
+    void addSample(uint32_t nowMs, int levelPercent, uint16_t millivolts, bool charging);
+
+    BatteryStatus batteryStatus() const override { return status_; }
+    uint32_t generation() const override { return generation_; }
+
+private:
+    BatteryStatus status_;
+    uint32_t generation_;
+    int32_t levelQ16_;    // smoothed percent * 16
+    int32_t millivoltsQ16_;
+    uint32_t lastSampleMs_;
+    bool hasSample_;
+};
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+// Pure logic boot phase recorder.
+// mark() stores (name, microsecond timestamp) in a fixed table (no allocation, safe
+// before the heap is warm); formatTimeline() exports it as CSV "phase,at_us,delta_us".
+// Names must be string literals (only the pointer is kept). FreeRTOS/Arduino independent.
+class BootProfiler {
+public:
+	struct Mark {
+		const char* name;
+		uint32_t atUs;
+	};
+
+	static constexpr size_t kMaxMarks = 24;
+	static constexpr uint32_t kNotFound = 0xFFFFFFFFu;
+
+	BootProfiler() : count_(0), dropped_(0) {}
+
+	void mark(const char* name, uint32_t nowUs) {
+		if (count_ >= kMaxMarks) {
+			++dropped_;
+			return;
+		}
+		marks_[count_].name = name;
+		marks_[count_].atUs = nowUs;
+		++count_;
+	}
+
+	size_t count() const { return count_; }
+	size_t dropped() const { return dropped_; }
+	const Mark& at(size_t i) const { return marks_[i]; }
+
+	// Timestamp of the first mark with this name, kNotFound if absent
+	uint32_t atUs(const char* name) const {
+		for (size_t i = 0; i < count_; ++i) {
+			if (std::strcmp(marks_[i].name, name) == 0) return marks_[i].atUs;
+		}
+		return kNotFound;
+	}
+
+	// CSV timeline; delta is from the previous mark. Returns the length written
+	// (output is truncated at a line boundary when cap is too small).
+	size_t formatTimeline(char* out, size_t cap) const {
+		if (out == nullptr || cap == 0) return 0;
+		size_t len = 0;
+		out[0] = '\0';
+		len = append(out, cap, len, "phase,at_us,delta_us\n");
+		for (size_t i = 0; i < count_; ++i) {
+			char line[64];
+			const uint32_t prev = (i == 0) ? marks_[i].atUs : marks_[i - 1].atUs;
+			std::snprintf(line, sizeof(line), "%s,%lu,%lu\n", marks_[i].name,
+			              static_cast<unsigned long>(marks_[i].atUs),
+			              static_cast<unsigned long>(marks_[i].atUs - prev));
+			const size_t before = len;
+			len = append(out, cap, len, line);
+			if (len == before) break;
+		}
+		return len;
+	}
+
+private:
+	// Appends a whole line or nothing
+	static size_t append(char* out, size_t cap, size_t len, const char* line) {
+		const size_t n = std::strlen(line);
+		if (len + n + 1 > cap) return len;
+		std::memcpy(out + len, line, n + 1);
+		return len + n;
+	}
+
+	Mark marks_[kMaxMarks];
+	size_t count_;
+	size_t dropped_;
+};
@@ -2,7 +2,7 @@
 #include <cstddef>
 #include <cstdint>
 
-void ButtonManager::update(ButtonType btn, bool pressed, uint32_t now_ms) {
+void ButtonManager::update(ButtonType btn, bool pressed, int64_t now_us) {
     auto btn_index = static_cast<size_t>(btn);
     if (btn < 0 || btn_index >= sizeof(btnStates)/sizeof(btnStates[0])) {
         return; // 無効なボタンタイプ
@@ -10,21 +10,21 @@ void ButtonManager::update(ButtonType btn, bool pressed, uint32_t now_ms) {
     BtnState& btn_state = btnStates[btn_index];
     // デバウンス処理
     if (pressed != btn_state.pressed) {
-        if ((now_ms - btn_state.lastChange) <= BM_DEBOUNCE_MS) {
+        if ((now_us - btn_state.lastChangeUs) <= BM_DEBOUNCE_US) {
             return;
         }
         btn_state.pressed = pressed;
-        btn_state.lastChange = now_ms;
+        btn_state.lastChangeUs = now_us;
         if (pressed) {
             // 押下開始
-            btn_state.pressStart = now_ms;
+            btn_state.pressStartUs = now_us;
             btn_state.pressDownEdge = true; // 立ち上がりエッジ
             btn_state.shortFired = false;
             btn_state.longFired = false;
             btn_state.fired = false;
         } else {
             // 離上
-            if (!btn_state.fired && (now_ms - btn_state.pressStart) < BM_LONG_PRESS_MS) {
+            if (!btn_state.fired && (now_us - btn_state.pressStartUs) < BM_LONG_PRESS_US) {
                 btn_state.shortFired = true;
                 btn_state.fired = true;
             }
@@ -33,7 +33,7 @@ void ButtonManager::update(ButtonType btn, bool pressed, uint32_t now_ms) {
     // fired==trueなら何もしない
     if (btn_state.fired) { return; }
     // 長押し判定（押下中に閾値を超えた瞬間のみ1回）
-    if (btn_state.pressed && (now_ms - btn_state.pressStart) >= BM_LONG_PRESS_MS) {
+    if (btn_state.pressed && (now_us - btn_state.pressStartUs) >= BM_LONG_PRESS_US) {
         btn_state.longFired = true;
         btn_state.fired = true;
     }
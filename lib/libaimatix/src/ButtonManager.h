@@ -6,8 +6,8 @@ public:
     enum ButtonType { BtnA, BtnB, BtnC };
     enum ButtonAction { NONE, SHORT_PRESS, LONG_PRESS };
 
-    // ボタン状態を更新（押下/離上/時刻）
-    void update(ButtonType btn, bool pressed, uint32_t now_ms);
+    // ボタン状態を更新（押下/離上/時刻: ITimeService::monotonicMicros 相当の 64bit µs、折り返しなし）
+    void update(ButtonType btn, bool pressed, int64_t now_us);
     // 立ち上がりエッジ（press瞬間）検出
     bool isPressDown(ButtonType btn) const;
     // 短押し判定
@@ -19,13 +19,13 @@ public:
 private:
     struct BtnState {
         bool pressed = false;
-        uint32_t pressStart = 0;
-        uint32_t lastChange = 0;
+        int64_t pressStartUs = 0;
+        int64_t lastChangeUs = 0;
         bool pressDownEdge = false;
         bool shortFired = false;
         bool longFired = false;
         bool fired = false;
     } btnStates[3];
-    static constexpr uint32_t BM_LONG_PRESS_MS = 500;
-    static constexpr uint32_t BM_DEBOUNCE_MS = 50;
+    static constexpr int64_t BM_LONG_PRESS_US = 500000;
+    static constexpr int64_t BM_DEBOUNCE_US = 50000;
 };
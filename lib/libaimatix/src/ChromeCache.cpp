@@ -0,0 +1,36 @@
+#include "ChromeCache.h"
+#include "ui_constants.h"
+#include <cstring>
+
+namespace {
+constexpr int16_t kTitleTextY = 2;
+constexpr int16_t kBatteryW = 70;
+constexpr int16_t kHintTop = SCREEN_HEIGHT - HINT_HEIGHT + 1; // 区切り線の下
+constexpr int16_t kHintTextY = SCREEN_HEIGHT - HINT_HEIGHT + 2;
+constexpr int16_t kHintCellW = SCREEN_WIDTH / 3;
+
+// 従来の drawTitleBar/drawButtonHintsGrid と同じ文字位置。背景はセル単位で塗り直す
+const ChromeCell kCells[ChromeCache::kCellCount] = {
+    { 0, 0, SCREEN_WIDTH - kBatteryW, TITLE_HEIGHT - 1, 5, kTitleTextY },                          // TitleLabel
+    { SCREEN_WIDTH - kBatteryW, 0, kBatteryW, TITLE_HEIGHT - 1, SCREEN_WIDTH - kBatteryW, kTitleTextY }, // Battery
+    { 0, kHintTop, kHintCellW, HINT_HEIGHT - 1, 20, kHintTextY },                                   // HintA
+    { kHintCellW, kHintTop, SCREEN_WIDTH - 2 * kHintCellW, HINT_HEIGHT - 1, SCREEN_WIDTH / 2 - 30, kHintTextY }, // HintB
+    { SCREEN_WIDTH - kHintCellW, kHintTop, kHintCellW, HINT_HEIGHT - 1, SCREEN_WIDTH - 80, kHintTextY }, // HintC
+};
+} // namespace
+
+constexpr size_t ChromeCache::kTextMax;
+
+bool ChromeCache::update(Cell cell, const char* text) {
+    if (cell >= kCellCount) return false;
+    const char* s = text != nullptr ? text : "";
+    if (known_[cell] && std::strncmp(text_[cell], s, kTextMax - 1) == 0) return false;
+    std::strncpy(text_[cell], s, kTextMax - 1);
+    text_[cell][kTextMax - 1] = '\0';
+    known_[cell] = true;
+    return true;
+}
+
+const ChromeCell& ChromeCache::cell(Cell cell) {
+    return kCells[cell < kCellCount ? cell : 0];
+}
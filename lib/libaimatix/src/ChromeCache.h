@@ -0,0 +1,55 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// Geometry of one static chrome text cell: background rectangle + top-left text origin
+struct ChromeCell {
+    int16_t x;
+    int16_t y;
+    int16_t w;
+    int16_t h;
+    int16_t textX;
+    int16_t textY;
+};
+
+/**
+ * What the static chrome (title label, battery, button hints, separator rules) currently
+ * shows on the panel. drawTitleBar/drawButtonHintsGrid consult it, so a screen transition
+ * only touches the cells whose text differs from what the previous screen left there.
+ * A full clear() (or anything else drawn over the chrome) must call invalidate().
+ * Fixed storage, no allocation.
+ */
+class ChromeCache {
+public:
+    enum Cell : uint8_t { TitleLabel, Battery, HintA, HintB, HintC, kCellCount };
+    enum Rule : uint8_t { TitleRule, HintRule, kRuleCount };
+    static constexpr size_t kTextMax = 24; // longer texts are compared on their prefix
+
+    ChromeCache() { invalidate(); }
+
+    void invalidate() {
+        for (size_t i = 0; i < kCellCount; ++i) {
+            text_[i][0] = '\0';
+            known_[i] = false;
+        }
+        rules_ = 0;
+    }
+
+    // True when the cell must be drawn (unknown or different text); records text as drawn
+    bool update(Cell cell, const char* text);
+
+    // True when the rule must be drawn; records it as drawn
+    bool updateRule(Rule rule) {
+        const uint8_t bit = static_cast<uint8_t>(1u << rule);
+        if (rules_ & bit) return false;
+        rules_ = static_cast<uint8_t>(rules_ | bit);
+        return true;
+    }
+
+    static const ChromeCell& cell(Cell cell);
+
+private:
+    char text_[kCellCount][kTextMax];
+    bool known_[kCellCount];
+    uint8_t rules_;
+};
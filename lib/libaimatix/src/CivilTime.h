@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+
+// Proleptic Gregorian calendar arithmetic on days since 1970-01-01 (UTC, no libc).
+// Howard Hinnant's days_from_civil / civil_from_days; O(1), valid for any int64 day.
+namespace CivilTime {
+
+inline int64_t daysFromCivil(int64_t y, int m, int d) {
+    y -= (m <= 2) ? 1 : 0;
+    const int64_t era = (y >= 0 ? y : y - 399) / 400;
+    const int64_t yoe = y - era * 400;
+    const int64_t doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    const int64_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + doe - 719468;
+}
+
+inline void civilFromDays(int64_t z, int& y, int& m, int& d) {
+    z += 719468;
+    const int64_t era = (z >= 0 ? z : z - 146096) / 146097;
+    const int64_t doe = z - era * 146097;
+    const int64_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const int64_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const int64_t mp = (5 * doy + 2) / 153;
+    d = static_cast<int>(doy - (153 * mp + 2) / 5 + 1);
+    m = static_cast<int>(mp < 10 ? mp + 3 : mp - 9);
+    y = static_cast<int>(yoe + era * 400 + (m <= 2 ? 1 : 0));
+}
+
+inline bool isLeapYear(int y) {
+    return (y % 4 == 0 && y % 100 != 0) || (y % 400 == 0);
+}
+
+inline int daysInMonth(int y, int m) {
+    static const int kDays[12] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+    return (m == 2 && isLeapYear(y)) ? 29 : kDays[m - 1];
+}
+
+// 0 = Sunday (1970-01-01 was a Thursday)
+inline int weekdayFromDays(int64_t z) {
+    const int64_t w = (z + 4) % 7;
+    return static_cast<int>(w < 0 ? w + 7 : w);
+}
+
+// Floor division of epoch seconds into (days, seconds of day)
+inline void splitEpoch(int64_t t, int64_t& days, int64_t& secs) {
+    days = t / 86400;
+    secs = t % 86400;
+    if (secs < 0) { secs += 86400; --days; }
+}
+
+}
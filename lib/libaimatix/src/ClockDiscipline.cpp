@@ -0,0 +1,40 @@
+#include "ClockDiscipline.h"
+
+ClockDiscipline::ClockDiscipline(uint32_t slewRatePpm)
+    : estimator_(), slew_(slewRatePpm), hasTick_(false), lastTickMs_(0), driftFracPpbMs_(0) {}
+
+auto ClockDiscipline::onSync(int64_t localEpochUs, int64_t trueEpochUs, bool& driftUpdated) -> SyncAction {
+    driftUpdated = false;
+    // Offset still queued in the slew counts as already corrected
+    const int64_t residualUs = localEpochUs + slew_.remainingUs() - trueEpochUs;
+    const int64_t thresholdUs = stepThresholdUs();
+    if (residualUs > thresholdUs || residualUs < -thresholdUs) {
+        slew_.cancel();
+        estimator_.setReference(trueEpochUs);
+        return SyncAction::Step;
+    }
+    driftUpdated = estimator_.observe(trueEpochUs, residualUs);
+    // New slew = what was still queued + the fresh residual
+    slew_.start(slew_.remainingUs() - residualUs);
+    return SyncAction::Slew;
+}
+
+void ClockDiscipline::onExternalStep() {
+    slew_.cancel();
+    estimator_.clearReference();
+}
+
+auto ClockDiscipline::correctionDue(uint32_t monoMs) -> int64_t {
+    if (!hasTick_) {
+        hasTick_ = true;
+        lastTickMs_ = monoMs;
+        return 0;
+    }
+    const uint32_t elapsedMs = monoMs - lastTickMs_;
+    lastTickMs_ = monoMs;
+    // Fast clock (positive drift) is pulled back
+    driftFracPpbMs_ -= static_cast<int64_t>(estimator_.driftPpb()) * elapsedMs;
+    const int64_t driftUs = driftFracPpbMs_ / 1000000LL;
+    driftFracPpbMs_ -= driftUs * 1000000LL;
+    return driftUs + slew_.take(elapsedMs);
+}
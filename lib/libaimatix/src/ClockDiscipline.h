@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+#include "ClockDriftEstimator.h"
+#include "SlewPlanner.h"
+
+// Pure logic: disciplines the wall clock between syncs.
+// - Frequency: the estimated drift is compensated continuously
+// - Phase: sync offsets up to stepThresholdUs() are slewed, larger ones are stepped
+// The adapter feeds correctionDue() into the OS clock (e.g. adjtime) every frame.
+class ClockDiscipline {
+public:
+    enum class SyncAction { Step, Slew };
+
+    // Longest slew allowed: larger offsets are stepped so the clock is never visibly wrong
+    // for long after a sync (5000 ppm → 0.9 s threshold)
+    static constexpr uint32_t kMaxSlewSec = 180;
+
+    explicit ClockDiscipline(uint32_t slewRatePpm = SlewPlanner::kDefaultRatePpm);
+
+    void restoreDriftPpb(int32_t driftPpb) { estimator_.restore(driftPpb); }
+    int32_t driftPpb() const { return estimator_.driftPpb(); }
+    bool hasDriftEstimate() const { return estimator_.hasEstimate(); }
+
+    // localEpochUs: the disciplined clock at the sync instant (corrections applied so far).
+    // On Step the caller sets the clock to trueEpochUs. driftUpdated tells when to persist.
+    SyncAction onSync(int64_t localEpochUs, int64_t trueEpochUs, bool& driftUpdated);
+
+    // Clock changed outside of a sync (manual set): drop baseline and pending slew
+    void onExternalStep();
+
+    // µs to add to the clock now (drift compensation + slew progress)
+    int64_t correctionDue(uint32_t monoMs);
+
+    int64_t pendingSlewUs() const { return slew_.remainingUs(); }
+    // Largest offset that is slewed: what the slew rate covers in kMaxSlewSec (ppm * s = µs)
+    int64_t stepThresholdUs() const { return static_cast<int64_t>(slew_.ratePpm()) * kMaxSlewSec; }
+
+private:
+    ClockDriftEstimator estimator_;
+    SlewPlanner slew_;
+    bool hasTick_;
+    uint32_t lastTickMs_;
+    int64_t driftFracPpbMs_;  // fractional compensation carry (ppb * ms = 1e-6 µs)
+};
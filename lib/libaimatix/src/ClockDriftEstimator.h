@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+
+// Pure logic: estimates the local oscillator frequency error (ppb) from successive syncs.
+// Each sync reports the residual offset (local - true) that remained after the current
+// compensation. Residuals accumulate until the baseline is long enough, then the estimate
+// moves toward the measured rate (first estimate taken as is, later ones averaged).
+// Sign: positive = local clock runs fast.
+class ClockDriftEstimator {
+public:
+    static constexpr int32_t kMaxDriftPpb = 500000;                    // ±500 ppm
+    static constexpr int64_t kMinBaselineUs = 30LL * 60LL * 1000000LL; // 30 min
+
+    ClockDriftEstimator()
+        : driftPpb_(0), hasEstimate_(false), hasReference_(false), referenceTrueUs_(0), accumulatedResidualUs_(0) {}
+
+    // Restore a persisted estimate (e.g. from NVS)
+    void restore(int32_t driftPpb) {
+        driftPpb_ = clampPpb(driftPpb);
+        hasEstimate_ = true;
+    }
+
+    // Start a new baseline at a sync where the clock was set exactly to trueEpochUs
+    void setReference(int64_t trueEpochUs) {
+        referenceTrueUs_ = trueEpochUs;
+        accumulatedResidualUs_ = 0;
+        hasReference_ = true;
+    }
+    // Baseline invalid (manual set, step)
+    void clearReference() { hasReference_ = false; accumulatedResidualUs_ = 0; }
+
+    // Residual at a sync. Returns true when the estimate changed.
+    bool observe(int64_t trueEpochUs, int64_t residualUs) {
+        if (!hasReference_) { setReference(trueEpochUs); return false; }
+        accumulatedResidualUs_ += residualUs;
+        const int64_t baselineUs = trueEpochUs - referenceTrueUs_;
+        if (baselineUs < kMinBaselineUs) return false; // keep collecting
+        const int64_t residualPpb = accumulatedResidualUs_ * 1000000000LL / baselineUs;
+        setReference(trueEpochUs);
+        if (residualPpb > kMaxDriftPpb || residualPpb < -kMaxDriftPpb) return false; // not oscillator drift
+        const int64_t step = hasEstimate_ ? residualPpb / 2 : residualPpb;
+        driftPpb_ = clampPpb(static_cast<int64_t>(driftPpb_) + step);
+        hasEstimate_ = true;
+        return true;
+    }
+
+    int32_t driftPpb() const { return driftPpb_; }
+    bool hasEstimate() const { return hasEstimate_; }
+    bool hasReference() const { return hasReference_; }
+
+private:
+    static int32_t clampPpb(int64_t v) {
+        if (v > kMaxDriftPpb) return kMaxDriftPpb;
+        if (v < -kMaxDriftPpb) return -kMaxDriftPpb;
+        return static_cast<int32_t>(v);
+    }
+
+    int32_t driftPpb_;
+    bool hasEstimate_;
+    bool hasReference_;
+    int64_t referenceTrueUs_;
+    int64_t accumulatedResidualUs_;
+};
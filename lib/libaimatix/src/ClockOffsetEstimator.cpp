@@ -0,0 +1,63 @@
+#include "ClockOffsetEstimator.h"
+
+namespace ClockOffsetEstimator {
+
+namespace {
+
+// Client epoch (µs) at the device send time t2: (t0 + t3)/2 + (t2 - t1)/2
+int64_t anchorAtSend(const Sample& s) {
+    const uint32_t hold = s.deviceSendMs - s.deviceRecvMs;
+    return ((s.clientSendMs + s.clientRecvMs) * 1000 + static_cast<int64_t>(hold) * 1000) / 2;
+}
+
+// Signed distance a - b on the wrapping uint32 monotonic clock
+int32_t monoDiffMs(uint32_t a, uint32_t b) {
+    return static_cast<int32_t>(a - b);
+}
+
+} // namespace
+
+bool sampleDelayMs(const Sample& sample, uint32_t& outDelayMs) {
+    const int64_t roundTrip = sample.clientRecvMs - sample.clientSendMs;
+    if (roundTrip < 0 || roundTrip > static_cast<int64_t>(kMaxDelayMs)) return false;
+    const uint32_t hold = sample.deviceSendMs - sample.deviceRecvMs;
+    // Device cannot hold the request longer than the client waited for it
+    if (static_cast<int64_t>(hold) > roundTrip) return false;
+    outDelayMs = static_cast<uint32_t>(roundTrip - static_cast<int64_t>(hold));
+    return true;
+}
+
+bool estimate(const Sample* samples, size_t count, Estimate& out) {
+    if (samples == nullptr) return false;
+    size_t best = count;
+    uint32_t bestDelay = 0;
+    for (size_t i = 0; i < count; ++i) {
+        uint32_t d = 0;
+        if (!sampleDelayMs(samples[i], d)) continue;
+        if (best == count || d < bestDelay) { best = i; bestDelay = d; }
+    }
+    if (best == count) return false;
+
+    // Re-project every near-best sample onto the best sample's t2 and average
+    const uint32_t refMono = samples[best].deviceSendMs;
+    int64_t sumUs = 0;
+    size_t used = 0;
+    for (size_t i = 0; i < count; ++i) {
+        uint32_t d = 0;
+        if (!sampleDelayMs(samples[i], d) || d > bestDelay + kDelayToleranceMs) continue;
+        const int32_t shiftMs = monoDiffMs(refMono, samples[i].deviceSendMs);
+        sumUs += anchorAtSend(samples[i]) + static_cast<int64_t>(shiftMs) * 1000;
+        ++used;
+    }
+    out.anchorEpochUs = sumUs / static_cast<int64_t>(used);
+    out.anchorMonoMs = refMono;
+    out.delayUs = bestDelay * 1000u;
+    out.used = used;
+    return true;
+}
+
+int64_t epochUsAt(const Estimate& estimate, uint32_t monoMs) {
+    return estimate.anchorEpochUs + static_cast<int64_t>(monoDiffMs(monoMs, estimate.anchorMonoMs)) * 1000;
+}
+
+}
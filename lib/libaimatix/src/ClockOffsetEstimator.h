@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// NTP-style offset estimation between the browser wall clock and the device monotonic clock.
+// One exchange (GET /time/probe) yields four timestamps:
+//   t0 = client send (epoch ms), t1 = device receive (monotonic ms),
+//   t2 = device send (monotonic ms), t3 = client receive (epoch ms)
+// offset = ((t1 - t0) + (t2 - t3)) / 2, delay = (t3 - t0) - (t2 - t1).
+// Monotonic values are uint32 and may wrap; all differences use modular arithmetic.
+namespace ClockOffsetEstimator {
+
+// Samples slower than this are discarded (Wi‑Fi retries, backgrounded page)
+constexpr uint32_t kMaxDelayMs = 2000;
+// Samples within this much of the best delay are averaged together
+constexpr uint32_t kDelayToleranceMs = 2;
+
+struct Sample {
+    int64_t clientSendMs;
+    uint32_t deviceRecvMs;
+    uint32_t deviceSendMs;
+    int64_t clientRecvMs;
+};
+
+// Client wall clock expressed as an anchor on the device monotonic clock
+struct Estimate {
+    int64_t anchorEpochUs;  // client epoch (µs) at anchorMonoMs
+    uint32_t anchorMonoMs;  // device monotonic ms of the best sample's t2
+    uint32_t delayUs;       // round-trip delay of the best sample (network only)
+    size_t used;            // samples averaged into the anchor
+};
+
+// Round-trip delay in ms; false if the sample is inconsistent or too slow
+bool sampleDelayMs(const Sample& sample, uint32_t& outDelayMs);
+
+// Minimum-delay filter: picks the lowest-delay sample, averages those within
+// kDelayToleranceMs of it. Returns false when no sample is valid.
+bool estimate(const Sample* samples, size_t count, Estimate& out);
+
+// Client epoch (µs) at the given device monotonic time (wrap-safe within ±24 days)
+int64_t epochUsAt(const Estimate& estimate, uint32_t monoMs);
+
+}
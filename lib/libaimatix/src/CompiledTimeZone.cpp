@@ -0,0 +1,73 @@
+#include "CompiledTimeZone.h"
+#include "CivilTime.h"
+
+CompiledTimeZone::CompiledTimeZone()
+    : rule_(), cacheStartUtc_(0), cacheEndUtc_(0), dstStartUtc_(0), dstEndUtc_(0) {}
+
+void CompiledTimeZone::setRule(const TzRule& rule) {
+    rule_ = rule;
+    cacheStartUtc_ = cacheEndUtc_ = 0; // invalidate
+}
+
+void CompiledTimeZone::setFixedOffset(int offsetMinutes) {
+    TzRule r{};
+    r.stdOffsetMin = static_cast<int16_t>(offsetMinutes);
+    r.dstOffsetMin = r.stdOffsetMin;
+    setRule(r);
+}
+
+int64_t CompiledTimeZone::transitionUtc(int year, const TzTransitionRule& rule, int wallOffsetMin) {
+    // Mm.w.d: d-th weekday of week w (5 = last) of month m
+    const int64_t firstDay = CivilTime::daysFromCivil(year, rule.month, 1);
+    int day = 1 + (rule.weekday - CivilTime::weekdayFromDays(firstDay) + 7) % 7 + (rule.week - 1) * 7;
+    const int dim = CivilTime::daysInMonth(year, rule.month);
+    while (day > dim) day -= 7;
+    const int64_t localSec = (firstDay + day - 1) * 86400 + static_cast<int64_t>(rule.timeMin) * 60;
+    return localSec - static_cast<int64_t>(wallOffsetMin) * 60;
+}
+
+void CompiledTimeZone::rebuildCache(int64_t utc) {
+    int64_t days = 0;
+    int64_t secs = 0;
+    CivilTime::splitEpoch(utc, days, secs);
+    int y = 0, m = 0, d = 0;
+    CivilTime::civilFromDays(days, y, m, d);
+    cacheStartUtc_ = CivilTime::daysFromCivil(y, 1, 1) * 86400;
+    cacheEndUtc_ = CivilTime::daysFromCivil(y + 1, 1, 1) * 86400;
+    if (hasDst()) {
+        dstStartUtc_ = transitionUtc(y, rule_.dstStart, rule_.stdOffsetMin);
+        dstEndUtc_ = transitionUtc(y, rule_.dstEnd, rule_.dstOffsetMin);
+    }
+}
+
+bool CompiledTimeZone::isDstAt(int64_t utc) {
+    if (!hasDst()) return false;
+    if (utc < cacheStartUtc_ || utc >= cacheEndUtc_) rebuildCache(utc);
+    // Northern: DST between start and end. Southern (start after end): DST wraps the new year.
+    if (dstStartUtc_ < dstEndUtc_) return utc >= dstStartUtc_ && utc < dstEndUtc_;
+    return utc >= dstStartUtc_ || utc < dstEndUtc_;
+}
+
+int CompiledTimeZone::offsetMinutesAt(time_t utc) {
+    return isDstAt(static_cast<int64_t>(utc)) ? rule_.dstOffsetMin : rule_.stdOffsetMin;
+}
+
+void CompiledTimeZone::toLocal(time_t utc, struct tm& out) {
+    const bool dst = isDstAt(static_cast<int64_t>(utc));
+    const int offset = dst ? rule_.dstOffsetMin : rule_.stdOffsetMin;
+    int64_t days = 0;
+    int64_t secs = 0;
+    CivilTime::splitEpoch(static_cast<int64_t>(utc) + static_cast<int64_t>(offset) * 60, days, secs);
+    int y = 0, m = 0, d = 0;
+    CivilTime::civilFromDays(days, y, m, d);
+    out = tm{};
+    out.tm_year = y - 1900;
+    out.tm_mon = m - 1;
+    out.tm_mday = d;
+    out.tm_hour = static_cast<int>(secs / 3600);
+    out.tm_min = static_cast<int>((secs % 3600) / 60);
+    out.tm_sec = static_cast<int>(secs % 60);
+    out.tm_wday = CivilTime::weekdayFromDays(days);
+    out.tm_yday = static_cast<int>(days - CivilTime::daysFromCivil(y, 1, 1));
+    out.tm_isdst = dst ? 1 : 0;
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <ctime>
+#include <cstdint>
+#include "TzRule.h"
+
+/**
+ * UTC → local conversion from a compiled TzRule without libc TZ parsing.
+ * The two DST transitions of the current UTC year are cached as UTC instants, so a
+ * conversion is a range check, two comparisons and O(1) calendar arithmetic.
+ * Assumes no transition within a day of 1 January (true for every IANA rule in use).
+ */
+class CompiledTimeZone {
+public:
+    CompiledTimeZone(); // UTC
+
+    void setRule(const TzRule& rule);
+    void setFixedOffset(int offsetMinutes);
+    const TzRule& rule() const { return rule_; }
+    bool hasDst() const { return rule_.dstStart.month != 0; }
+
+    // Offset (minutes east) in effect at utc
+    int offsetMinutesAt(time_t utc);
+    // Broken-down local time (tm_isdst/tm_wday/tm_yday filled)
+    void toLocal(time_t utc, struct tm& out);
+
+    // UTC instant of a rule transition in the given year; wallOffsetMin is the offset before it
+    static int64_t transitionUtc(int year, const TzTransitionRule& rule, int wallOffsetMin);
+
+private:
+    bool isDstAt(int64_t utc);
+    void rebuildCache(int64_t utc);
+
+    TzRule rule_;
+    int64_t cacheStartUtc_; // [start, end) = cached UTC year
+    int64_t cacheEndUtc_;
+    int64_t dstStartUtc_;
+    int64_t dstEndUtc_;
+};
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstdint>
+
+// Pure logic CPU frequency governor (ESP32 steps: 80 / 160 / 240 MHz).
+// - Workload sets a floor: Idle 80, Interactive 160, Radio 160 (Wi-Fi/HTTP need headroom)
+// - boost() forces 240 MHz for a short burst (QR encoding, AP start)
+// - The frame busy ratio (FrameLoadMeter) scales the clock so the loop stays under
+//   kTargetBusyPermille of the frame. Raising is immediate; lowering waits for
+//   kLowerHoldFrames consecutive frames (hysteresis, no flapping between steps).
+// The device adapter applies currentMhz() (setCpuFrequencyMhz or an esp_pm lock).
+class CpuFrequencyGovernor {
+public:
+	enum class Workload : uint8_t { Idle, Interactive, Radio };
+
+	static constexpr uint16_t kLowMhz = 80;
+	static constexpr uint16_t kMidMhz = 160;
+	static constexpr uint16_t kHighMhz = 240;
+	static constexpr uint32_t kTargetBusyPermille = 500;
+	static constexpr uint8_t kLowerHoldFrames = 8;
+
+	CpuFrequencyGovernor() : mhz_(kHighMhz), boostUntilMs_(0), boosting_(false), lowerVotes_(0) {}
+
+	// Force the maximum clock until nowMs + durationMs (extends a running boost)
+	void boost(uint32_t nowMs, uint32_t durationMs) {
+		const uint32_t until = nowMs + durationMs;
+		if (!boosting_ || static_cast<int32_t>(until - boostUntilMs_) > 0) boostUntilMs_ = until;
+		boosting_ = true;
+		mhz_ = kHighMhz;
+		lowerVotes_ = 0;
+	}
+
+	// Once per frame; returns the clock to run the next frame at
+	uint16_t update(uint32_t nowMs, Workload workload, uint32_t busyPermille) {
+		if (boosting_ && static_cast<int32_t>(nowMs - boostUntilMs_) >= 0) boosting_ = false;
+		if (boosting_) return mhz_ = kHighMhz;
+
+		const uint16_t wanted = wantedMhz(workload, busyPermille);
+		if (wanted >= mhz_) {
+			mhz_ = wanted;
+			lowerVotes_ = 0;
+		} else if (++lowerVotes_ >= kLowerHoldFrames) {
+			mhz_ = wanted;
+			lowerVotes_ = 0;
+		}
+		return mhz_;
+	}
+
+	uint16_t currentMhz() const { return mhz_; }
+	bool isBoosting() const { return boosting_; }
+
+	static uint16_t floorMhz(Workload workload) {
+		return workload == Workload::Idle ? kLowMhz : kMidMhz;
+	}
+
+private:
+	// Smallest step that keeps the projected busy ratio at or under the target
+	uint16_t wantedMhz(Workload workload, uint32_t busyPermille) const {
+		// 現在クロックで測った負荷を必要クロックへ換算（負荷はクロックに反比例と仮定）
+		const uint32_t neededMhz = (static_cast<uint32_t>(mhz_) * busyPermille + kTargetBusyPermille - 1) / kTargetBusyPermille;
+		uint16_t step = floorMhz(workload);
+		while (step < kHighMhz && neededMhz > step) step = static_cast<uint16_t>(step + 80);
+		return step;
+	}
+
+	uint16_t mhz_;
+	uint32_t boostUntilMs_;
+	bool boosting_;
+	uint8_t lowerVotes_;
+};
@@ -3,8 +3,7 @@
 #include <cassert>
 #include <cstring>
 #include <ctime>
-#include <sstream>
-#include <iomanip>
+#include <cstdio>
 
 // 定数定義
 constexpr int YEAR_BASE_OFFSET = 1000;
@@ -37,9 +36,11 @@ void DateTimeInputState::onEnter() {
     cursorPosition = DIGIT_YEAR_TEN;
     isEditMode = false;
     
+    differ.invalidate();
     if (view != nullptr) {
         view->clear();
-        view->showTitle("SET DATE/TIME", BATTERY_WARNING_THRESHOLD, false);
+        const BatteryStatus bat = battery.take();
+        view->showTitle("SET DATE/TIME", bat.percent, bat.charging);
         view->showHints("INC", "NEXT", "SET");
         onDraw();
     }
@@ -51,9 +52,21 @@ void DateTimeInputState::onExit() {
 
 void DateTimeInputState::onDraw() {
     if (view != nullptr) {
-        const std::string dateTimeStr = formatDateTimeString();
+        // 電池表示は表示値が変わったときだけ再描画
+        if (battery.changed()) {
+            const BatteryStatus bat = battery.take();
+            view->showTitle("SET DATE/TIME", bat.percent, bat.charging);
+        }
+        // 桁かカーソルが変わったときだけ文字列を作ってビューへ
+        DateTimeViewModel model;
+        model.digits = ViewFingerprint::ofInts(dateTimeDigits.data(), dateTimeDigits.size());
+        model.cursor = static_cast<uint32_t>(cursorPosition);
+        if (differ.diff(model) == 0) {
+            return;
+        }
+        formatDateTimeInto(dateTimeText);
         const int stringPosition = dataPositionToStringPosition(cursorPosition);
-        view->showDateTimeString(dateTimeStr, stringPosition);
+        view->showDateTimeString(dateTimeText, stringPosition);
     }
 }
 
@@ -328,23 +341,21 @@ void DateTimeInputState::commitDateTime() {
 }
 
 std::string DateTimeInputState::formatDateTimeString() const {
-    std::ostringstream oss;
-    oss << std::setfill('0') << std::setw(4) 
-        << (getDigitValue(0) * 1000 + getDigitValue(1) * 100 + getDigitValue(2) * 10 + getDigitValue(3));
-    oss << "/";
-    oss << std::setfill('0') << std::setw(2) 
-        << (getDigitValue(4) * 10 + getDigitValue(5));
-    oss << "/";
-    oss << std::setfill('0') << std::setw(2) 
-        << (getDigitValue(6) * 10 + getDigitValue(7));
-    oss << " ";
-    oss << std::setfill('0') << std::setw(2) 
-        << (getDigitValue(8) * 10 + getDigitValue(9));
-    oss << ":";
-    oss << std::setfill('0') << std::setw(2) 
-        << (getDigitValue(10) * 10 + getDigitValue(11));
-    
-    return oss.str();
+    std::string result;
+    formatDateTimeInto(result);
+    return result;
+}
+
+void DateTimeInputState::formatDateTimeInto(std::string& out) const {
+    // "YYYY/MM/DD HH:MM"。out の容量を再利用するので、2 回目以降は確保しない
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%04d/%02d/%02d %02d:%02d",
+             getDigitValue(0) * 1000 + getDigitValue(1) * 100 + getDigitValue(2) * 10 + getDigitValue(3),
+             getDigitValue(4) * 10 + getDigitValue(5),
+             getDigitValue(6) * 10 + getDigitValue(7),
+             getDigitValue(8) * 10 + getDigitValue(9),
+             getDigitValue(10) * 10 + getDigitValue(11));
+    out.assign(buf);
 }
 
 int DateTimeInputState::dataPositionToStringPosition(int dataPos) {
@@ -2,10 +2,21 @@
 #include "StateManager.h"
 #include "ITimeService.h"
 #include "IDateTimeInputView.h"
+#include "IPowerTelemetry.h"
+#include "ViewModelDiffer.h"
 #include <array>
 #include <string>
 #include <vector>
 
+// 日時入力画面の表示内容（POD）。文字列は桁配列から決まるので、桁の指紋とカーソル位置だけを比較する
+struct DateTimeViewModel {
+    enum Field : uint8_t { Digits, Cursor, kFieldCount };
+    uint32_t digits;
+    uint32_t cursor;
+
+    uint32_t fingerprint(size_t field) const { return field == Digits ? digits : cursor; }
+};
+
 // 日時入力画面の状態クラス
 class DateTimeInputState : public IState {
 public:
@@ -29,10 +40,12 @@ public:
     void setSettingsDisplayState(IState* settingsState) { settingsDisplayState = settingsState; }
     void setTimeService(ITimeService* service) { timeService = service; }
     void setView(IDateTimeInputView* v) { view = v; }
+    void setPowerTelemetry(const IPowerTelemetry* telemetry) { battery.setSource(telemetry); }
     
     // 公開バリデーションメソッド
     bool validateDateTime() const;
     std::string formatDateTimeString() const;
+    void formatDateTimeInto(std::string& out) const;
     
 private:
     ITimeService* timeService;
@@ -44,6 +57,9 @@ private:
     std::vector<int> dateTimeDigits;
     int cursorPosition;  // 0-11の範囲
     bool isEditMode;
+    TitleBatteryIndicator battery;
+    std::string dateTimeText;  // onDraw 用の表示文字列バッファ（容量を再利用）
+    ViewModelDiffer<DateTimeViewModel> differ;
     
     // 定数
     static constexpr int YEAR_MIN = 2020;
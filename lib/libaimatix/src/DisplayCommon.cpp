@@ -1,47 +1,51 @@
 #include "DisplayCommon.h"
 #include "IDisplay.h"
 #include "ui_constants.h"
+#include "ChromeCache.h"
 #include <cstdio>
 #include <cstring>
 #include <array>
 
 // 定数定義
-constexpr int TITLE_OFFSET_X = 5;
-constexpr int TITLE_OFFSET_Y = 2;
-constexpr int BATTERY_OFFSET_X = 70;
-constexpr int HINT_OFFSET_Y = 2;
-constexpr int BUTTON_A_OFFSET_X = 20;
-constexpr int BUTTON_B_OFFSET_X = 30;
-constexpr int BUTTON_C_OFFSET_X = 80;
 constexpr int GRID_LINES_X = 16;
 constexpr int GRID_LINES_Y = 12;
 
+namespace {
+// セル単位で描画。ChromeCache があれば画面上の内容と同じセルは転送しない
+void drawChromeCell(IDisplay* disp, ChromeCache* cache, ChromeCache::Cell id, const char* text) {
+    if (cache != nullptr && !cache->update(id, text)) return;
+    const ChromeCell& c = ChromeCache::cell(id);
+    disp->drawTextCell(c.x, c.y, c.w, c.h, c.textX, c.textY, text != nullptr ? text : "", FONT_AUXILIARY,
+                       AMBER_COLOR, TFT_BLACK);
+}
+} // namespace
+
 void drawTitleBar(IDisplay* disp, const char* modeName, int batteryLevel, bool isCharging) {
-    disp->fillRect(0, TITLE_HEIGHT - 1, SCREEN_WIDTH, 1, AMBER_COLOR); // 横線
-    disp->setTextFont(FONT_AUXILIARY);
-    disp->setTextColor(AMBER_COLOR, TFT_BLACK);
-    disp->setTextDatum(TL_DATUM);
-    disp->drawText(TITLE_OFFSET_X, TITLE_OFFSET_Y, modeName, FONT_AUXILIARY);
+    ChromeCache* cache = disp->chromeCache();
+    if (cache == nullptr || cache->updateRule(ChromeCache::TitleRule)) {
+        disp->fillRect(0, TITLE_HEIGHT - 1, SCREEN_WIDTH, 1, AMBER_COLOR); // 横線
+    }
+    drawChromeCell(disp, cache, ChromeCache::TitleLabel, modeName);
     constexpr int BATTERY_STR_SIZE = 16;
     std::array<char, BATTERY_STR_SIZE> batteryStr{};
-    snprintf(batteryStr.data(), batteryStr.size(), "%s %d%%", isCharging ? "CHG" : "BAT", batteryLevel);
-    disp->drawText(SCREEN_WIDTH - BATTERY_OFFSET_X, TITLE_OFFSET_Y, static_cast<const char*>(batteryStr.data()), FONT_AUXILIARY);
+    if (batteryLevel < 0) {
+        snprintf(batteryStr.data(), batteryStr.size(), "%s --%%", isCharging ? "CHG" : "BAT");
+    } else {
+        snprintf(batteryStr.data(), batteryStr.size(), "%s %d%%", isCharging ? "CHG" : "BAT", batteryLevel);
+    }
+    // セル背景の塗り直しで、桁数が減ったときの残り文字も消える
+    drawChromeCell(disp, cache, ChromeCache::Battery, batteryStr.data());
 }
 
 void drawButtonHintsGrid(IDisplay* disp, const char* btnA, const char* btnB, const char* btnC) {
-    disp->fillRect(0, SCREEN_HEIGHT - HINT_HEIGHT, SCREEN_WIDTH, 1, AMBER_COLOR); // 横線
-    disp->setTextFont(FONT_AUXILIARY);
-    disp->setTextColor(AMBER_COLOR, TFT_BLACK);
-    disp->setTextDatum(TL_DATUM);
-    if (btnA != nullptr) {
-        disp->drawText(BUTTON_A_OFFSET_X, SCREEN_HEIGHT - HINT_HEIGHT + HINT_OFFSET_Y, btnA, FONT_AUXILIARY);
-    }
-    if (btnB != nullptr) {
-        disp->drawText(SCREEN_WIDTH / 2 - BUTTON_B_OFFSET_X, SCREEN_HEIGHT - HINT_HEIGHT + HINT_OFFSET_Y, btnB, FONT_AUXILIARY);
-    }
-    if (btnC != nullptr) {
-        disp->drawText(SCREEN_WIDTH - BUTTON_C_OFFSET_X, SCREEN_HEIGHT - HINT_HEIGHT + HINT_OFFSET_Y, btnC, FONT_AUXILIARY);
+    ChromeCache* cache = disp->chromeCache();
+    if (cache == nullptr || cache->updateRule(ChromeCache::HintRule)) {
+        disp->fillRect(0, SCREEN_HEIGHT - HINT_HEIGHT, SCREEN_WIDTH, 1, AMBER_COLOR); // 横線
     }
+    // nullptr のヒントは空セル（前画面の文字を消す）
+    drawChromeCell(disp, cache, ChromeCache::HintA, btnA);
+    drawChromeCell(disp, cache, ChromeCache::HintB, btnB);
+    drawChromeCell(disp, cache, ChromeCache::HintC, btnC);
 }
 
 void drawGridLines(IDisplay* disp) {
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// EventBus のトピック（value の意味はトピック毎）
+enum class EventTopic : uint8_t {
+    AlarmAdded,        // value: alarm time (time_t), 0 when not known
+    AlarmRemoved,      // value: alarm time (time_t), 0 when several/unknown
+    AlarmFired,        // value: number of alarms that elapsed
+    TimeChanged,       // value: wall clock step in seconds (new - old)
+    SettingsChanged,   // value: SettingsItem
+    SyncStatusChanged, // value: TimeSyncLogic::Status
+    kCount
+};
+
+struct BusEvent {
+    EventTopic topic;
+    int64_t value;
+};
+
+/**
+ * Statically allocated publish/subscribe bus between logic modules
+ * (doc/design/event_notification_design.md: command/event-driven side effects).
+ * Each subscriber owns a bounded ring; publish() copies the event into the ring of every
+ * subscriber of the topic. A full ring drops its oldest event (the newest state wins) and the
+ * drop is counted against the dropped event's topic. No allocation, loop context only
+ * (publish and poll from the main loop; not ISR/thread safe).
+ */
+class EventBus {
+public:
+    typedef uint8_t SubscriberId;
+    static constexpr size_t kMaxSubscribers = 8;
+    static constexpr size_t kQueueDepth = 8;
+    static constexpr SubscriberId kNoSubscriber = 0xFF;
+    static constexpr size_t kTopicCount = static_cast<size_t>(EventTopic::kCount);
+
+    static constexpr uint16_t mask(EventTopic topic) {
+        return static_cast<uint16_t>(1u << static_cast<uint8_t>(topic));
+    }
+
+    struct TopicStats {
+        uint32_t published; // publish() calls
+        uint32_t delivered; // copies queued (one per subscriber)
+        uint32_t dropped;   // queued copies overwritten before poll()
+    };
+
+    EventBus() : subscriberCount_(0) {
+        for (size_t i = 0; i < kMaxSubscribers; ++i) subscribers_[i] = Subscriber();
+        resetStats();
+    }
+
+    // kNoSubscriber when the table is full
+    SubscriberId subscribe(uint16_t topicMask) {
+        if (subscriberCount_ >= kMaxSubscribers) return kNoSubscriber;
+        subscribers_[subscriberCount_].topics = topicMask;
+        return static_cast<SubscriberId>(subscriberCount_++);
+    }
+
+    void publish(EventTopic topic, int64_t value = 0) {
+        const size_t t = static_cast<size_t>(topic);
+        if (t >= kTopicCount) return;
+        ++stats_[t].published;
+        const uint16_t bit = mask(topic);
+        for (size_t i = 0; i < subscriberCount_; ++i) {
+            Subscriber& s = subscribers_[i];
+            if ((s.topics & bit) == 0) continue;
+            if (s.count == kQueueDepth) {
+                // 最古を捨てて最新を残す
+                ++stats_[static_cast<size_t>(s.ring[s.head].topic)].dropped;
+                s.head = static_cast<uint8_t>((s.head + 1) % kQueueDepth);
+                --s.count;
+            }
+            s.ring[(s.head + s.count) % kQueueDepth] = BusEvent{ topic, value };
+            ++s.count;
+            ++stats_[t].delivered;
+        }
+    }
+
+    // Oldest pending event of the subscriber; false when none
+    bool poll(SubscriberId id, BusEvent& out) {
+        if (id >= subscriberCount_) return false;
+        Subscriber& s = subscribers_[id];
+        if (s.count == 0) return false;
+        out = s.ring[s.head];
+        s.head = static_cast<uint8_t>((s.head + 1) % kQueueDepth);
+        --s.count;
+        return true;
+    }
+
+    size_t pending(SubscriberId id) const { return id < subscriberCount_ ? subscribers_[id].count : 0; }
+
+    // Discard everything queued for the subscriber (e.g. stale events on screen entry)
+    void drain(SubscriberId id) {
+        if (id >= subscriberCount_) return;
+        subscribers_[id].head = 0;
+        subscribers_[id].count = 0;
+    }
+
+    const TopicStats& stats(EventTopic topic) const { return stats_[static_cast<size_t>(topic)]; }
+    uint32_t totalDropped() const {
+        uint32_t n = 0;
+        for (size_t i = 0; i < kTopicCount; ++i) n += stats_[i].dropped;
+        return n;
+    }
+    void resetStats() {
+        for (size_t i = 0; i < kTopicCount; ++i) stats_[i] = TopicStats{ 0, 0, 0 };
+    }
+
+    static const char* topicName(EventTopic topic) {
+        switch (topic) {
+        case EventTopic::AlarmAdded: return "alarm_added";
+        case EventTopic::AlarmRemoved: return "alarm_removed";
+        case EventTopic::AlarmFired: return "alarm_fired";
+        case EventTopic::TimeChanged: return "time_changed";
+        case EventTopic::SettingsChanged: return "settings_changed";
+        case EventTopic::SyncStatusChanged: return "sync_status";
+        default: return "?";
+        }
+    }
+
+private:
+    struct Subscriber {
+        Subscriber() : topics(0), head(0), count(0) {}
+        uint16_t topics;
+        uint8_t head;
+        uint8_t count;
+        BusEvent ring[kQueueDepth];
+    };
+
+    Subscriber subscribers_[kMaxSubscribers];
+    size_t subscriberCount_;
+    TopicStats stats_[kTopicCount];
+};
@@ -0,0 +1,31 @@
+#include "FrameArena.h"
+
+#include <new>
+
+#ifndef FRAME_ARENA_BYTES
+#define FRAME_ARENA_BYTES 2048
+#endif
+
+void* FrameArena::allocate(size_t bytes, size_t align) {
+    const uintptr_t top = reinterpret_cast<uintptr_t>(base_) + used_;
+    const uintptr_t aligned = (top + (align - 1)) & ~static_cast<uintptr_t>(align - 1);
+    const size_t end = static_cast<size_t>(aligned - reinterpret_cast<uintptr_t>(base_)) + bytes;
+    if (end > capacity_) {
+        // 容量不足: ヒープへ逃がす（highWater で容量を見直す）
+        ++overflows_;
+        return ::operator new(bytes);
+    }
+    used_ = end;
+    if (used_ > highWater_) highWater_ = used_;
+    return reinterpret_cast<void*>(aligned);
+}
+
+void FrameArena::deallocate(void* p) {
+    if (p != nullptr && !owns(p)) ::operator delete(p);
+}
+
+FrameArena& frameArena() {
+    alignas(std::max_align_t) static unsigned char block[FRAME_ARENA_BYTES];
+    static FrameArena arena(block, sizeof(block));
+    return arena;
+}
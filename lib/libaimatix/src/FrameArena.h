@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * Bump allocator for transient per-frame data (preview text, alarm string lists, ...).
+ * allocate() only advances an offset inside one preallocated block and reset() at the
+ * frame boundary releases everything at once. The high-water mark tells how large the
+ * block has to be; when it is exhausted the request falls back to the heap (counted in
+ * overflows(), and visible to AllocationStats), so an undersized block is never fatal.
+ * Not thread-safe: use from the loop task only.
+ */
+class FrameArena {
+public:
+    FrameArena(void* block, size_t capacity)
+        : base_(static_cast<unsigned char*>(block)), capacity_(capacity), used_(0), highWater_(0), overflows_(0) {}
+
+    void* allocate(size_t bytes, size_t align);
+    // Arena memory is released by reset(); only heap fallbacks are freed here
+    void deallocate(void* p);
+
+    // Frame boundary: everything allocated since the last reset must be dead by now
+    void reset() { used_ = 0; }
+
+    bool owns(const void* p) const {
+        const unsigned char* c = static_cast<const unsigned char*>(p);
+        return c >= base_ && c < base_ + capacity_;
+    }
+
+    size_t capacity() const { return capacity_; }
+    size_t used() const { return used_; }
+    size_t highWater() const { return highWater_; }
+    uint32_t overflows() const { return overflows_; }
+    void resetStats() { highWater_ = used_; overflows_ = 0; }
+
+private:
+    unsigned char* base_;
+    size_t capacity_;
+    size_t used_;
+    size_t highWater_;
+    uint32_t overflows_;
+};
+
+// The per-frame arena (FRAME_ARENA_BYTES, default 2KB). loop() resets it every frame.
+FrameArena& frameArena();
+
+/**
+ * Standard allocator over frameArena(). Stateless, so arena-backed containers are
+ * default constructible; they must not outlive the frame that created them.
+ */
+template <class T>
+struct FrameAllocator {
+    typedef T value_type;
+
+    FrameAllocator() {}
+    template <class U>
+    FrameAllocator(const FrameAllocator<U>&) {}
+
+    T* allocate(size_t n) { return static_cast<T*>(frameArena().allocate(n * sizeof(T), alignof(T))); }
+    void deallocate(T* p, size_t) { frameArena().deallocate(p); }
+};
+
+template <class T, class U>
+bool operator==(const FrameAllocator<T>&, const FrameAllocator<U>&) { return true; }
+template <class T, class U>
+bool operator!=(const FrameAllocator<T>&, const FrameAllocator<U>&) { return false; }
+
+typedef std::basic_string<char, std::char_traits<char>, FrameAllocator<char> > FrameString;
+template <class T>
+using FrameVector = std::vector<T, FrameAllocator<T> >;
+typedef FrameVector<FrameString> FrameStringList;
@@ -5,6 +5,8 @@
 // Pure logic frame clock planner.
 // Computes the next integer millisecond delay per frame to approximate a
 // given frame interval in microseconds under a tick rate (e.g., 1000 Hz).
+// Idle pacing skips whole frames (nextDelayMs(frames)), so a lower rate stays on the
+// same frame grid and returning to the full rate keeps the phase.
 // FreeRTOS/Arduino independent.
 class FrameClockPlanner {
 public:
@@ -17,14 +19,26 @@ public:
 	}
 
 	// Returns the next delay in integer milliseconds per frame.
-	uint32_t nextDelayMs() {
-		accumulatedUs_ += static_cast<uint64_t>(frameIntervalUs_);
+	uint32_t nextDelayMs() { return nextDelayMs(1); }
+
+	// Delay covering `frames` frame intervals at once (same grid as calling nextDelayMs() repeatedly)
+	uint32_t nextDelayMs(uint32_t frames) {
+		accumulatedUs_ += static_cast<uint64_t>(frameIntervalUs_) * frames;
 		const uint64_t totalMs = accumulatedUs_ / 1000ULL; // floor
 		const uint32_t stepMs = static_cast<uint32_t>(totalMs - emittedMsTotal_);
 		emittedMsTotal_ = totalMs;
 		return stepMs;
 	}
 
+	// Smallest number of frames (>= 1) whose delay is at least minDelayMs
+	uint32_t framesToCover(uint32_t minDelayMs) const {
+		if (frameIntervalUs_ == 0) return 1;
+		const uint64_t targetUs = (emittedMsTotal_ + minDelayMs) * 1000ULL;
+		if (targetUs <= accumulatedUs_ + frameIntervalUs_) return 1;
+		const uint64_t needUs = targetUs - accumulatedUs_;
+		return static_cast<uint32_t>((needUs + frameIntervalUs_ - 1) / frameIntervalUs_);
+	}
+
 private:
 	uint32_t frameIntervalUs_;
 	uint32_t tickRateHz_;
@@ -0,0 +1,77 @@
+#pragma once
+#include <ctime>
+#include <cstdint>
+#include "ITimeService.h"
+#include "TimeThreadSafe.h"
+
+/**
+ * 1 フレーム（loop の 1 回）分の時刻スナップショット。loop の先頭で一度だけ capture() し、
+ * ボタン処理と onDraw に同じ値を渡す。画面内で時刻を何度も取り直さないので、
+ * 秒/分の境界をまたいで表示や計算が食い違わない。ホストテストは値を詰めて時刻を注入できる。
+ */
+struct FrameContext {
+    time_t now;       // 壁時計（秒）
+    int64_t nowUs;    // 壁時計（µs）
+    int64_t monoUs;   // 単調時計（µs、時刻源が無ければ 0）
+    struct tm local;  // now のローカル時刻
+    bool localValid;
+
+    // clock が nullptr なら libc の time()/localtime（従来の画面と同じ）
+    static FrameContext capture(const ITimeService* clock) {
+        FrameContext frame;
+        if (clock != nullptr) {
+            frame.nowUs = clock->nowMicros();
+            frame.now = static_cast<time_t>(frame.nowUs / 1000000);
+            frame.monoUs = clock->monotonicMicros();
+            time_t t = frame.now;
+            const struct tm* tm = clock->localtime(&t);
+            frame.localValid = tm != nullptr;
+            if (tm != nullptr) frame.local = *tm;
+        } else {
+            frame.now = time(nullptr);
+            frame.nowUs = static_cast<int64_t>(frame.now) * 1000000;
+            frame.monoUs = 0;
+            frame.localValid = TimeThreadSafe::toLocalTime(frame.now, frame.local);
+        }
+        return frame;
+    }
+
+    // 決定的な時刻（テスト等）: ローカル時刻は libc のタイムゾーンで求める
+    static FrameContext at(time_t now, int64_t monoUs = 0) {
+        FrameContext frame;
+        frame.now = now;
+        frame.nowUs = static_cast<int64_t>(now) * 1000000;
+        frame.monoUs = monoUs;
+        frame.localValid = TimeThreadSafe::toLocalTime(now, frame.local);
+        return frame;
+    }
+};
+
+/**
+ * フレームに固定した ITimeService。時刻を ITimeService から取る既存ロジック（プレビュー等）に
+ * 渡すと、そのフレームの now/ローカル時刻を返す。それ以外の時刻の変換と設定系は inner に委譲する。
+ */
+class FrameTimeService : public ITimeService {
+public:
+    FrameTimeService(const FrameContext& frame, ITimeService* inner) : frame_(frame), inner_(inner), buf_() {}
+
+    time_t now() const override { return frame_.now; }
+    int64_t nowMicros() const override { return frame_.nowUs; }
+    struct tm* localtime(time_t* time) const override {
+        if (time != nullptr && *time == frame_.now && frame_.localValid) {
+            buf_ = frame_.local;
+            return &buf_;
+        }
+        if (inner_ != nullptr) return inner_->localtime(time);
+        if (time == nullptr || !TimeThreadSafe::toLocalTime(*time, buf_)) return nullptr;
+        return &buf_;
+    }
+    bool setSystemTime(time_t time) override { return inner_ != nullptr && inner_->setSystemTime(time); }
+    uint32_t monotonicMillis() const override { return static_cast<uint32_t>(frame_.monoUs / 1000); }
+    int64_t monotonicMicros() const override { return frame_.monoUs; }
+
+private:
+    const FrameContext& frame_;
+    ITimeService* inner_;
+    mutable struct tm buf_;
+};
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstdint>
+
+// Pure logic frame profiler: smoothed busy ratio of the UI loop.
+// busyUs is the time spent working in one frame, periodUs the wall time from
+// that frame's start to the next one (work + sleep). The ratio is an exponential
+// moving average (1/4 weight) in permille. FreeRTOS/Arduino independent.
+class FrameLoadMeter {
+public:
+	FrameLoadMeter() : busyPermille_(0), peakBusyUs_(0), frames_(0) {}
+
+	void addFrame(uint32_t busyUs, uint32_t periodUs) {
+		if (periodUs == 0) return;
+		if (busyUs > periodUs) busyUs = periodUs;
+		const uint32_t sample = static_cast<uint32_t>((static_cast<uint64_t>(busyUs) * 1000u) / periodUs);
+		// 初回はそのまま採用（起動直後の立ち上がり遅れを避ける）
+		busyPermille_ = (frames_ == 0) ? sample : (busyPermille_ * 3u + sample + 2u) / 4u;
+		if (busyUs > peakBusyUs_) peakBusyUs_ = busyUs;
+		++frames_;
+	}
+
+	uint32_t busyPermille() const { return busyPermille_; }
+	uint32_t peakBusyUs() const { return peakBusyUs_; }
+	uint32_t frames() const { return frames_; }
+
+private:
+	uint32_t busyPermille_;
+	uint32_t peakBusyUs_;
+	uint32_t frames_;
+};
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+
+// Pure logic frame pacing policy (used with FrameClockPlanner).
+// Chooses how often the UI needs to be drawn:
+// - Full:    every base frame (input, screen transitions, running actuator patterns)
+// - Seconds: once per wall-clock second (idle main screen with a running countdown)
+// - Minutes: once per wall-clock minute (idle main screen showing HH:MM only)
+// Idle rates start kActiveHoldMs after the last activity, so menus and long presses
+// keep the full rate. FreeRTOS/Arduino independent.
+class FramePacingPolicy {
+public:
+	enum class Rate : uint8_t { Full, Seconds, Minutes };
+
+	struct Activity {
+		bool input;           // button edge or a button still held this frame
+		bool busy;            // non-idle screen, alert or actuator pattern running
+		bool secondsVisible;  // the screen shows a seconds field (countdown)
+	};
+
+	static constexpr uint32_t kActiveHoldMs = 5000;
+
+	FramePacingPolicy() : lastActiveMs_(0), everActive_(false) {}
+
+	Rate select(uint32_t nowMs, const Activity& activity) {
+		if (activity.input || activity.busy || !everActive_) {
+			lastActiveMs_ = nowMs;
+			everActive_ = true;
+			return Rate::Full;
+		}
+		if (nowMs - lastActiveMs_ < kActiveHoldMs) return Rate::Full;
+		return activity.secondsVisible ? Rate::Seconds : Rate::Minutes;
+	}
+
+	// Milliseconds from wallMsOfMinute (0-59999) to the next boundary the rate draws at.
+	// Full returns 0 (next base frame). Local time offsets are whole minutes, so UTC
+	// boundaries are also local ones.
+	static uint32_t msUntilBoundary(Rate rate, uint32_t wallMsOfMinute) {
+		switch (rate) {
+			case Rate::Seconds: return 1000u - (wallMsOfMinute % 1000u);
+			case Rate::Minutes: return 60000u - (wallMsOfMinute % 60000u);
+			default: return 0;
+		}
+	}
+
+private:
+	uint32_t lastActiveMs_;
+	bool everActive_;
+};
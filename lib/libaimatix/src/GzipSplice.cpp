@@ -0,0 +1,99 @@
+#include "GzipSplice.h"
+
+namespace {
+
+constexpr uint32_t kCrc32Poly = 0xEDB88320u; // reflected IEEE 802.3
+
+uint32_t gf2MatrixTimes(const uint32_t* mat, uint32_t vec) {
+    uint32_t sum = 0;
+    while (vec != 0) {
+        if ((vec & 1u) != 0) sum ^= *mat;
+        vec >>= 1;
+        ++mat;
+    }
+    return sum;
+}
+
+void gf2MatrixSquare(uint32_t* square, const uint32_t* mat) {
+    for (int n = 0; n < 32; ++n) {
+        square[n] = gf2MatrixTimes(mat, mat[n]);
+    }
+}
+
+void putLe32(uint32_t v, uint8_t* out) {
+    out[0] = static_cast<uint8_t>(v);
+    out[1] = static_cast<uint8_t>(v >> 8);
+    out[2] = static_cast<uint8_t>(v >> 16);
+    out[3] = static_cast<uint8_t>(v >> 24);
+}
+
+} // namespace
+
+namespace GzipSplice {
+
+uint32_t crc32Update(uint32_t crc, const uint8_t* data, size_t len) {
+    // Bitwise variant: inserts are a few dozen bytes, so no 1KB table in RAM/flash
+    crc = ~crc;
+    for (size_t i = 0; i < len; ++i) {
+        crc ^= data[i];
+        for (int k = 0; k < 8; ++k) {
+            crc = (crc >> 1) ^ (kCrc32Poly & (0u - (crc & 1u)));
+        }
+    }
+    return ~crc;
+}
+
+uint32_t crc32Combine(uint32_t crcA, uint32_t crcB, uint32_t lenB) {
+    // Port of zlib's crc32_combine: apply lenB zero bytes to crcA via GF(2) matrices
+    if (lenB == 0) return crcA;
+    uint32_t even[32];
+    uint32_t odd[32];
+
+    odd[0] = kCrc32Poly; // operator for one zero bit
+    uint32_t row = 1;
+    for (int n = 1; n < 32; ++n) {
+        odd[n] = row;
+        row <<= 1;
+    }
+    gf2MatrixSquare(even, odd); // two zero bits
+    gf2MatrixSquare(odd, even); // four zero bits
+
+    do {
+        gf2MatrixSquare(even, odd);
+        if ((lenB & 1u) != 0) crcA = gf2MatrixTimes(even, crcA);
+        lenB >>= 1;
+        if (lenB == 0) break;
+        gf2MatrixSquare(odd, even);
+        if ((lenB & 1u) != 0) crcA = gf2MatrixTimes(odd, crcA);
+        lenB >>= 1;
+    } while (lenB != 0);
+    return crcA ^ crcB;
+}
+
+void writeStoredBlockHeader(uint16_t len, uint8_t out[kStoredBlockHeaderLen]) {
+    const uint16_t nlen = static_cast<uint16_t>(~len);
+    out[0] = 0x00; // BFINAL=0, BTYPE=00 (stored), rest of the byte is padding
+    out[1] = static_cast<uint8_t>(len);
+    out[2] = static_cast<uint8_t>(len >> 8);
+    out[3] = static_cast<uint8_t>(nlen);
+    out[4] = static_cast<uint8_t>(nlen >> 8);
+}
+
+void writeTrailer(uint32_t crc, uint32_t isize, uint8_t out[kTrailerLen]) {
+    putLe32(crc, out);
+    putLe32(isize, out + 4);
+}
+
+bool buildFrame(const SplicedAsset& asset, const char* insert, size_t insertLen, SpliceFrame& out) {
+    if (insert == nullptr || insertLen > 0xFFFFu) return false;
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(insert);
+    uint32_t crc = crc32Update(asset.prefixCrc, bytes, insertLen);
+    crc = crc32Combine(crc, asset.suffixCrc, asset.suffixLen);
+    const uint32_t isize = asset.prefixLen + static_cast<uint32_t>(insertLen) + asset.suffixLen;
+    writeStoredBlockHeader(static_cast<uint16_t>(insertLen), out.storedHeader);
+    writeTrailer(crc, isize, out.trailer);
+    out.contentLength = asset.headLen + kStoredBlockHeaderLen + insertLen + asset.tailLen + kTrailerLen;
+    return true;
+}
+
+}
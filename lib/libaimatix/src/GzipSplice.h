@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Pure helpers to splice a small dynamic string into a precompressed gzip asset.
+// Layout produced at build time (scripts/embed_web_assets.py):
+//   head = gzip header + deflate(prefix) ending in a byte-aligned non-final block
+//   tail = deflate(suffix) ending in the final block
+// At runtime the response is: head | storedBlockHeader | insert | tail | trailer.
+// CRC32 follows zlib semantics (finalized values can be chained/combined).
+namespace GzipSplice {
+
+constexpr size_t kStoredBlockHeaderLen = 5;
+constexpr size_t kTrailerLen = 8;
+
+// Precompressed asset with one splice point (all data is flash resident)
+struct SplicedAsset {
+    const uint8_t* head;
+    size_t headLen;
+    const uint8_t* tail;
+    size_t tailLen;
+    uint32_t prefixCrc;   // crc32 of the uncompressed prefix
+    uint32_t prefixLen;
+    uint32_t suffixCrc;   // crc32 of the uncompressed suffix
+    uint32_t suffixLen;
+    const char* etag;     // content hash of the source page (quoted by caller)
+};
+
+// Per-request framing bytes (fixed size, stack allocated)
+struct SpliceFrame {
+    uint8_t storedHeader[kStoredBlockHeaderLen];
+    uint8_t trailer[kTrailerLen];
+    size_t contentLength;  // total gzip body length
+};
+
+// crc32 continuation (zlib compatible): crc32Update(0, data, len) == crc32(data)
+uint32_t crc32Update(uint32_t crc, const uint8_t* data, size_t len);
+
+// crc32 of A||B from crc(A), crc(B) and len(B) (zlib crc32_combine)
+uint32_t crc32Combine(uint32_t crcA, uint32_t crcB, uint32_t lenB);
+
+// Non-final stored deflate block header for len raw bytes (caller is byte aligned)
+void writeStoredBlockHeader(uint16_t len, uint8_t out[kStoredBlockHeaderLen]);
+
+// gzip member trailer: CRC32 and ISIZE, little endian
+void writeTrailer(uint32_t crc, uint32_t isize, uint8_t out[kTrailerLen]);
+
+// Compute framing for splicing insert[0..insertLen) into asset. Returns false if too long.
+bool buildFrame(const SplicedAsset& asset, const char* insert, size_t insertLen, SpliceFrame& out);
+
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdint>
+#include "BacklightEngine.h"
+#include "VibrationSequencer.h"
+
+/**
+ * Plays backlight patterns on its own clock (a hardware timer on device), so
+ * states only start/stop animations and never tick them.
+ */
+class IBacklightAnimator {
+public:
+	virtual ~IBacklightAnimator() = default;
+	// pattern must outlive playback (patterns are static const tables)
+	virtual void play(const BacklightPattern& pattern) = 0;
+	// Backlight + haptics on one time origin (phase-aligned). Default: backlight only.
+	virtual void playAlert(const BacklightPattern& pattern, const HapticPattern& haptics) {
+		(void)haptics;
+		play(pattern);
+	}
+	// Synchronous: once it returns the animator no longer writes the backlight
+	// (an alert's haptics stop too)
+	virtual void stop() = 0;
+	virtual bool isActive() const = 0;
+	// Last PWM value written (0-255)
+	virtual uint8_t getLastBrightness() const = 0;
+};
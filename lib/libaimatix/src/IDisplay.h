@@ -1,5 +1,6 @@
 #pragma once
 #include <cstdint>
+class ChromeCache;
 class IDisplay {
 public:
     virtual ~IDisplay() {}
@@ -20,5 +21,21 @@ public:
     virtual void fillProgressBarSprite(int x, int y, int w, int h, int percent) = 0;
     virtual void drawLine(int x0, int y0, int x1, int y1, uint16_t color) = 0;
     virtual int getTextDatum() const = 0;
+    // Static chrome (title bar / hints) currently on the panel. nullptr: not tracked, the chrome
+    // is redrawn in full every time.
+    virtual ChromeCache* chromeCache() { return nullptr; }
+    // Screen transition: clear between the title bar and the hints and keep the chrome, which the
+    // entering screen diffs against through its ChromeCache. Default: full clear.
+    virtual void clearBody() { clear(); }
+    // One chrome text cell: background (x, y, w, h) and text at (textX, textY), top-left datum.
+    // Devices may pre-render each distinct cell once and blit it. Default: fill + drawText.
+    virtual void drawTextCell(int x, int y, int w, int h, int textX, int textY, const char* text, int font,
+                              uint16_t color, uint16_t bgColor) {
+        fillRect(x, y, w, h, bgColor);
+        setTextFont(font);
+        setTextColor(color, bgColor);
+        setTextDatum(0);
+        if (text != nullptr && text[0] != '\0') drawText(textX, textY, text, font);
+    }
     // 必要に応じて追加
 }; 
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 #include <vector>
 #include <string>
+#include "FrameArena.h"
 class IMainDisplayView {
 public:
     virtual ~IMainDisplayView() {}
@@ -8,7 +9,8 @@ public:
     virtual void showTime(const char* currentTime) = 0;
     virtual void showRemain(const char* remainTime) = 0;
     virtual void showProgress(int percent) = 0;
-    virtual void showAlarmList(const std::vector<std::string>& alarmStrs) = 0;
+    // alarmStrs はフレームアリーナ上の一時リスト（保持する場合はコピーする）
+    virtual void showAlarmList(const FrameStringList& alarmStrs) = 0;
     virtual void showHints(const char* btnA, const char* btnB, const char* btnC) = 0;
     virtual void clear() = 0;
 }; 
\ No newline at end of file
@@ -0,0 +1,40 @@
+#pragma once
+#include <cstdint>
+
+// Battery state as shown in the title bar (cached; reading it never touches the PMIC)
+struct BatteryStatus {
+    int percent;         // 0-100, -1 = unknown (no sample yet / no telemetry)
+    bool charging;
+    uint16_t millivolts; // smoothed, 0 = unknown
+};
+
+// Cached power telemetry. generation() changes only when the displayed
+// percent or the charging state changes, so screens can redraw on demand.
+class IPowerTelemetry {
+public:
+    virtual ~IPowerTelemetry() {}
+    virtual BatteryStatus batteryStatus() const = 0;
+    virtual uint32_t generation() const = 0;
+};
+
+// Per-screen helper: remembers which telemetry generation the title bar shows.
+class TitleBatteryIndicator {
+public:
+    TitleBatteryIndicator() : source_(nullptr), drawnGeneration_(0) {}
+
+    void setSource(const IPowerTelemetry* source) { source_ = source; }
+
+    // Status to draw now; marks it as drawn
+    BatteryStatus take() {
+        if (source_ == nullptr) return BatteryStatus{ -1, false, 0 };
+        drawnGeneration_ = source_->generation();
+        return source_->batteryStatus();
+    }
+
+    // True when the title bar shows an outdated percent/charging state
+    bool changed() const { return source_ != nullptr && source_->generation() != drawnGeneration_; }
+
+private:
+    const IPowerTelemetry* source_;
+    uint32_t drawnGeneration_;
+};
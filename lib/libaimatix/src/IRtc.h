@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Battery-backed real-time clock (e.g. BM8563 on Fire/Core2).
+ * Date/time fields are UTC calendar values (month 1-12, day 1-31).
+ */
+struct RtcDateTime {
+	int year;
+	int month;
+	int day;
+	int hour;
+	int minute;
+	int second;
+};
+
+class IRtc {
+public:
+	virtual ~IRtc() = default;
+	// false if the RTC is absent or the bus read failed.
+	// integrityLost: oscillator stopped / backup voltage dropped since the last write.
+	virtual bool read(RtcDateTime& out, bool& integrityLost) = 0;
+	virtual bool write(const RtcDateTime& value) = 0;
+	// Last applied timezone (IANA name + UTC offset fallback), kept next to the RTC (NVS on device).
+	// name is NUL-terminated on success (empty when only an offset is known).
+	virtual bool loadTimeZone(char* name, size_t cap, int& offsetMinutes) = 0;
+	virtual void saveTimeZone(const char* name, size_t nameLen, int offsetMinutes) = 0;
+};
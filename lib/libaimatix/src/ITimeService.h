@@ -1,10 +1,13 @@
 #pragma once
 #include <ctime>
 #include <cstdint>
+#include <cstddef>
 
 // Unified time service interface
 // - Wall clock time (seconds) via now()/localtime()/setSystemTime()
-// - Monotonic milliseconds via monotonicMillis() for sub-second operations
+// - Monotonic 64-bit microseconds via monotonicMicros() for sub-second operations
+//   (monotonicMillis() is the 32-bit millis() view; it wraps after ~49.7 days)
+// - Optional clock discipline via applySyncedTime()/disciplineTick()
 class ITimeService {
 public:
     virtual ~ITimeService() {}
@@ -12,10 +15,33 @@ public:
     // Wall clock (may jump forward/back by user/NTP corrections)
     virtual time_t now() const = 0;
     virtual struct tm* localtime(time_t* time) const = 0;
+    // Wall clock in epoch microseconds. Default: whole seconds from now().
+    virtual int64_t nowMicros() const { return static_cast<int64_t>(now()) * 1000000; }
     virtual bool setSystemTime(time_t time) = 0;
+    // Sub-second set (epoch microseconds). Default truncates to whole seconds.
+    virtual bool setSystemTimeMicros(int64_t epochUs) {
+        return setSystemTime(static_cast<time_t>(epochUs / 1000000));
+    }
 
-    // Monotonic milliseconds for animations, debouncing, schedulers
+    // Clock discipline (drift tracking across syncs + slew). Defaults: plain step, no model.
+    // Apply a synced time; implementations may slew small offsets instead of stepping.
+    virtual bool applySyncedTime(int64_t epochUs) { return setSystemTimeMicros(epochUs); }
+    // Estimated oscillator error in ppb (positive = fast)
+    virtual int32_t driftPpb() const { return 0; }
+    // Called once per frame to feed drift compensation/slew into the clock
+    virtual void disciplineTick() {}
+    // Local timezone from Time Sync: IANA name (DST-aware rules) with a fixed UTC offset fallback.
+    // ianaName may be empty. RTC-backed services persist it for the next boot.
+    virtual void applyTimeZone(const char* ianaName, size_t nameLen, int offsetMinutes) {
+        (void)ianaName; (void)nameLen; (void)offsetMinutes;
+    }
+
+    // Monotonic milliseconds, 32-bit (wraps): only for wrap-safe differences (actuator timeline)
     virtual uint32_t monotonicMillis() const = 0;
+    // Monotonic microseconds (64-bit, never wraps or steps with the wall clock): alarm deadlines,
+    // button timing, Time Sync window, UI pauses. Device: esp_timer_get_time; host tests:
+    // test/mock/MockVirtualClock.h. The default widens monotonicMillis() (wraps with it).
+    virtual int64_t monotonicMicros() const { return static_cast<int64_t>(monotonicMillis()) * 1000; }
 };
 
 
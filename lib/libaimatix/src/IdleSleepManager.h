@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstdint>
+#include "BacklightEngine.h"
+#include "LogicTick.h"
+
+// Idle-timeout display sleep (spec 2.5.1 / 2.5.2).
+// Awake → (timeout without input) Dimmed → (kDimMs) Asleep. While asleep the caller stops
+// rendering and puts the panel to sleep; any button wakes it and the previous screen is shown
+// again from what the panel still holds (no redraw). The waking press is swallowed, so it never
+// acts on a screen the user could not see. holdAwake (countdown running, alarm ringing, ...)
+// counts as activity and also wakes a sleeping display, so alarm expiry is always rendered.
+// Pure logic: millis in, actions out (wrap-safe).
+class IdleSleepManager {
+public:
+	enum class Phase : uint8_t { Awake, Dimmed, Asleep };
+	enum class Action : uint8_t {
+		None,
+		Dim,   // start dimPattern()
+		Sleep, // backlight off, panel sleep, stop rendering
+		Undim, // restore the brightness (panel was still on)
+		Wake   // panel wake-up, restore the brightness, resume rendering
+	};
+
+	static constexpr uint32_t kDefaultTimeoutMs = 5u * 60u * 1000u;
+	static constexpr uint32_t kMinTimeoutMs = 1u * 60u * 1000u;
+	static constexpr uint32_t kMaxTimeoutMs = 30u * 60u * 1000u;
+	// Dimmed warning before the panel goes to sleep (a press here only restores the brightness)
+	static constexpr uint32_t kDimMs = 10000;
+	static constexpr uint16_t kDimFadeMs = 500;
+
+	IdleSleepManager() : timeoutMs_(kDefaultTimeoutMs), lastActiveMs_(0), dimStartMs_(0),
+		phase_(Phase::Awake), swallow_(0) {}
+
+	// Clamped to the spec range (1-30 min)
+	void setTimeoutMs(uint32_t ms) {
+		timeoutMs_ = ms < kMinTimeoutMs ? kMinTimeoutMs : (ms > kMaxTimeoutMs ? kMaxTimeoutMs : ms);
+	}
+	uint32_t timeoutMs() const { return timeoutMs_; }
+
+	// One batch of button events: restarts the idle timer and removes the events of a press
+	// that woke the display (down, then its short/long press) before they are dispatched.
+	Action onButtonEvents(uint32_t nowMs, ButtonEvents& events) {
+		if (!events.any()) return Action::None;
+		lastActiveMs_ = nowMs;
+		Action action = Action::None;
+		if (phase_ == Phase::Asleep) {
+			swallow_ |= events.pressDown;
+			action = Action::Wake;
+		} else if (phase_ == Phase::Dimmed) {
+			action = Action::Undim;
+		}
+		phase_ = Phase::Awake;
+		const uint8_t released = static_cast<uint8_t>((events.shortPress | events.longPress) & swallow_);
+		events.pressDown &= static_cast<uint8_t>(~swallow_);
+		events.shortPress &= static_cast<uint8_t>(~swallow_);
+		events.longPress &= static_cast<uint8_t>(~swallow_);
+		swallow_ &= static_cast<uint8_t>(~released); // one short or long press ends each press
+		return action;
+	}
+
+	// Once per frame. holdAwake: something must stay visible (or a button is held).
+	Action update(uint32_t nowMs, bool holdAwake) {
+		if (holdAwake) {
+			lastActiveMs_ = nowMs;
+			const Phase was = phase_;
+			phase_ = Phase::Awake;
+			if (was == Phase::Asleep) return Action::Wake;
+			if (was == Phase::Dimmed) return Action::Undim;
+			return Action::None;
+		}
+		if (phase_ == Phase::Awake && static_cast<int32_t>(nowMs - lastActiveMs_ - timeoutMs_) >= 0) {
+			phase_ = Phase::Dimmed;
+			dimStartMs_ = nowMs;
+			return Action::Dim;
+		}
+		if (phase_ == Phase::Dimmed && static_cast<int32_t>(nowMs - dimStartMs_ - kDimMs) >= 0) {
+			phase_ = Phase::Asleep;
+			return Action::Sleep;
+		}
+		return Action::None;
+	}
+
+	Phase phase() const { return phase_; }
+	bool isRendering() const { return phase_ != Phase::Asleep; }
+
+	// Fade from the current PWM to a quarter of its perceptual level (played by the animator;
+	// the pattern lives in this object, so it stays valid until the next call)
+	const BacklightPattern& dimPattern(uint8_t currentPwm) {
+		const uint8_t level = BacklightEngine::pwmToLevel(currentPwm);
+		dimFrames_[0] = BacklightKeyframe{ 0, level, 0 };
+		dimFrames_[1] = BacklightKeyframe{ kDimFadeMs, static_cast<uint8_t>(level / 4), 1 };
+		dimPattern_ = BacklightPattern{ dimFrames_, 2, static_cast<uint16_t>(kDimFadeMs + 1), 1 };
+		return dimPattern_;
+	}
+
+private:
+	uint32_t timeoutMs_;
+	uint32_t lastActiveMs_;
+	uint32_t dimStartMs_;
+	Phase phase_;
+	uint8_t swallow_; // buttons whose press woke the display (bit = ButtonEvents::bit)
+	BacklightKeyframe dimFrames_[2];
+	BacklightPattern dimPattern_;
+};
@@ -9,27 +9,43 @@
 #include <vector>
 #include <string>
 #include "AlarmLogic.h"
+#include "IPowerTelemetry.h"
+#include "ViewModelDiffer.h"
 #include <cstring>
 
+// 入力画面の 1 フレーム分の表示内容（POD）。桁は 1 桁ずつ差分を取る
+struct InputViewModel {
+    enum Field : uint8_t { Digit0, Digit1, Digit2, Digit3, Preview, Colon, kFieldCount };
+    int digits[4];
+    bool entered[4];
+    char preview[32];
+
+    uint32_t fingerprint(size_t field) const {
+        if (field <= Digit3) {
+            return static_cast<uint32_t>(digits[field] + 1) | (entered[field] ? 0x100u : 0u);
+        }
+        if (field == Preview) return ViewFingerprint::ofString(preview);
+        return 0; // コロンは固定（入場後に 1 回だけ描く）
+    }
+};
+
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 class InputDisplayState : public IState {
 public:
     // InputDisplayStateのコンストラクタ
     InputDisplayState(InputLogic* logic = nullptr, IInputDisplayView* view = nullptr, ITimeService* timeService = nullptr)
         : inputLogic(logic), view(view), timeService_(timeService), manager(nullptr), mainDisplayState(nullptr), isRelativeMode(false),
-          errorMessage(""), showError(false), errorStartTime(0) {
-        for (int i = 0; i < 4; ++i) { lastDigits[i] = -1; lastEntered[i] = false; }
-    }
+          errorMessage(""), showError(false), errorStartTime(0), frame(FrameContext::at(0)) {}
+    void setPowerTelemetry(const IPowerTelemetry* telemetry) { battery.setSource(telemetry); }
     void onEnter() override {
         if (inputLogic) inputLogic->reset();
         if (view) {
             view->clear();
             // 相対値入力モードの場合はタイトルを変更
-            const char* title = isRelativeMode ? "REL+" : "INPUT";
-            view->showTitle(title, 42, false);
+            drawTitle();
             view->showHints("INC", "NEXT", "SET");
-            for (int i = 0; i < 4; ++i) { lastDigits[i] = -1; lastEntered[i] = false; }
         }
+        differ.invalidate();
         // 絶対入力モードでは初期状態を __:_0（分一桁=0, entered=true）にする
         if (inputLogic && !isRelativeMode) {
             inputLogic->incrementInput(0);
@@ -44,9 +60,10 @@ public:
             return;
         }
         
-        time_t relativeTime = inputLogic->getAbsoluteValue();
+        time_t relativeTime = inputLogic->getAbsoluteValueAt(frame);
         if (relativeTime != -1) {
-            auto result = TimePreviewLogic::generateRelativePreview(relativeTime, timeService_);
+            FrameTimeService clock(frame, timeService_);
+            auto result = TimePreviewLogic::generateRelativePreview(relativeTime, &clock);
             if (result.isValid) {
                 strncpy(preview, result.preview.c_str(), previewSize - 1);
                 preview[previewSize - 1] = '\0';
@@ -66,17 +83,31 @@ public:
             return;
         }
         
-        auto result = TimePreviewLogic::generatePreview(digits, entered, timeService_, false);
+        FrameTimeService clock(frame, timeService_);
+        auto result = TimePreviewLogic::generatePreview(digits, entered, &clock, false);
         if (result.isValid) {
             strncpy(preview, result.preview.c_str(), previewSize - 1);
             preview[previewSize - 1] = '\0';
         }
     }
 
-    void onDraw() override {
-        updateDigitDisplay();
-        updatePreviewDisplay();
-        updateColonDisplay();
+    void onDraw() override { onDraw(captureFrame()); }
+    void onDraw(const FrameContext& current) override {
+        frame = current;
+        // 電池表示は表示値が変わったときだけ再描画
+        if (!view) return;
+        if (battery.changed()) drawTitle();
+        InputViewModel model;
+        buildViewModel(model);
+        // 変化したフィールドだけをビューへ
+        const ViewModelDiffer<InputViewModel>::Mask changed = differ.diff(model);
+        for (int i = 0; i < 4; ++i) {
+            if (ViewModelDiffer<InputViewModel>::has(changed, InputViewModel::Digit0 + i) && model.digits[i] >= 0) {
+                view->showDigit(i, model.digits[i], model.entered[i]);
+            }
+        }
+        if (ViewModelDiffer<InputViewModel>::has(changed, InputViewModel::Preview)) view->showPreview(model.preview);
+        if (ViewModelDiffer<InputViewModel>::has(changed, InputViewModel::Colon)) view->showColon();
     }
     
     // Public methods
@@ -105,8 +136,6 @@ private:
     InputLogic* inputLogic;
     IInputDisplayView* view;
     ITimeService* timeService_;
-    int lastDigits[4] = {-1,-1,-1,-1};
-    bool lastEntered[4] = {false,false,false,false};
     StateManager* manager;
     IState* mainDisplayState;
     bool isRelativeMode;
@@ -116,12 +145,25 @@ private:
     bool showError;
     time_t errorStartTime;
     
-    // プレビュー内容の変化チェック用
-    std::string lastPreview;
+    TitleBatteryIndicator battery;
+    ViewModelDiffer<InputViewModel> differ;
+    FrameContext frame; // 処理中のフレームの時刻（入口ごとに差し替え）
+
+    // フレーム時刻を持たない入口（従来の入口）用: 時刻サービスが無ければ libc の時刻
+    FrameContext captureFrame() const {
+        return FrameContext::capture(timeService_);
+    }
+
+    // タイトルバー（相対値入力モードの場合はタイトルを変更）
+    void drawTitle() {
+        const char* title = isRelativeMode ? "REL+" : "INPUT";
+        const BatteryStatus bat = battery.take();
+        view->showTitle(title, bat.percent, bat.charging);
+    }
 
     // 現在時刻を安全に取得
     time_t getCurrentTime() const {
-        return timeService_ ? timeService_->now() : 0;
+        return timeService_ ? frame.now : 0;
     }
     
     // 時刻取得が有効かチェック
@@ -129,60 +171,16 @@ private:
         return timeService_ != nullptr;
     }
 
-    // 数字表示の更新
-    void updateDigitDisplay() {
-        if (!inputLogic || !view) {
-            return;
-        }
-        
-        const int* digits = inputLogic->getDigits();
-        const bool* entered = inputLogic->getEntered();
-        
-        if (hasInputChanged(digits, entered)) {
-            for (int i = 0; i < 4; ++i) {
-                view->showDigit(i, digits[i], entered[i]);
-                lastDigits[i] = digits[i];
-                lastEntered[i] = entered[i];
-            }
-        }
-    }
-    
-    // プレビュー表示の更新
-    void updatePreviewDisplay() {
-        if (!view) {
-            return;
-        }
-        
-        char preview[32] = "";
-        generatePreviewText(preview, sizeof(preview));
-        
-        // プレビュー内容の変化チェック
-        std::string currentPreview(preview);
-        if (currentPreview != lastPreview) {
-            view->showPreview(preview);
-            lastPreview = currentPreview;
-        }
-    }
-    
-    // コロン表示の更新
-    void updateColonDisplay() {
-        if (view) {
-            view->showColon();
-        }
-    }
-    
-    // 入力値の変化をチェック
-    bool hasInputChanged(const int* digits, const bool* entered) {
-        if (!digits || !entered) {
-            return false;
-        }
-        
+    // 今フレームの表示内容（入力ロジックが無い場合、桁は -1 = 描かない）
+    void buildViewModel(InputViewModel& model) {
+        const int* digits = inputLogic ? inputLogic->getDigits() : nullptr;
+        const bool* entered = inputLogic ? inputLogic->getEntered() : nullptr;
         for (int i = 0; i < 4; ++i) {
-            if (digits[i] != lastDigits[i] || entered[i] != lastEntered[i]) {
-                return true;
-            }
+            model.digits[i] = (digits && entered) ? digits[i] : -1;
+            model.entered[i] = (digits && entered) ? entered[i] : false;
         }
-        return false;
+        model.preview[0] = '\0';
+        generatePreviewText(model.preview, sizeof(model.preview));
     }
     
     // プレビューテキスト生成
@@ -264,9 +262,9 @@ private:
     
     // 相対値モードの確定処理
     void handleRelativeModeSubmit(bool& success, bool& error) {
-        time_t relativeTime = inputLogic->getAbsoluteValue();
+        time_t relativeTime = inputLogic->getAbsoluteValueAt(frame);
         if (relativeTime != -1) {
-            success = addAlarmAtTime(relativeTime);
+            success = addAlarmAtTime(relativeTime, AlarmKind::Relative);
             if (!success) {
                 handleErrorWithValidation(ERROR_ADD_ALARM_FAILED, error);
             }
@@ -280,11 +278,10 @@ private:
         const int* digits = inputLogic->getDigits();
         const bool* entered = inputLogic->getEntered();
         if (digits && entered) {
-            time_t now = time(nullptr);
-            extern std::vector<time_t> alarm_times;
+            extern AlarmStore alarm_times;
             AlarmLogic::AddAlarmResult result;
             std::string msg;
-            bool ok = AlarmLogic::addAlarmFromPartialInput(alarm_times, now, digits, entered, result, msg);
+            bool ok = AlarmLogic::addAlarmFromPartialInput(alarm_times, frame.now, digits, entered, result, msg);
             if (ok) {
                 success = true;
             } else {
@@ -294,11 +291,11 @@ private:
     }
     
     // アラーム追加処理
-    bool addAlarmAtTime(time_t time) {
-        extern std::vector<time_t> alarm_times;
+    bool addAlarmAtTime(time_t time, AlarmKind kind) {
+        extern AlarmStore alarm_times;
         AlarmLogic::AddAlarmResult result;
         std::string msg;
-        return AlarmLogic::addAlarmAtTime(alarm_times, time, result, msg);
+        return AlarmLogic::addAlarmAtTime(alarm_times, time, kind, result, msg);
     }
     
     // メイン画面への遷移
@@ -344,23 +341,32 @@ private:
         errorMessage = message;
         errorStartTime = getCurrentTime();
     }
-    void onButtonA() override {
+public:
+    void onButtonA() override { onButtonA(captureFrame()); }
+    void onButtonB() override { onButtonB(captureFrame()); }
+    void onButtonC() override { onButtonC(captureFrame()); }
+    void onButtonALongPress() override { onButtonALongPress(captureFrame()); }
+    void onButtonBLongPress() override { onButtonBLongPress(captureFrame()); }
+    void onButtonA(const FrameContext& current) override {
+        frame = current;
         if (inputLogic) {
             inputLogic->incrementInput(1);
         }
-        onDraw();
+        onDraw(frame);
     }
-    void onButtonB() override {
+    void onButtonB(const FrameContext& current) override {
+        frame = current;
         if (inputLogic) {
             // 桁送りを試行
             bool success = inputLogic->shiftDigits();
             // 成功時のみUI反映（失敗時は何もしない）
             if (success) {
-                onDraw();
+                onDraw(frame);
             }
         }
     }
-    void onButtonC() override {
+    void onButtonC(const FrameContext& current) override {
+        frame = current;
         if (!inputLogic) return;
         
         bool success = false;
@@ -376,13 +382,15 @@ private:
             transitionToMainDisplay();
         }
     }
-    void onButtonALongPress() override {
+    void onButtonALongPress(const FrameContext& current) override {
+        frame = current;
         if (inputLogic) {
             inputLogic->incrementInput(5);
         }
-        onDraw();
+        onDraw(frame);
     }
-    void onButtonBLongPress() override {
+    void onButtonBLongPress(const FrameContext& current) override {
+        frame = current;
         if (inputLogic) {
             // リセット
             inputLogic->reset();
@@ -390,7 +398,7 @@ private:
             if (!isRelativeMode) {
                 inputLogic->incrementInput(0);
             }
-            onDraw();
+            onDraw(frame);
         }
     }
     void onButtonCLongPress() override {
@@ -2,6 +2,7 @@
 #include <cassert>
 #include <memory>
 #include "ITimeService.h"
+#include "FrameContext.h"
 
 class InputLogic {
 public:
@@ -28,6 +29,10 @@ public:
     
     // 相対値として現在の入力値を絶対時刻に変換
     virtual time_t getAbsoluteValue() const {
+        return getAbsoluteValueAt(FrameContext::capture(timeService_.get()));
+    }
+    // 同上（frame の時刻を基準に。画面は 1 フレーム内で同じ時刻を使う）
+    virtual time_t getAbsoluteValueAt(const FrameContext& frame) const {
         int inputValue = 0;
         bool hasInput = false;
         for (int i = 0; i < 4; ++i) {
@@ -36,13 +41,10 @@ public:
                 hasInput = true;
             }
         }
-        if (!hasInput) return -1; // 未入力
+        if (!hasInput || !frame.localValid) return -1; // 未入力
         int inputHour = inputValue / 100;
         int inputMinute = inputValue % 100;
-        time_t now = timeService_->now();
-        struct tm* tm_now = timeService_->localtime(&now);
-        struct tm alarm_tm = *tm_now;
-        alarm_tm.tm_sec = tm_now->tm_sec; // 現在時刻の秒を保持
+        struct tm alarm_tm = frame.local; // 現在時刻の秒を保持
         alarm_tm.tm_isdst = -1;
         if (inputMinute >= 60) { inputHour += inputMinute / 60; inputMinute = inputMinute % 60; }
         int add_day = inputHour / 24;
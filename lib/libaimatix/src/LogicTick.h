@@ -0,0 +1,90 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include "ButtonManager.h"
+
+// Button events detected by one logic tick (bit i = ButtonManager::ButtonType i)
+struct ButtonEvents {
+	uint8_t pressDown;
+	uint8_t shortPress;
+	uint8_t longPress;
+
+	bool any() const { return (pressDown | shortPress | longPress) != 0; }
+	static uint8_t bit(ButtonManager::ButtonType btn) { return static_cast<uint8_t>(1u << btn); }
+};
+
+// Single-producer/single-consumer ring from the logic tick to the UI task.
+// Lock-free and fixed capacity; a full queue drops the newest events (counted).
+class ButtonEventQueue {
+public:
+	static constexpr size_t kCapacity = 16; // kCapacity - 1 usable slots
+
+	ButtonEventQueue() : head_(0), tail_(0), dropped_(0) {}
+
+	// Producer (logic tick)
+	bool push(const ButtonEvents& events) {
+		const size_t tail = tail_.load(std::memory_order_relaxed);
+		const size_t next = (tail + 1) % kCapacity;
+		if (next == head_.load(std::memory_order_acquire)) {
+			dropped_.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+		slots_[tail] = events;
+		tail_.store(next, std::memory_order_release);
+		return true;
+	}
+
+	// Consumer (UI task)
+	bool pop(ButtonEvents& out) {
+		const size_t head = head_.load(std::memory_order_relaxed);
+		if (head == tail_.load(std::memory_order_acquire)) return false;
+		out = slots_[head];
+		head_.store((head + 1) % kCapacity, std::memory_order_release);
+		return true;
+	}
+
+	uint32_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+	ButtonEvents slots_[kCapacity];
+	std::atomic<size_t> head_;
+	std::atomic<size_t> tail_;
+	std::atomic<uint32_t> dropped_;
+};
+
+// Pure logic of the 100Hz logic tick (spec 3.1: main loop 100Hz).
+// Samples the raw button levels every kPeriodMs, debounces them through ButtonManager
+// and hands the resulting events to the UI task, which renders at its own adaptive rate.
+// Rendering never delays input handling. FreeRTOS/Arduino independent.
+class LogicTick {
+public:
+	static constexpr uint32_t kPeriodMs = 10;
+
+	explicit LogicTick(ButtonEventQueue* queue) : queue_(queue), held_(false) {}
+
+	// One tick. nowUs: 64-bit monotonic microseconds (esp_timer_get_time on device).
+	// True when events were queued (the caller wakes the UI task).
+	bool tick(int64_t nowUs, bool pressedA, bool pressedB, bool pressedC) {
+		const bool pressed[3] = { pressedA, pressedB, pressedC };
+		ButtonEvents events = { 0, 0, 0 };
+		for (int i = 0; i < 3; ++i) {
+			const ButtonManager::ButtonType btn = static_cast<ButtonManager::ButtonType>(i);
+			buttons_.update(btn, pressed[i], nowUs);
+			if (buttons_.isPressDown(btn)) events.pressDown |= ButtonEvents::bit(btn);
+			if (buttons_.isShortPress(btn)) events.shortPress |= ButtonEvents::bit(btn);
+			if (buttons_.isLongPress(btn)) events.longPress |= ButtonEvents::bit(btn);
+		}
+		held_.store(pressedA || pressedB || pressedC, std::memory_order_relaxed);
+		return events.any() && queue_ != nullptr && queue_->push(events);
+	}
+
+	// Raw level of the last tick (UI task: pacing/CPU clock decisions)
+	bool anyHeld() const { return held_.load(std::memory_order_relaxed); }
+
+private:
+	ButtonManager buttons_;
+	ButtonEventQueue* queue_;
+	std::atomic<bool> held_;
+};
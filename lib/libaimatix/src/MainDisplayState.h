@@ -7,7 +7,28 @@
 #include <vector>
 #include <string>
 #include <ctime>
-#include "AlarmRolloverDetector.h"
+#include "AlarmStore.h"
+#include "IPowerTelemetry.h"
+#include "ViewModelDiffer.h"
+#include "EventBus.h"
+
+// メイン画面の 1 フレーム分の表示内容（POD）。アラーム一覧は AlarmStore の世代番号だけを持ち、文字列は変化時のみ生成
+struct MainViewModel {
+    enum Field : uint8_t { Time, Remain, Progress, AlarmList, kFieldCount };
+    char time[8];
+    char remain[16];
+    int progress;
+    uint32_t alarms; // alarm_times.generation()
+
+    uint32_t fingerprint(size_t field) const {
+        switch (field) {
+        case Time: return ViewFingerprint::ofString(time);
+        case Remain: return ViewFingerprint::ofString(remain);
+        case Progress: return static_cast<uint32_t>(progress);
+        default: return alarms;
+        }
+    }
+};
 
 class MainDisplayState : public IState {
 public:
@@ -17,37 +38,66 @@ public:
     void setAlarmDisplayState(IState* alarmState) { alarmDisplayState = alarmState; }
     void setSettingsDisplayState(IState* settingsState) { settingsDisplayState = settingsState; }
     void setAlarmActiveState(IState* ringingState) { alarmActiveState = ringingState; }
+    void setPowerTelemetry(const IPowerTelemetry* telemetry) { battery.setSource(telemetry); }
+    // 時刻の段差（TimeChanged）で進捗バーの基準を取り直す
+    void setEventBus(EventBus* bus) {
+        eventBus = bus;
+        eventSubscriber = bus ? bus->subscribe(EventBus::mask(EventTopic::TimeChanged)) : EventBus::kNoSubscriber;
+    }
     void onEnter() override {
         if (view) {
             view->clear();
-            view->showTitle("MAIN", 42, false);
+            const BatteryStatus bat = battery.take();
+            view->showTitle("MAIN", bat.percent, bat.charging);
             view->showHints("ABS", "REL+", "MGMT");
         }
+        differ.invalidate();
+        extern AlarmStore alarm_times;
+        firedWhileAway = exited && alarm_times.firedBatches() != firedBatchesAtExit;
+    }
+    void onExit() override {
+        extern AlarmStore alarm_times;
+        firedBatchesAtExit = alarm_times.firedBatches();
+        exited = true;
     }
-    void onExit() override {}
-    void onDraw() override {
+    void onDraw() override { onDraw(FrameContext::capture(nullptr)); }
+    void onDraw(const FrameContext& frame) override {
         if (!view || !timeLogic || !alarmLogic) return;
-        // --- 現在時刻取得 ---
-        time_t now = time(nullptr);
-        struct tm* tm_now = localtime(&now);
-        char currentTime[16];
-        snprintf(currentTime, sizeof(currentTime), "%02d:%02d", tm_now->tm_hour, tm_now->tm_min);
-        view->showTime(currentTime);
-        // --- アラームリストの消化 ---
-        extern std::vector<time_t> alarm_times;
-        AlarmLogic::removePastAlarms(alarm_times, now);
-        // 先頭アラーム消化の検出（remove後のfront差し替わりで判定）
+        // --- アラームリストの消化（描画より先: 鳴動までの遅れを描画負荷に左右させない） ---
+        const time_t now = frame.now;
+        extern AlarmStore alarm_times;
+        // 発火判定は単調時計上の締め切り（壁時計の段差では鳴らない/遅れない）
+        const size_t fired = AlarmLogic::removePastAlarms(alarm_times, now);
+        // 鳴動は単調時計での消化だけで決める（壁時計の段差や rebase による表示時刻の変化では鳴らさない）。
+        // 他の画面（アラーム管理）にいる間に消化された分も、戻ったときに鳴らす
         if (manager && alarmActiveState) {
-            if (rolloverDetector.onFrame(alarm_times, now)) {
+            const bool firedElsewhere = firedWhileAway;
+            firedWhileAway = false;
+            if (fired > 0 || firedElsewhere) {
                 manager->setState(alarmActiveState);
                 return; // 次フレームで描画は鳴動状態に委譲
             }
         }
+        // 電池表示は表示値が変わったときだけ再描画
+        if (battery.changed()) {
+            const BatteryStatus bat = battery.take();
+            view->showTitle("MAIN", bat.percent, bat.charging);
+        }
+        MainViewModel model;
+        // --- 現在時刻 ---
+        if (frame.localValid) {
+            snprintf(model.time, sizeof(model.time), "%02d:%02d", frame.local.tm_hour, frame.local.tm_min);
+        } else {
+            snprintf(model.time, sizeof(model.time), "--:--");
+        }
         // --- 残り時間・進捗計算 ---
-        int remainSec = AlarmLogic::getRemainSec(alarm_times, now);
-        static time_t lastAlarmStart = 0;
-        static int lastAlarmTotalSec = 0;
-        static time_t prevNextAlarm = 0;
+        int remainSec = AlarmLogic::getRemainSec(alarm_times.times(), now);
+        if (eventBus) {
+            BusEvent event;
+            while (eventBus->poll(eventSubscriber, event)) {
+                prevNextAlarm = 0; // 時計が動いた: 次のフレームの残り時間を全体とする
+            }
+        }
         time_t nextAlarm = (!alarm_times.empty()) ? alarm_times.front() : 0;
         if (nextAlarm != prevNextAlarm) {
             lastAlarmStart = now;
@@ -56,18 +106,23 @@ public:
         }
         int totalSec = lastAlarmTotalSec > 0 ? lastAlarmTotalSec : 1;
         int progressPercent = AlarmLogic::getRemainPercent(remainSec, totalSec);
-        char remainTime[16];
-        snprintf(remainTime, sizeof(remainTime), "%02d:%02d:%02d", remainSec/3600, (remainSec/60)%60, remainSec%60);
+        snprintf(model.remain, sizeof(model.remain), "%02d:%02d:%02d", remainSec/3600, (remainSec/60)%60, remainSec%60);
         if (alarm_times.empty()) {
-            snprintf(remainTime, sizeof(remainTime), "00:00:00");
+            snprintf(model.remain, sizeof(model.remain), "00:00:00");
             progressPercent = 0;
         }
-        view->showRemain(remainTime);
-        view->showProgress(progressPercent);
-        // --- アラームリスト ---
-        std::vector<std::string> alarmStrs;
-        AlarmLogic::getAlarmTimeStrings(alarm_times, alarmStrs);
-        view->showAlarmList(alarmStrs);
+        model.progress = progressPercent;
+        model.alarms = alarm_times.generation();
+        // --- 変化したフィールドだけをビューへ ---
+        const ViewModelDiffer<MainViewModel>::Mask changed = differ.diff(model);
+        if (ViewModelDiffer<MainViewModel>::has(changed, MainViewModel::Time)) view->showTime(model.time);
+        if (ViewModelDiffer<MainViewModel>::has(changed, MainViewModel::Remain)) view->showRemain(model.remain);
+        if (ViewModelDiffer<MainViewModel>::has(changed, MainViewModel::Progress)) view->showProgress(model.progress);
+        if (ViewModelDiffer<MainViewModel>::has(changed, MainViewModel::AlarmList)) {
+            FrameStringList alarmStrs;
+            AlarmLogic::getAlarmTimeStrings(alarm_times.times(), alarmStrs);
+            view->showAlarmList(alarmStrs);
+        }
     }
     void onButtonA() override {
         if (manager && inputDisplayState) {
@@ -109,5 +164,16 @@ private:
     IMainDisplayView* view;
     TimeLogic* timeLogic;
     AlarmLogic* alarmLogic;
-        AlarmRolloverDetector rolloverDetector;
+    // 画面を離れている間の消化（AlarmStore::firedBatches の変化）
+    bool exited = false;
+    uint32_t firedBatchesAtExit = 0;
+    bool firedWhileAway = false;
+    TitleBatteryIndicator battery;
+    ViewModelDiffer<MainViewModel> differ;
+    // 進捗バーの基準（先頭アラームが変わったとき/時刻が動いたときに取り直す）
+    time_t lastAlarmStart = 0;
+    int lastAlarmTotalSec = 0;
+    time_t prevNextAlarm = 0;
+    EventBus* eventBus = nullptr;
+    EventBus::SubscriberId eventSubscriber = EventBus::kNoSubscriber;
 }; 
\ No newline at end of file
@@ -0,0 +1,113 @@
+#include "RtcTimeService.h"
+#include "CivilTime.h"
+#include <cstring>
+
+namespace {
+
+constexpr int64_t kMinEpoch = 1735689600LL;  // 2025-01-01 00:00:00 UTC (TimeSyncLogic と同じ下限)
+constexpr int64_t kMaxEpoch = 4102444800LL;  // 2100-01-01 00:00:00 UTC (exclusive)
+constexpr int kMaxTzOffsetMinutes = 14 * 60;
+
+} // namespace
+
+bool RtcTimeService::toEpoch(const RtcDateTime& dt, time_t& outEpoch) {
+    if (dt.month < 1 || dt.month > 12) return false;
+    if (dt.day < 1 || dt.day > CivilTime::daysInMonth(dt.year, dt.month)) return false;
+    if (dt.hour < 0 || dt.hour > 23 || dt.minute < 0 || dt.minute > 59 || dt.second < 0 || dt.second > 59) {
+        return false;
+    }
+    const int64_t days = CivilTime::daysFromCivil(dt.year, dt.month, dt.day);
+    outEpoch = static_cast<time_t>(days * 86400 + dt.hour * 3600 + dt.minute * 60 + dt.second);
+    return true;
+}
+
+void RtcTimeService::fromEpoch(time_t epoch, RtcDateTime& out) {
+    int64_t days = 0;
+    int64_t secs = 0;
+    CivilTime::splitEpoch(static_cast<int64_t>(epoch), days, secs);
+    CivilTime::civilFromDays(days, out.year, out.month, out.day);
+    out.hour = static_cast<int>(secs / 3600);
+    out.minute = static_cast<int>((secs % 3600) / 60);
+    out.second = static_cast<int>(secs % 60);
+}
+
+bool RtcTimeService::isEpochInRange(time_t epoch) {
+    const int64_t t = static_cast<int64_t>(epoch);
+    return t >= kMinEpoch && t < kMaxEpoch;
+}
+
+auto RtcTimeService::restoreAtBoot() -> BootResult {
+    if (rtc_ == nullptr) return BootResult::NoRtc;
+    RtcDateTime dt{};
+    bool integrityLost = false;
+    if (!rtc_->read(dt, integrityLost)) return BootResult::NoRtc;
+    // 電池切れ等で発振が止まった RTC の値は信用しない
+    if (integrityLost) return BootResult::IntegrityLost;
+    time_t epoch = 0;
+    if (!toEpoch(dt, epoch)) return BootResult::InvalidFields;
+    if (!isEpochInRange(epoch)) return BootResult::OutOfRange;
+    // RTC に書き戻さない（読んだ値そのもの）
+    const time_t before = inner_->now();
+    if (!inner_->setSystemTime(epoch)) return BootResult::ApplyFailed;
+    publishTimeChanged(before);
+    return BootResult::Restored;
+}
+
+bool RtcTimeService::restoreTimeZone() {
+    if (rtc_ == nullptr) return false;
+    char name[kTzNameMaxLen + 1] = {};
+    int minutes = 0;
+    if (!rtc_->loadTimeZone(name, sizeof(name), minutes)) return false;
+    if (minutes < -kMaxTzOffsetMinutes || minutes > kMaxTzOffsetMinutes) return false;
+    name[kTzNameMaxLen] = '\0';
+    inner_->applyTimeZone(name, std::strlen(name), minutes);
+    publishTimeChanged(inner_->now());
+    return true;
+}
+
+bool RtcTimeService::setSystemTime(time_t time) {
+    const time_t before = inner_->now();
+    if (!inner_->setSystemTime(time)) return false;
+    publishTimeChanged(before);
+    return true;
+}
+
+bool RtcTimeService::setSystemTimeMicros(int64_t epochUs) {
+    const time_t before = inner_->now();
+    if (!inner_->setSystemTimeMicros(epochUs)) return false;
+    publishTimeChanged(before);
+    return true;
+}
+
+bool RtcTimeService::applySyncedTime(int64_t epochUs) {
+    const time_t before = inner_->now();
+    if (!inner_->applySyncedTime(epochUs)) return false;
+    // スルーで吸収された場合の段差は 0
+    publishTimeChanged(before);
+    // スルー中でも RTC には同期した真値を書く
+    writeRtc(static_cast<time_t>((epochUs + 500000) / 1000000));
+    return true;
+}
+
+void RtcTimeService::applyTimeZone(const char* ianaName, size_t nameLen, int offsetMinutes) {
+    inner_->applyTimeZone(ianaName, nameLen, offsetMinutes);
+    publishTimeChanged(inner_->now()); // 壁時計（UTC）は動かないが表示時刻は変わる
+    if (rtc_ == nullptr) return;
+    if (offsetMinutes < -kMaxTzOffsetMinutes || offsetMinutes > kMaxTzOffsetMinutes) return;
+    // 長すぎる名前は保存しない（オフセットだけ残す）
+    if (ianaName == nullptr || nameLen > kTzNameMaxLen) nameLen = 0;
+    rtc_->saveTimeZone(nameLen > 0 ? ianaName : "", nameLen, offsetMinutes);
+}
+
+void RtcTimeService::writeRtc(time_t epoch) {
+    // 範囲外（例: 起動時の最小時刻補正より前）は RTC を汚さない
+    if (rtc_ == nullptr || !isEpochInRange(epoch)) return;
+    RtcDateTime dt{};
+    fromEpoch(epoch, dt);
+    (void)rtc_->write(dt);
+}
+
+void RtcTimeService::publishTimeChanged(time_t before) {
+    if (bus_ == nullptr) return;
+    bus_->publish(EventTopic::TimeChanged, static_cast<int64_t>(inner_->now()) - static_cast<int64_t>(before));
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "ITimeService.h"
+#include "IRtc.h"
+#include "EventBus.h"
+#include <ctime>
+
+/**
+ * RTC-backed ITimeService (decorator).
+ * - Boot: restoreAtBoot() reads the RTC once, validates it and sets the wrapped clock
+ * - Every successful Time Sync (applySyncedTime) is written to the RTC (UTC, whole seconds)
+ * - The last timezone from Time Sync is remembered via IRtc and re-applied by restoreTimeZone()
+ * Everything else is forwarded to the wrapped service.
+ * Every successful clock or timezone change is published as TimeChanged (value: step in seconds).
+ */
+class RtcTimeService : public ITimeService {
+public:
+	enum class BootResult { Restored, NoRtc, IntegrityLost, InvalidFields, OutOfRange, ApplyFailed };
+
+	RtcTimeService(ITimeService* inner, IRtc* rtc) : inner_(inner), rtc_(rtc), bus_(nullptr) {}
+
+	void setEventBus(EventBus* bus) { bus_ = bus; }
+
+	// Read RTC → validate → set system clock. Restored means the clock is valid now.
+	BootResult restoreAtBoot();
+	// Stored timezone → inner applyTimeZone (false when none or out of range)
+	bool restoreTimeZone();
+
+	time_t now() const override { return inner_->now(); }
+	int64_t nowMicros() const override { return inner_->nowMicros(); }
+	struct tm* localtime(time_t* time) const override { return inner_->localtime(time); }
+	// Plain sets (boot minimum correction, manual input) are not trusted enough for the RTC
+	bool setSystemTime(time_t time) override;
+	bool setSystemTimeMicros(int64_t epochUs) override;
+	bool applySyncedTime(int64_t epochUs) override;
+	int32_t driftPpb() const override { return inner_->driftPpb(); }
+	void disciplineTick() override { inner_->disciplineTick(); }
+	void applyTimeZone(const char* ianaName, size_t nameLen, int offsetMinutes) override;
+	uint32_t monotonicMillis() const override { return inner_->monotonicMillis(); }
+	int64_t monotonicMicros() const override { return inner_->monotonicMicros(); }
+
+	// Calendar conversion helpers (UTC, proleptic Gregorian; no libc timezone involvement)
+	static bool toEpoch(const RtcDateTime& dt, time_t& outEpoch);
+	static void fromEpoch(time_t epoch, RtcDateTime& out);
+	// Accepted RTC range: [TimeValidationLogic minimum, 2100-01-01)
+	static bool isEpochInRange(time_t epoch);
+
+	// Longest IANA name kept (e.g. "America/Argentina/ComodRivadavia" is 32)
+	static constexpr size_t kTzNameMaxLen = 40;
+
+private:
+	void writeRtc(time_t epoch);
+	void publishTimeChanged(time_t before);
+
+	ITimeService* inner_;
+	IRtc* rtc_;
+	EventBus* bus_;
+};
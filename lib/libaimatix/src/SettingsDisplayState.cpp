@@ -4,14 +4,12 @@
 #include <string>
 
 void SettingsDisplayState::onEnter() {
-    // ちらつき防止用の状態をリセット
-    lastDisplayedItems.clear();
-    lastSelectedIndex = -1;
+    // 入場時は全フィールドを描き直す
+    differ.invalidate();
     
     if (view != nullptr) {
         view->clear();
-        constexpr int BATTERY_WARNING_THRESHOLD = 42;
-        view->showTitle("SETTINGS", BATTERY_WARNING_THRESHOLD, false);
+        drawTitle();
         view->showHints("UP", "DOWN", "SELECT");
     }
     onDraw();
@@ -25,34 +23,27 @@ void SettingsDisplayState::onDraw() {
     if (view == nullptr || settingsLogic == nullptr) {
         return;
     }
-    
-    std::vector<std::string> settingsList = generateSettingsList();
-    int selectedIndex = settingsLogic->getIndexByItem(settingsLogic->getSelectedItem());
-    
-    // ちらつき防止：変更があった場合のみ更新
-    bool needsUpdate = false;
-    
-    // 初期表示時は強制的に更新
-    if (lastDisplayedItems.empty()) {
-        needsUpdate = true;
-    } else {
-        // 選択位置の変更をチェック
-        if (selectedIndex != lastSelectedIndex) {
-            needsUpdate = true;
-        }
+    // 電池表示は表示値が変わったときだけ再描画
+    if (battery.changed()) {
+        drawTitle();
     }
     
-    // 変更がない場合は何もしない（ちらつき防止）
-    if (!needsUpdate) {
+    const int selectedIndex = settingsLogic->getIndexByItem(settingsLogic->getSelectedItem());
+    
+    // ちらつき防止：項目の値か選択位置が変わった場合のみ更新
+    SettingsViewModel model;
+    uint32_t values = ViewFingerprint::mix(ViewFingerprint::kSeed, static_cast<uint32_t>(settingsLogic->getItemCount()));
+    values = ViewFingerprint::mix(values, settingsLogic->isSoundEnabled() ? 1u : 0u);
+    values = ViewFingerprint::mix(values, static_cast<uint32_t>(settingsLogic->getLcdBrightness()));
+    model.values = ViewFingerprint::mix(values, settingsLogic->isValueEditMode() ? 1u : 0u);
+    model.selected = static_cast<uint32_t>(selectedIndex);
+    if (differ.diff(model) == 0) {
         return;
     }
     
-    // 変更があった場合のみ画面を更新
-    view->showSettingsList(settingsList, selectedIndex);
-    
-    // 現在の状態を記憶
-    lastDisplayedItems = settingsList;
-    lastSelectedIndex = selectedIndex;
+    // 変更があった場合のみリストを生成して画面を更新（定常フレームは文字列を作らない）
+    displayedItems = generateSettingsList();
+    view->showSettingsList(displayedItems, selectedIndex);
 }
 
 void SettingsDisplayState::onButtonA() {
@@ -143,4 +134,9 @@ auto SettingsDisplayState::generateSettingsList() const -> std::vector<std::stri
     }
     
     return list;
-} 
\ No newline at end of file
+} 
+
+void SettingsDisplayState::drawTitle() {
+    const BatteryStatus bat = battery.take();
+    view->showTitle("SETTINGS", bat.percent, bat.charging);
+}
@@ -2,10 +2,21 @@
 #include "StateManager.h"
 #include "ISettingsLogic.h"
 #include "ISettingsDisplayView.h"
+#include "IPowerTelemetry.h"
+#include "ViewModelDiffer.h"
 #include <vector>
 #include <string>
 #include <memory>
 
+// 設定画面の表示内容（POD）。項目の文字列は値から決まるので、値の指紋だけを比較する
+struct SettingsViewModel {
+    enum Field : uint8_t { Items, Selection, kFieldCount };
+    uint32_t values;   // 項目数・サウンド・輝度・編集モード
+    uint32_t selected;
+
+    uint32_t fingerprint(size_t field) const { return field == Items ? values : selected; }
+};
+
 class SettingsDisplayState : public IState {
 public:
     SettingsDisplayState(ISettingsLogic* logic = nullptr, ISettingsDisplayView* view = nullptr)
@@ -27,6 +38,7 @@ public:
     void setSettingsLogic(ISettingsLogic* logic) { settingsLogic = logic; }
     void setDateTimeInputState(IState* datetimeState) { datetimeInputState = datetimeState; }
     void setTimeSyncDisplayState(IState* timeSyncState) { timeSyncDisplayState = timeSyncState; }
+    void setPowerTelemetry(const IPowerTelemetry* telemetry) { battery.setSource(telemetry); }
     
 private:
     ISettingsLogic* settingsLogic;
@@ -36,10 +48,12 @@ private:
     IState* datetimeInputState;
     IState* timeSyncDisplayState{nullptr};
     
-    // ちらつき防止用の状態記憶
-    std::vector<std::string> lastDisplayedItems;
-    int lastSelectedIndex = -1;
+    // ちらつき防止: ビューへ渡した項目/選択位置との差分。displayedItems は表示文字列の作業領域
+    ViewModelDiffer<SettingsViewModel> differ;
+    std::vector<std::string> displayedItems;
+    TitleBatteryIndicator battery;
     
     // 表示用の設定項目リストを生成
     std::vector<std::string> generateSettingsList() const;
+    void drawTitle();
 }; 
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+
+// Pure logic: spreads a clock offset over time at a bounded rate (ppm of elapsed time)
+// so the wall clock never jumps and never runs backwards.
+class SlewPlanner {
+public:
+    static constexpr uint32_t kDefaultRatePpm = 5000; // 5 ms per second
+
+    explicit SlewPlanner(uint32_t ratePpm = kDefaultRatePpm)
+        : ratePpm_(ratePpm), remainingUs_(0), budgetFrac_(0) {}
+
+    // Amount (µs) to add to the clock; replaces any unfinished slew
+    void start(int64_t offsetUs) { remainingUs_ = offsetUs; budgetFrac_ = 0; }
+    void cancel() { remainingUs_ = 0; budgetFrac_ = 0; }
+
+    uint32_t ratePpm() const { return ratePpm_; }
+    bool active() const { return remainingUs_ != 0; }
+    int64_t remainingUs() const { return remainingUs_; }
+    // Time still needed at the configured rate
+    uint32_t remainingMs() const {
+        const int64_t mag = remainingUs_ < 0 ? -remainingUs_ : remainingUs_;
+        return static_cast<uint32_t>((mag * 1000 + ratePpm_ - 1) / ratePpm_);
+    }
+
+    // µs to apply for elapsedMs of progress (|result| <= ratePpm * elapsed)
+    int64_t take(uint32_t elapsedMs) {
+        if (remainingUs_ == 0) return 0;
+        // ppm * ms = 1e-3 µs units; carry the fraction so the rate is exact
+        budgetFrac_ += static_cast<uint64_t>(ratePpm_) * elapsedMs;
+        const int64_t budgetUs = static_cast<int64_t>(budgetFrac_ / 1000u);
+        budgetFrac_ %= 1000u;
+        int64_t step = remainingUs_;
+        if (step > budgetUs) step = budgetUs;
+        if (step < -budgetUs) step = -budgetUs;
+        remainingUs_ -= step;
+        if (remainingUs_ == 0) budgetFrac_ = 0;
+        return step;
+    }
+
+private:
+    uint32_t ratePpm_;
+    int64_t remainingUs_;
+    uint64_t budgetFrac_;
+};
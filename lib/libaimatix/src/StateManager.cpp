@@ -45,4 +45,39 @@ void StateManager::handleButtonBLongPress() {
     if (currentState != nullptr) {
         currentState->onButtonBLongPress();
     }
-} 
\ No newline at end of file
+}
+void StateManager::draw(const FrameContext& frame) {
+    if (currentState != nullptr) {
+        currentState->onDraw(frame);
+    }
+}
+void StateManager::handleButtonA(const FrameContext& frame) {
+    if (currentState != nullptr) {
+        currentState->onButtonA(frame);
+    }
+}
+void StateManager::handleButtonB(const FrameContext& frame) {
+    if (currentState != nullptr) {
+        currentState->onButtonB(frame);
+    }
+}
+void StateManager::handleButtonC(const FrameContext& frame) {
+    if (currentState != nullptr) {
+        currentState->onButtonC(frame);
+    }
+}
+void StateManager::handleButtonALongPress(const FrameContext& frame) {
+    if (currentState != nullptr) {
+        currentState->onButtonALongPress(frame);
+    }
+}
+void StateManager::handleButtonBLongPress(const FrameContext& frame) {
+    if (currentState != nullptr) {
+        currentState->onButtonBLongPress(frame);
+    }
+}
+void StateManager::handleButtonCLongPress(const FrameContext& frame) {
+    if (currentState != nullptr) {
+        currentState->onButtonCLongPress(frame);
+    }
+}
@@ -1,4 +1,5 @@
 #pragma once
+#include "FrameContext.h"
 
 class IState {
 public:
@@ -12,6 +13,15 @@ public:
     virtual void onButtonALongPress() = 0;
     virtual void onButtonBLongPress() = 0;
     virtual void onButtonCLongPress() = 0;
+    // フレーム時刻付きの入口（loop はこちらを呼ぶ）。時刻を使う画面が実装し、1 フレーム内は同じ時刻を使う。
+    // 既定は時刻を使わない従来の入口へ
+    virtual void onDraw(const FrameContext& frame) { (void)frame; onDraw(); }
+    virtual void onButtonA(const FrameContext& frame) { (void)frame; onButtonA(); }
+    virtual void onButtonB(const FrameContext& frame) { (void)frame; onButtonB(); }
+    virtual void onButtonC(const FrameContext& frame) { (void)frame; onButtonC(); }
+    virtual void onButtonALongPress(const FrameContext& frame) { (void)frame; onButtonALongPress(); }
+    virtual void onButtonBLongPress(const FrameContext& frame) { (void)frame; onButtonBLongPress(); }
+    virtual void onButtonCLongPress(const FrameContext& frame) { (void)frame; onButtonCLongPress(); }
 };
 
 class StateManager {
@@ -25,6 +35,14 @@ public:
     void handleButtonALongPress();
     void handleButtonBLongPress();
     void handleButtonCLongPress();
+    // フレーム時刻付き（loop から）
+    void draw(const FrameContext& frame);
+    void handleButtonA(const FrameContext& frame);
+    void handleButtonB(const FrameContext& frame);
+    void handleButtonC(const FrameContext& frame);
+    void handleButtonALongPress(const FrameContext& frame);
+    void handleButtonBLongPress(const FrameContext& frame);
+    void handleButtonCLongPress(const FrameContext& frame);
 private:
     IState* currentState;
 }; 
\ No newline at end of file
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Fixed-bin latency histogram for deadline checks (logic tick soak, device and host).
+// 100us bins up to 12.8ms plus an overflow bin; percentiles are conservative (bin upper
+// edge, capped at the observed maximum). Plain data: copy it to take a snapshot.
+class TickLatencyHistogram {
+public:
+	static constexpr uint32_t kBinUs = 100;
+	static constexpr size_t kBins = 128;
+
+	explicit TickLatencyHistogram(uint32_t deadlineUs) : deadlineUs_(deadlineUs) { clear(); }
+
+	void clear() {
+		for (size_t i = 0; i <= kBins; ++i) bins_[i] = 0;
+		count_ = 0;
+		misses_ = 0;
+		maxUs_ = 0;
+	}
+
+	void record(uint32_t latencyUs) {
+		const size_t bin = latencyUs / kBinUs;
+		++bins_[bin < kBins ? bin : kBins];
+		++count_;
+		if (latencyUs > deadlineUs_) ++misses_;
+		if (latencyUs > maxUs_) maxUs_ = latencyUs;
+	}
+
+	// Latency not exceeded by `permille`/1000 of the samples (999 = p99.9); 0 when empty
+	uint32_t percentileUs(uint32_t permille) const {
+		if (count_ == 0) return 0;
+		uint64_t rank = (static_cast<uint64_t>(count_) * permille + 999u) / 1000u;
+		if (rank == 0) rank = 1;
+		uint64_t seen = 0;
+		for (size_t i = 0; i < kBins; ++i) {
+			seen += bins_[i];
+			if (seen >= rank) {
+				const uint32_t upper = static_cast<uint32_t>((i + 1) * kBinUs);
+				return upper < maxUs_ ? upper : maxUs_;
+			}
+		}
+		return maxUs_;
+	}
+
+	uint32_t count() const { return count_; }
+	uint32_t misses() const { return misses_; }
+	uint32_t maxUs() const { return maxUs_; }
+	uint32_t deadlineUs() const { return deadlineUs_; }
+
+private:
+	uint32_t deadlineUs_;
+	uint32_t bins_[kBins + 1];
+	uint32_t count_;
+	uint32_t misses_;
+	uint32_t maxUs_;
+};
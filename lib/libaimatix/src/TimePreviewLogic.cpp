@@ -116,7 +116,7 @@ time_t TimePreviewLogic::calculateAbsoluteTime(
     return candidate;
 }
 
-std::string TimePreviewLogic::formatPreview(
+FrameString TimePreviewLogic::formatPreview(
     time_t time, 
     ITimeService* timeService,
     bool isRelativeMode
@@ -159,7 +159,7 @@ std::string TimePreviewLogic::formatPreview(
         }
     }
     
-    return std::string(buffer);
+    return FrameString(buffer);
 }
 
 int TimePreviewLogic::calculateDayDifference(
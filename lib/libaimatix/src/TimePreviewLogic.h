@@ -1,13 +1,14 @@
 #pragma once
 #include "ITimeService.h"
 #include "PartialInputLogic.h"
+#include "FrameArena.h"
 #include <string>
 #include <ctime>
 
 class TimePreviewLogic {
 public:
     struct PreviewResult {
-        std::string preview;
+        FrameString preview;  // フレーム内の一時文字列（フレームアリーナ上）
         bool isValid;
     };
     
@@ -58,7 +59,7 @@ private:
      * @param isRelativeMode 相対値入力モードかどうか
      * @return フォーマットされたプレビュー文字列
      */
-    static std::string formatPreview(
+    static FrameString formatPreview(
         time_t time, 
         ITimeService* timeService,
         bool isRelativeMode
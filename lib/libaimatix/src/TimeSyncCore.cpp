@@ -1,5 +1,9 @@
 #include "TimeSyncCore.h"
 
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
 namespace {
 std::string escapeForWifiField(const std::string& input) {
     std::string out;
@@ -62,12 +66,22 @@ bool verifyToken(const std::string& expected, const std::string& actual) {
     return expected == actual;
 }
 
+bool verifyToken(const std::string& expected, const char* actual, size_t actualLen) {
+    if (actual == nullptr || expected.size() != actualLen) return false;
+    return std::memcmp(expected.data(), actual, actualLen) == 0;
+}
+
 bool isWithinWindow(uint32_t startMs, uint32_t nowMs, uint32_t windowMs) {
     // Handle wraparound with 32-bit unsigned arithmetic
     const uint32_t elapsed = nowMs - startMs;
     return elapsed <= windowMs;
 }
 
+bool isWithinWindowUs(int64_t startUs, int64_t nowUs, uint32_t windowMs) {
+    const int64_t elapsedUs = nowUs - startUs;
+    return elapsedUs >= 0 && elapsedUs <= static_cast<int64_t>(windowMs) * 1000;
+}
+
 std::string buildPosixTZ(int tzOffsetMin) {
     // POSIX TZ uses reversed sign: UTC+9 -> "-9"
     int off = tzOffsetMin;
@@ -84,6 +98,63 @@ std::string buildPosixTZ(int tzOffsetMin) {
     return std::string(buf);
 }
 
+namespace {
+size_t finishFormat(int written, size_t cap) {
+    if (written < 0 || static_cast<size_t>(written) >= cap) return 0;
+    return static_cast<size_t>(written);
+}
+}
+
+size_t buildRedirectResponse(const char* token, char* out, size_t cap) {
+    if (token == nullptr || out == nullptr || cap == 0) return 0;
+    return finishFormat(snprintf(out, cap,
+        "HTTP/1.1 302 Found\r\n"
+        "Location: /sync?t=%s\r\n"
+        "Cache-Control: no-store\r\n"
+        "Content-Length: 0\r\n"
+        "Connection: close\r\n\r\n", token), cap);
+}
+
+size_t buildGzipPageResponseHeader(size_t contentLength, const char* etag, char* out, size_t cap) {
+    if (etag == nullptr || out == nullptr || cap == 0) return 0;
+    return finishFormat(snprintf(out, cap,
+        "HTTP/1.1 200 OK\r\n"
+        "Content-Type: text/html; charset=utf-8\r\n"
+        "Content-Encoding: gzip\r\n"
+        "Content-Length: %lu\r\n"
+        "Cache-Control: private, no-cache\r\n"
+        "ETag: %s\r\n"
+        "Connection: close\r\n\r\n", static_cast<unsigned long>(contentLength), etag), cap);
+}
+
+size_t buildNotModifiedResponse(const char* etag, char* out, size_t cap) {
+    if (etag == nullptr || out == nullptr || cap == 0) return 0;
+    return finishFormat(snprintf(out, cap,
+        "HTTP/1.1 304 Not Modified\r\n"
+        "Cache-Control: private, no-cache\r\n"
+        "ETag: %s\r\n"
+        "Connection: close\r\n\r\n", etag), cap);
+}
+
+size_t buildProbeResponse(uint32_t deviceRecvMs, uint32_t deviceSendMs, char* out, size_t cap) {
+    if (out == nullptr || cap == 0) return 0;
+    char body[40];
+    const size_t bodyLen = finishFormat(snprintf(body, sizeof(body), "{\"t1\":%lu,\"t2\":%lu}",
+        static_cast<unsigned long>(deviceRecvMs), static_cast<unsigned long>(deviceSendMs)), sizeof(body));
+    if (bodyLen == 0) return 0;
+    return finishFormat(snprintf(out, cap,
+        "HTTP/1.1 200 OK\r\n"
+        "Content-Type: application/json\r\n"
+        "Content-Length: %lu\r\n"
+        "Cache-Control: no-store\r\n"
+        "Connection: close\r\n\r\n%s", static_cast<unsigned long>(bodyLen), body), cap);
+}
+
+size_t buildSessionEtag(const char* assetEtag, const char* token, char* out, size_t cap) {
+    if (assetEtag == nullptr || token == nullptr || out == nullptr || cap == 0) return 0;
+    return finishFormat(snprintf(out, cap, "\"%s-%s\"", assetEtag, token), cap);
+}
+
 static inline bool isSpace(char c) {
     return c == ' ' || c == '\t' || c == '\r' || c == '\n';
 }
@@ -142,5 +213,211 @@ bool jsonExtractInt(const std::string& body, const char* key, int& out) {
     return true;
 }
 
+namespace {
+
+enum TimeSetKey : unsigned {
+    KEY_EPOCH_MS = 1u << 0,
+    KEY_TZ_OFFSET_MIN = 1u << 1,
+    KEY_TOKEN = 1u << 2,
+    KEY_SAMPLES = 1u << 3,  // optional
+    KEY_TZ_NAME = 1u << 4,  // optional
+    KEY_REQUIRED = KEY_EPOCH_MS | KEY_TZ_OFFSET_MIN | KEY_TOKEN,
+};
+
+// Forward-only cursor over [p, end). Every helper advances p; nothing rewinds.
+struct JsonCursor {
+    const char* p;
+    const char* end;
+
+    void skipSpace() {
+        while (p < end && isSpace(*p)) ++p;
+    }
+    bool atEnd() const { return p >= end; }
+    bool consume(char c) {
+        skipSpace();
+        if (p < end && *p == c) { ++p; return true; }
+        return false;
+    }
+    bool peekIs(char c) {
+        skipSpace();
+        return p < end && *p == c;
+    }
+};
+
+// Reads a string body after the opening quote. No escapes, no control characters.
+ParseResult readString(JsonCursor& cur, size_t maxLen, const char*& outPtr, size_t& outLen) {
+    if (!cur.consume('"')) return ParseResult::Syntax;
+    const char* start = cur.p;
+    while (cur.p < cur.end) {
+        const char c = *cur.p;
+        if (c == '"') {
+            outPtr = start;
+            outLen = static_cast<size_t>(cur.p - start);
+            ++cur.p;
+            return outLen <= maxLen ? ParseResult::Ok : ParseResult::BadString;
+        }
+        if (c == '\\' || static_cast<unsigned char>(c) < 0x20) return ParseResult::BadString;
+        ++cur.p;
+    }
+    return ParseResult::Syntax; // unterminated
+}
+
+// Reads a JSON integer (RFC 8259 int production) with overflow detection.
+ParseResult readInt64(JsonCursor& cur, int64_t& out) {
+    cur.skipSpace();
+    if (cur.atEnd()) return ParseResult::Syntax;
+    if (*cur.p == '"') return ParseResult::TypeMismatch;
+    bool negative = false;
+    if (*cur.p == '-') { negative = true; ++cur.p; }
+    if (cur.atEnd() || *cur.p < '0' || *cur.p > '9') return ParseResult::BadNumber;
+    if (*cur.p == '0' && (cur.p + 1) < cur.end && cur.p[1] >= '0' && cur.p[1] <= '9') {
+        return ParseResult::BadNumber; // leading zero
+    }
+    const uint64_t limit = negative ? (static_cast<uint64_t>(INT64_MAX) + 1u)
+                                    : static_cast<uint64_t>(INT64_MAX);
+    uint64_t acc = 0;
+    while (cur.p < cur.end && *cur.p >= '0' && *cur.p <= '9') {
+        const uint64_t digit = static_cast<uint64_t>(*cur.p - '0');
+        if (acc > (limit - digit) / 10u) return ParseResult::BadNumber;
+        acc = acc * 10u + digit;
+        ++cur.p;
+    }
+    if (cur.p < cur.end && (*cur.p == '.' || *cur.p == 'e' || *cur.p == 'E')) {
+        return ParseResult::BadNumber;
+    }
+    if (negative) {
+        out = (acc == static_cast<uint64_t>(INT64_MAX) + 1u) ? INT64_MIN : -static_cast<int64_t>(acc);
+    } else {
+        out = static_cast<int64_t>(acc);
+    }
+    return ParseResult::Ok;
+}
+
+// Device timestamps must fit the uint32 monotonic clock
+ParseResult readUint32(JsonCursor& cur, uint32_t& out) {
+    int64_t v = 0;
+    const ParseResult r = readInt64(cur, v);
+    if (r != ParseResult::Ok) return r;
+    if (v < 0 || v > static_cast<int64_t>(UINT32_MAX)) return ParseResult::BadNumber;
+    out = static_cast<uint32_t>(v);
+    return ParseResult::Ok;
+}
+
+// [t0,t1,t2,t3]
+ParseResult readSample(JsonCursor& cur, ClockOffsetEstimator::Sample& out) {
+    if (!cur.consume('[')) return cur.atEnd() ? ParseResult::Syntax : ParseResult::TypeMismatch;
+    ParseResult r = readInt64(cur, out.clientSendMs);
+    if (r != ParseResult::Ok) return r;
+    if (!cur.consume(',')) return ParseResult::Syntax;
+    if ((r = readUint32(cur, out.deviceRecvMs)) != ParseResult::Ok) return r;
+    if (!cur.consume(',')) return ParseResult::Syntax;
+    if ((r = readUint32(cur, out.deviceSendMs)) != ParseResult::Ok) return r;
+    if (!cur.consume(',')) return ParseResult::Syntax;
+    if ((r = readInt64(cur, out.clientRecvMs)) != ParseResult::Ok) return r;
+    return cur.consume(']') ? ParseResult::Ok : ParseResult::Syntax;
 }
 
+// [[...],...] with at most kTimeSetMaxSamples entries (empty array allowed)
+ParseResult readSamples(JsonCursor& cur, TimeSyncCore::TimeSetRequest& out) {
+    if (!cur.consume('[')) return cur.atEnd() ? ParseResult::Syntax : ParseResult::TypeMismatch;
+    out.sampleCount = 0;
+    if (cur.consume(']')) return ParseResult::Ok;
+    for (;;) {
+        if (out.sampleCount == TimeSyncCore::kTimeSetMaxSamples) return ParseResult::TooManySamples;
+        const ParseResult r = readSample(cur, out.samples[out.sampleCount]);
+        if (r != ParseResult::Ok) return r;
+        ++out.sampleCount;
+        if (cur.consume(',')) continue;
+        return cur.consume(']') ? ParseResult::Ok : ParseResult::Syntax;
+    }
+}
+
+unsigned matchKey(const char* key, size_t len) {
+    if (len == 7 && std::memcmp(key, "epochMs", 7) == 0) return KEY_EPOCH_MS;
+    if (len == 11 && std::memcmp(key, "tzOffsetMin", 11) == 0) return KEY_TZ_OFFSET_MIN;
+    if (len == 5 && std::memcmp(key, "token", 5) == 0) return KEY_TOKEN;
+    if (len == 7 && std::memcmp(key, "samples", 7) == 0) return KEY_SAMPLES;
+    if (len == 6 && std::memcmp(key, "tzName", 6) == 0) return KEY_TZ_NAME;
+    return 0;
+}
+
+ParseResult readMember(JsonCursor& cur, unsigned& seen, TimeSyncCore::TimeSetRequest& out) {
+    constexpr size_t kKeyMaxLen = 16;
+    const char* key = nullptr;
+    size_t keyLen = 0;
+    if (!cur.peekIs('"')) return ParseResult::Syntax;
+    ParseResult r = readString(cur, kKeyMaxLen, key, keyLen);
+    if (r == ParseResult::BadString) return ParseResult::UnknownKey;
+    if (r != ParseResult::Ok) return r;
+    const unsigned id = matchKey(key, keyLen);
+    if (id == 0) return ParseResult::UnknownKey;
+    if ((seen & id) != 0) return ParseResult::DuplicateKey;
+    seen |= id;
+    if (!cur.consume(':')) return ParseResult::Syntax;
+
+    if (id == KEY_TOKEN) {
+        if (!cur.peekIs('"')) return cur.atEnd() ? ParseResult::Syntax : ParseResult::TypeMismatch;
+        return readString(cur, TimeSyncCore::kTimeSetTokenMaxLen, out.token, out.tokenLen);
+    }
+    if (id == KEY_TZ_NAME) {
+        if (!cur.peekIs('"')) return cur.atEnd() ? ParseResult::Syntax : ParseResult::TypeMismatch;
+        return readString(cur, TimeSyncCore::kTimeSetTzNameMaxLen, out.tzName, out.tzNameLen);
+    }
+    if (id == KEY_SAMPLES) {
+        return readSamples(cur, out);
+    }
+    int64_t v = 0;
+    r = readInt64(cur, v);
+    if (r != ParseResult::Ok) return r;
+    if (id == KEY_EPOCH_MS) {
+        out.epochMs = v;
+    } else {
+        if (v < INT32_MIN || v > INT32_MAX) return ParseResult::BadNumber;
+        out.tzOffsetMin = static_cast<int>(v);
+    }
+    return ParseResult::Ok;
+}
+
+} // namespace
+
+ParseResult parseTimeSetRequest(const char* data, size_t len, TimeSetRequest& out) {
+    if (data == nullptr) return ParseResult::Syntax;
+    if (len > kTimeSetBodyMaxLen) return ParseResult::TooLarge;
+    JsonCursor cur{data, data + len};
+    TimeSetRequest tmp{};
+    unsigned seen = 0;
+
+    if (!cur.consume('{')) return ParseResult::Syntax;
+    if (!cur.consume('}')) {
+        for (;;) {
+            const ParseResult r = readMember(cur, seen, tmp);
+            if (r != ParseResult::Ok) return r;
+            if (cur.consume(',')) continue;
+            if (cur.consume('}')) break;
+            return ParseResult::Syntax;
+        }
+    }
+    cur.skipSpace();
+    if (!cur.atEnd()) return ParseResult::Syntax; // trailing garbage
+    if ((seen & KEY_REQUIRED) != KEY_REQUIRED) return ParseResult::MissingKey;
+    out = tmp;
+    return ParseResult::Ok;
+}
+
+const char* parseResultCode(ParseResult result) {
+    switch (result) {
+        case ParseResult::Ok: return "ok";
+        case ParseResult::TooLarge: return "body_too_large";
+        case ParseResult::Syntax: return "json_syntax";
+        case ParseResult::UnknownKey: return "unknown_key";
+        case ParseResult::DuplicateKey: return "duplicate_key";
+        case ParseResult::MissingKey: return "missing_key";
+        case ParseResult::BadNumber: return "bad_number";
+        case ParseResult::BadString: return "bad_string";
+        case ParseResult::TypeMismatch: return "type_mismatch";
+        case ParseResult::TooManySamples: return "too_many_samples";
+    }
+    return "unknown";
+}
+
+}
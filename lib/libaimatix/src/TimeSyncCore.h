@@ -1,7 +1,9 @@
 #pragma once
 
 #include <string>
+#include <cstddef>
 #include <cstdint>
+#include "ClockOffsetEstimator.h"
 
 // Utility for building Wi‑Fi QR payloads used in Time Sync step1.
 // Format (PoC準拠): "WIFI:T:WPA;S:<SSID>;P:<PSK>;H:false;;"
@@ -22,17 +24,81 @@ bool verifyToken(const std::string& expected, const std::string& actual);
 
 // Check if nowMs is within [startMs, startMs+windowMs]
 bool isWithinWindow(uint32_t startMs, uint32_t nowMs, uint32_t windowMs);
+// Same on the 64-bit monotonic microsecond clock (no wraparound)
+bool isWithinWindowUs(int64_t startUs, int64_t nowUs, uint32_t windowMs);
 
 // Build POSIX TZ string from offset minutes.
 // Example: +540 -> "LT-9" (UTC+9), +330 -> "LT-5:30", -120 -> "LT+2"
 std::string buildPosixTZ(int tzOffsetMin);
 
 // Minimal JSON helpers for tiny MCU payloads (flat JSON, no nesting)
+// Note: key lookup is a plain substring search; use parseTimeSetRequest for /time/set.
 bool jsonExtractRaw(const std::string& body, const char* key, std::string& out);
 bool jsonExtractString(const std::string& body, const char* key, std::string& out);
 bool jsonExtractInt64(const std::string& body, const char* key, int64_t& out);
 bool jsonExtractInt(const std::string& body, const char* key, int& out);
 
+// Raw HTTP/1.1 responses for the captive portal, formatted into caller buffers (no heap).
+// Each returns the number of bytes written (NUL excluded) or 0 if cap is too small.
+// 302 to /sync?t=<token>; one precomputed response serves every probe path.
+size_t buildRedirectResponse(const char* token, char* out, size_t cap);
+// Header block for the precompressed /sync page (body follows separately)
+size_t buildGzipPageResponseHeader(size_t contentLength, const char* etag, char* out, size_t cap);
+// 304 for a matching If-None-Match
+size_t buildNotModifiedResponse(const char* etag, char* out, size_t cap);
+// 200 for GET /time/probe: {"t1":<recvMs>,"t2":<sendMs>} (device monotonic ms)
+size_t buildProbeResponse(uint32_t deviceRecvMs, uint32_t deviceSendMs, char* out, size_t cap);
+// Quoted per-session ETag: "<assetEtag>-<token>" (page bytes depend on both)
+size_t buildSessionEtag(const char* assetEtag, const char* token, char* out, size_t cap);
+
+// Upper bounds for the /time/set body and its string values
+constexpr size_t kTimeSetBodyMaxLen = 768;
+constexpr size_t kTimeSetTokenMaxLen = 64;
+constexpr size_t kTimeSetTzNameMaxLen = 40;
+// Upper bound for the optional "samples" array (one entry per /time/probe exchange)
+constexpr size_t kTimeSetMaxSamples = 8;
+
+// Typed view of a POST /time/set body.
+// token points into the caller's buffer (not NUL-terminated); valid while the body lives.
+struct TimeSetRequest {
+    int64_t epochMs;
+    int tzOffsetMin;
+    const char* token;
+    size_t tokenLen;
+    // Optional [[t0,t1,t2,t3],...] round-trip samples; sampleCount == 0 when absent
+    ClockOffsetEstimator::Sample samples[kTimeSetMaxSamples];
+    size_t sampleCount;
+    // Optional IANA zone name, e.g. "Europe/Berlin" (view like token; nullptr/0 when absent)
+    const char* tzName;
+    size_t tzNameLen;
+};
+
+enum class ParseResult {
+    Ok,
+    TooLarge,      // body exceeds kTimeSetBodyMaxLen
+    Syntax,        // not a single flat JSON object
+    UnknownKey,    // key other than epochMs/tzOffsetMin/token/samples/tzName
+    DuplicateKey,
+    MissingKey,
+    BadNumber,     // non-integer, leading zero, fraction/exponent or overflow
+    BadString,     // escape/control character or value too long
+    TypeMismatch,  // e.g. number where a string is expected
+    TooManySamples, // "samples" longer than kTimeSetMaxSamples
+};
+
+// Single-pass, bounded parse of {"epochMs":<int>,"tzOffsetMin":<int>,"token":"<str>"}
+// with an optional "samples":[[t0,t1,t2,t3],...] (t1/t2 are device monotonic uint32)
+// and an optional "tzName":"<IANA name>".
+// Scans data[0..len) exactly once with no heap allocation. Whitespace between tokens is
+// allowed; nesting, escapes and trailing garbage are rejected. out is valid only on Ok.
+ParseResult parseTimeSetRequest(const char* data, size_t len, TimeSetRequest& out);
+
+// Short reason code for logs/HTTP bodies, e.g. "json_syntax"
+const char* parseResultCode(ParseResult result);
+
+// Token comparison against a non-terminated view (see TimeSetRequest::token)
+bool verifyToken(const std::string& expected, const char* actual, size_t actualLen);
+
 }
 
 
@@ -4,9 +4,12 @@
 #include "ITimeSyncController.h"
 #include "TimeSyncCore.h"
 #include "BootAutoSyncPolicy.h"
+#include "EventBus.h"
 #include <string>
 
 // Minimal MVP1 state: draws static title/hints and exits to settings on C short press.
+// With an EventBus the controller status is handled only when SyncStatusChanged arrives;
+// without one it is polled every frame.
 class TimeSyncDisplayState : public IState {
 public:
     TimeSyncDisplayState(ITimeSyncView* view = nullptr, ITimeSyncController* controller = nullptr)
@@ -18,45 +21,40 @@ public:
     void setView(ITimeSyncView* v) { view = v; }
     void setController(ITimeSyncController* c) { controller = c; }
      void setBootAutoSyncPolicy(BootAutoSyncPolicy* p) { bootAutoSyncPolicy = p; }
+    void setEventBus(EventBus* b) {
+        bus = b;
+        subscriber = bus ? bus->subscribe(EventBus::mask(EventTopic::SyncStatusChanged)) : EventBus::kNoSubscriber;
+    }
 
     void onEnter() override {
         step2Drawn = false;
         errorCountdownTicks = 0;
+        // 前回セッションの通知（AppliedOk 等）で即遷移しないよう捨てる
+        if (bus) bus->drain(subscriber);
         drawStep1();
     }
     void onExit() override {}
     void onDraw() override {
         if (controller) {
             controller->loopTick();
-            auto st = controller->getStatus();
-            if (st == ITimeSyncController::Status::Step2) {
-                if (!step2Drawn) {
-                    if (view) {
-                        view->showTitle("TIME SYNC > OPEN URL");
-                        view->showHints("REISSUE", "", "EXIT");
-                        std::string url;
-                        controller->getUrlPayload(url);
-                        view->showUrlQr(url.c_str());
-                    }
-                    step2Drawn = true;
+            const bool counting = errorCountdownTicks > 0;
+            if (bus) {
+                // 通知は起床の合図としてだけ使い、状態はコントローラから読む（enum の対応は getStatus() が持つ）
+                bool changed = false;
+                BusEvent event;
+                while (bus->poll(subscriber, event)) {
+                    changed = changed || event.topic == EventTopic::SyncStatusChanged;
                 }
-            } else if (st == ITimeSyncController::Status::AppliedOk) {
-                if (manager != nullptr && mainDisplayState != nullptr) {
-                    manager->setState(mainDisplayState);
-                }
-            } else if (st == ITimeSyncController::Status::Error) {
+                if (changed) onStatus(controller->getStatus());
+            } else {
+                onStatus(controller->getStatus());
+            }
+            // エラー表示からのカウントダウン（表示したフレームは数えない）
+            if (counting) {
+                errorCountdownTicks--;
                 if (errorCountdownTicks == 0) {
-                    if (view) {
-                        view->showTitle("TIME SYNC > ERROR");
-                        view->showError(controller->getErrorMessage());
-                    }
-                    errorCountdownTicks = 40; // ~2s at ~20Hz
-                } else {
-                    errorCountdownTicks--;
-                    if (errorCountdownTicks == 0) {
-                        if (manager != nullptr && settingsDisplayState != nullptr) {
-                            manager->setState(settingsDisplayState);
-                        }
+                    if (manager != nullptr && settingsDisplayState != nullptr) {
+                        manager->setState(settingsDisplayState);
                     }
                 }
             }
@@ -85,6 +83,33 @@ public:
     void onButtonCLongPress() override { /* unassigned */ }
 
 private:
+    void onStatus(ITimeSyncController::Status st) {
+        if (st == ITimeSyncController::Status::Step2) {
+            if (!step2Drawn) {
+                if (view) {
+                    view->showTitle("TIME SYNC > OPEN URL");
+                    view->showHints("REISSUE", "", "EXIT");
+                    std::string url;
+                    controller->getUrlPayload(url);
+                    view->showUrlQr(url.c_str());
+                }
+                step2Drawn = true;
+            }
+        } else if (st == ITimeSyncController::Status::AppliedOk) {
+            if (manager != nullptr && mainDisplayState != nullptr) {
+                manager->setState(mainDisplayState);
+            }
+        } else if (st == ITimeSyncController::Status::Error) {
+            if (errorCountdownTicks == 0) {
+                if (view) {
+                    view->showTitle("TIME SYNC > ERROR");
+                    view->showError(controller->getErrorMessage());
+                }
+                errorCountdownTicks = 40; // ~2s at ~20Hz
+            }
+        }
+    }
+
     void drawStep1() {
         if (view) {
             view->showTitle("TIME SYNC > JOIN AP");
@@ -106,6 +131,9 @@ private:
     ITimeSyncController* controller;
      BootAutoSyncPolicy* bootAutoSyncPolicy{nullptr};
 
+    EventBus* bus{nullptr};
+    EventBus::SubscriberId subscriber{EventBus::kNoSubscriber};
+
     bool step2Drawn{false};
     int errorCountdownTicks{0};
 };
@@ -12,6 +12,12 @@ std::string toHexN(uint64_t v, int n) {
 }
 }
 
+void TimeSyncLogic::setStatus(Status status) {
+    if (status == status_) return;
+    status_ = status;
+    if (bus_ != nullptr) bus_->publish(EventTopic::SyncStatusChanged, static_cast<int64_t>(status));
+}
+
 auto TimeSyncLogic::makeSsid(uint64_t r) -> std::string {
     return std::string("AIM-TS-") + toHexN(r, 8);
 }
@@ -26,23 +32,23 @@ auto TimeSyncLogic::makeToken(uint64_t r) -> std::string {
 
 void TimeSyncLogic::begin(IRandomProvider* rnd, ITimeService* timeService, uint32_t windowMs) {
     if (rnd == nullptr || timeService == nullptr) {
-        status_ = Status::Error;
+        setStatus(Status::Error);
         lastError_ = "bad_ports";
         return;
     }
     creds_.ssid = makeSsid(rnd->getRandom64());
     creds_.psk = makePsk(rnd->getRandom64());
     creds_.token = makeToken(rnd->getRandom64());
-    startMs_ = static_cast<uint32_t>(timeService->monotonicMillis());
+    startUs_ = timeService->monotonicMicros();
     windowMs_ = windowMs;
     rateConsumed_ = false;
-    status_ = Status::Step1;
+    setStatus(Status::Step1);
     lastError_.clear();
 }
 
 void TimeSyncLogic::reissue(IRandomProvider* rnd) {
     if (rnd == nullptr) {
-        status_ = Status::Error;
+        setStatus(Status::Error);
         lastError_ = "bad_ports";
         return;
     }
@@ -53,7 +59,7 @@ void TimeSyncLogic::reissue(IRandomProvider* rnd) {
 
 void TimeSyncLogic::onStationConnected() {
     if (status_ == Status::Step1) {
-        status_ = Status::Step2;
+        setStatus(Status::Step2);
     }
 }
 
@@ -63,51 +69,76 @@ auto TimeSyncLogic::buildUrlPayload(const std::string& ip) const -> std::string
 
 bool TimeSyncLogic::handleTimeSetRequest(int64_t epochMs, int tzOffsetMin, const std::string& token,
                                          ITimeService* timeService) {
+    TimeSyncCore::TimeSetRequest request{};
+    request.epochMs = epochMs;
+    request.tzOffsetMin = tzOffsetMin;
+    request.token = token.data();
+    request.tokenLen = token.size();
+    return applyTimeSet(request, timeService);
+}
+
+bool TimeSyncLogic::handleTimeSetRequest(const TimeSyncCore::TimeSetRequest& request,
+                                         ITimeService* timeService) {
+    return applyTimeSet(request, timeService);
+}
+
+bool TimeSyncLogic::applyTimeSet(const TimeSyncCore::TimeSetRequest& request, ITimeService* timeService) {
     if (timeService == nullptr) {
-        status_ = Status::Error;
+        setStatus(Status::Error);
         lastError_ = "bad_ports";
         return false;
     }
-    const auto nowMs = static_cast<uint32_t>(timeService->monotonicMillis());
-    if (!TimeSyncCore::isWithinWindow(startMs_, nowMs, windowMs_)) {
-        status_ = Status::Error;
+    if (isWindowExpired(timeService->monotonicMicros())) {
+        setStatus(Status::Error);
         lastError_ = "window_expired";
         return false;
     }
-    if (!TimeSyncCore::verifyToken(creds_.token, token)) {
-        status_ = Status::Error;
+    if (!TimeSyncCore::verifyToken(creds_.token, request.token, request.tokenLen)) {
+        setStatus(Status::Error);
         lastError_ = "invalid_token";
         return false;
     }
     // Rate limit: first attempt consumes the allowance regardless of success
     if (rateConsumed_) {
-        status_ = Status::Error;
+        setStatus(Status::Error);
         lastError_ = "rate_limited";
         return false;
     }
     rateConsumed_ = true;
+    // Project the client clock to now using the round-trip samples (falls back to epochMs)
+    ClockOffsetEstimator::Estimate est{};
+    int64_t epochMs = request.epochMs;
+    int64_t epochUs = epochMs * 1000;
+    if (request.sampleCount > 0 && ClockOffsetEstimator::estimate(request.samples, request.sampleCount, est)) {
+        epochUs = ClockOffsetEstimator::epochUsAt(est, timeService->monotonicMillis());
+        epochMs = epochUs / 1000;
+    } else {
+        est = ClockOffsetEstimator::Estimate{};
+    }
     // Validate epoch range per spec
     const int64_t minEpoch = 1735689600000LL; // 2025-01-01 UTC in ms
     const int64_t maxEpoch = 4102444800000LL; // 2100-01-01 UTC in ms (time_t width dependent in practice)
     if (epochMs < minEpoch || epochMs > maxEpoch) {
-        status_ = Status::Error;
+        setStatus(Status::Error);
         lastError_ = "time_out_of_range";
         return false;
     }
-    if (tzOffsetMin < -14 * 60 || tzOffsetMin > 14 * 60) {
-        status_ = Status::Error;
+    if (request.tzOffsetMin < -14 * 60 || request.tzOffsetMin > 14 * 60) {
+        setStatus(Status::Error);
         lastError_ = "tz_offset_out_of_range";
         return false;
     }
 
-    const time_t sec = static_cast<time_t>(epochMs / 1000);
-    if (!timeService->setSystemTime(sec)) {
-        status_ = Status::Error;
+    if (!timeService->applySyncedTime(epochUs)) {
+        setStatus(Status::Error);
         lastError_ = "apply_failed";
         return false;
     }
-    status_ = Status::AppliedOk;
+    // IANA name (if sent) selects DST-aware rules; the offset is the fallback
+    timeService->applyTimeZone(request.tzName, request.tzNameLen, request.tzOffsetMin);
+    setStatus(Status::AppliedOk);
     lastError_.clear();
+    lastEstimate_ = est;
     return true;
 }
 
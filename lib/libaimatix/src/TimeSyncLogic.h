@@ -6,6 +6,7 @@
 #include "IRandomProvider.h"
 #include "ITimeService.h"
 #include "TimeSyncCore.h"
+#include "EventBus.h"
 
 // Pure logic: manages a single time sync session lifecycle
 class TimeSyncLogic {
@@ -16,6 +17,7 @@ public:
 
     void begin(IRandomProvider* rnd, ITimeService* timeService, uint32_t windowMs = 60000);
     void reissue(IRandomProvider* rnd);
+    // Loop context only (publishes on the EventBus); event-task callbacks must defer to the loop
     void onStationConnected();
     // Override the internally generated token for the session (e.g., when token is issued by adapter)
     void setExpectedToken(const std::string& token) { creds_.token = token; }
@@ -27,35 +29,44 @@ public:
     // Returns true if applied and status becomes AppliedOk
     bool handleTimeSetRequest(int64_t epochMs, int tzOffsetMin, const std::string& token,
                               ITimeService* timeService);
+    // Same as above for a body parsed by TimeSyncCore::parseTimeSetRequest (token is a view).
+    // When round-trip samples are present the applied time is the client clock projected to
+    // the apply moment via ClockOffsetEstimator (µs resolution); epochMs is the fallback.
+    bool handleTimeSetRequest(const TimeSyncCore::TimeSetRequest& request, ITimeService* timeService);
 
-    // Window helpers for controllers/adapters
-    bool isWindowExpired(uint32_t nowMs) const {
-        return !TimeSyncCore::isWithinWindow(startMs_, nowMs, windowMs_);
+    // Window helpers for controllers/adapters (nowUs: ITimeService::monotonicMicros, never wraps)
+    bool isWindowExpired(int64_t nowUs) const {
+        return !TimeSyncCore::isWithinWindowUs(startUs_, nowUs, windowMs_);
     }
-    uint32_t getWindowRemainingMs(uint32_t nowMs) const {
-        if (nowMs >= startMs_ && (nowMs - startMs_) <= windowMs_) {
-            return windowMs_ - (nowMs - startMs_);
-        }
-        // handle wraparound and expired cases conservatively
-        const uint32_t elapsed = nowMs - startMs_;
-        return (elapsed <= windowMs_) ? (windowMs_ - elapsed) : 0u;
+    uint32_t getWindowRemainingMs(int64_t nowUs) const {
+        const int64_t remainUs = static_cast<int64_t>(windowMs_) * 1000 - (nowUs - startUs_);
+        if (nowUs < startUs_ || remainUs <= 0) return 0u;
+        return static_cast<uint32_t>((remainUs + 999) / 1000);
     }
 
     Status getStatus() const { return status_; }
+    // Status transitions are published as SyncStatusChanged (value: Status)
+    void setEventBus(EventBus* bus) { bus_ = bus; }
     const char* getErrorMessage() const { return lastError_.c_str(); }
     const Credentials& getCredentials() const { return creds_; }
+    // Offset estimate used by the last successful apply (used == 0 when epochMs was applied as is)
+    const ClockOffsetEstimator::Estimate& getLastEstimate() const { return lastEstimate_; }
 
 private:
     static std::string makeSsid(uint64_t r);
     static std::string makePsk(uint64_t r);
     static std::string makeToken(uint64_t r);
+    bool applyTimeSet(const TimeSyncCore::TimeSetRequest& request, ITimeService* timeService);
+    void setStatus(Status status);
 
     Credentials creds_{};
     Status status_{Status::Idle};
     std::string lastError_{};
-    uint32_t startMs_{0};
+    int64_t startUs_{0};
     uint32_t windowMs_{60000};
     bool rateConsumed_{false};
+    ClockOffsetEstimator::Estimate lastEstimate_{};
+    EventBus* bus_{nullptr};
 };
 
 
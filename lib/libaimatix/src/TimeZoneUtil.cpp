@@ -2,6 +2,7 @@
 
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <string>
 
 namespace TimeZoneUtil {
@@ -40,6 +41,61 @@ std::string buildPosixTzFromOffsetMinutes(int tzOffsetMinutes) {
     return tz;
 }
 
+// "<+0530>" style abbreviation (east positive)
+static void appendNumericAbbr(std::string& out, int offsetMinutes) {
+    const int absMin = offsetMinutes >= 0 ? offsetMinutes : -offsetMinutes;
+    char buf[16];
+    if (absMin % 60 == 0) {
+        std::snprintf(buf, sizeof(buf), "<%c%02d>", offsetMinutes < 0 ? '-' : '+', absMin / 60);
+    } else {
+        std::snprintf(buf, sizeof(buf), "<%c%02d%02d>", offsetMinutes < 0 ? '-' : '+', absMin / 60, absMin % 60);
+    }
+    out.append(buf);
+}
+
+// ",Mm.w.d/h[:mm]"
+static void appendTransition(std::string& out, const TzTransitionRule& r) {
+    const int absMin = r.timeMin >= 0 ? r.timeMin : -r.timeMin;
+    char buf[32];
+    if (absMin % 60 == 0) {
+        std::snprintf(buf, sizeof(buf), ",M%d.%d.%d/%s%d", r.month, r.week, r.weekday,
+                      r.timeMin < 0 ? "-" : "", absMin / 60);
+    } else {
+        std::snprintf(buf, sizeof(buf), ",M%d.%d.%d/%s%d:%02d", r.month, r.week, r.weekday,
+                      r.timeMin < 0 ? "-" : "", absMin / 60, absMin % 60);
+    }
+    out.append(buf);
+}
+
+std::string buildPosixTzFromRule(const TzRule& rule) {
+    std::string tz;
+    appendNumericAbbr(tz, rule.stdOffsetMin);
+    appendTzOffsetString(tz, rule.stdOffsetMin);
+    if (rule.dstStart.month == 0) {
+        return tz;
+    }
+    appendNumericAbbr(tz, rule.dstOffsetMin);
+    appendTzOffsetString(tz, rule.dstOffsetMin);
+    appendTransition(tz, rule.dstStart);
+    appendTransition(tz, rule.dstEnd);
+    return tz;
+}
+
+const TzZone* findZone(const TzZone* table, size_t count, const char* name, size_t nameLen) {
+    if (table == nullptr || name == nullptr || nameLen == 0) return nullptr;
+    size_t lo = 0;
+    size_t hi = count;
+    while (lo < hi) {
+        const size_t mid = lo + (hi - lo) / 2;
+        const char* key = table[mid].name;
+        int cmp = std::strncmp(key, name, nameLen);
+        if (cmp == 0 && key[nameLen] != '\0') cmp = 1; // key is longer
+        if (cmp == 0) return &table[mid];
+        if (cmp < 0) lo = mid + 1; else hi = mid;
+    }
+    return nullptr;
+}
+
 } // namespace TimeZoneUtil
 
 
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <string>
+#include <cstddef>
+#include "TzRule.h"
 
 namespace TimeZoneUtil {
 
@@ -15,6 +17,19 @@ namespace TimeZoneUtil {
  */
 std::string buildPosixTzFromOffsetMinutes(int tzOffsetMinutes);
 
+/**
+ * Build a DST-aware POSIX TZ string from a compiled rule (numeric abbreviations).
+ * Example (America/New_York): "<-05>5<-04>4,M3.2.0/2,M11.1.0/2"
+ * Keeps libc (mktime/strftime) consistent with CompiledTimeZone.
+ */
+std::string buildPosixTzFromRule(const TzRule& rule);
+
+/**
+ * Binary search of an IANA name in a strcmp-sorted table (name need not be NUL-terminated).
+ * Returns nullptr when not found.
+ */
+const TzZone* findZone(const TzZone* table, size_t count, const char* name, size_t nameLen);
+
 } // namespace TimeZoneUtil
 
 
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * One actuator timeline (backlight, vibration, ...) driven by TimelineScheduler.
+ */
+class ITimelineTrack {
+public:
+    virtual ~ITimelineTrack() = default;
+    // Called at (or after) the scheduled deadline. Return true and set nextMs to stay scheduled.
+    virtual bool onDeadline(uint32_t nowMs, uint32_t& nextMs) = 0;
+};
+
+/**
+ * Min-deadline queue shared by all actuator tracks.
+ * A fixed-capacity indexed binary heap (one entry per track, no allocation), so the
+ * owner needs a single timer armed at nextDeadline() instead of polling every output.
+ * Deadlines are uint32 milliseconds compared wrap-safely (within ±24 days of each other).
+ */
+class TimelineScheduler {
+public:
+    typedef uint8_t TrackId;
+    static constexpr size_t kMaxTracks = 4;
+    static constexpr TrackId kNoTrack = 0xFF;
+
+    TimelineScheduler() : trackCount_(0), size_(0) {
+        for (size_t i = 0; i < kMaxTracks; ++i) {
+            tracks_[i] = nullptr;
+            pos_[i] = kNotQueued;
+        }
+    }
+
+    // kNoTrack when full
+    TrackId addTrack(ITimelineTrack* track) {
+        if (track == nullptr || trackCount_ >= kMaxTracks) return kNoTrack;
+        tracks_[trackCount_] = track;
+        return static_cast<TrackId>(trackCount_++);
+    }
+
+    // (Re)schedule a track; an existing deadline is replaced
+    void schedule(TrackId id, uint32_t atMs) {
+        if (id >= trackCount_) return;
+        if (pos_[id] == kNotQueued) {
+            pos_[id] = static_cast<uint8_t>(size_);
+            heap_[size_] = Entry{atMs, id};
+            ++size_;
+            siftUp(pos_[id]);
+        } else {
+            const size_t i = pos_[id];
+            const uint32_t old = heap_[i].atMs;
+            heap_[i].atMs = atMs;
+            if (before(atMs, old)) siftUp(i); else siftDown(i);
+        }
+    }
+
+    void cancel(TrackId id) {
+        if (id >= trackCount_ || pos_[id] == kNotQueued) return;
+        removeAt(pos_[id]);
+    }
+
+    bool isScheduled(TrackId id) const { return id < trackCount_ && pos_[id] != kNotQueued; }
+
+    // Earliest pending deadline; false when nothing is scheduled (the owner may sleep indefinitely)
+    bool nextDeadline(uint32_t& outMs) const {
+        if (size_ == 0) return false;
+        outMs = heap_[0].atMs;
+        return true;
+    }
+
+    // Service every track whose deadline is <= nowMs, earliest first. Returns the number serviced.
+    size_t runDue(uint32_t nowMs) {
+        size_t serviced = 0;
+        while (size_ > 0 && !before(nowMs, heap_[0].atMs)) {
+            const TrackId id = heap_[0].id;
+            removeAt(0);
+            uint32_t next = 0;
+            if (tracks_[id]->onDeadline(nowMs, next)) {
+                // A deadline in the past would spin here; push it to the next millisecond
+                schedule(id, before(nowMs, next) ? next : nowMs + 1u);
+            }
+            ++serviced;
+        }
+        return serviced;
+    }
+
+private:
+    struct Entry {
+        uint32_t atMs;
+        TrackId id;
+    };
+    static constexpr uint8_t kNotQueued = 0xFF;
+
+    static bool before(uint32_t a, uint32_t b) { return static_cast<int32_t>(a - b) < 0; }
+
+    void swapEntries(size_t a, size_t b) {
+        const Entry t = heap_[a];
+        heap_[a] = heap_[b];
+        heap_[b] = t;
+        pos_[heap_[a].id] = static_cast<uint8_t>(a);
+        pos_[heap_[b].id] = static_cast<uint8_t>(b);
+    }
+
+    void siftUp(size_t i) {
+        while (i > 0) {
+            const size_t parent = (i - 1) / 2;
+            if (!before(heap_[i].atMs, heap_[parent].atMs)) break;
+            swapEntries(i, parent);
+            i = parent;
+        }
+    }
+
+    void siftDown(size_t i) {
+        for (;;) {
+            const size_t l = 2 * i + 1;
+            const size_t r = l + 1;
+            size_t m = i;
+            if (l < size_ && before(heap_[l].atMs, heap_[m].atMs)) m = l;
+            if (r < size_ && before(heap_[r].atMs, heap_[m].atMs)) m = r;
+            if (m == i) return;
+            swapEntries(i, m);
+            i = m;
+        }
+    }
+
+    void removeAt(size_t i) {
+        const TrackId id = heap_[i].id;
+        --size_;
+        if (i != size_) {
+            heap_[i] = heap_[size_];
+            pos_[heap_[i].id] = static_cast<uint8_t>(i);
+            siftUp(i);
+            siftDown(i);
+        }
+        pos_[id] = kNotQueued;
+    }
+
+    ITimelineTrack* tracks_[kMaxTracks];
+    size_t trackCount_;
+    Entry heap_[kMaxTracks];
+    uint8_t pos_[kMaxTracks];
+    size_t size_;
+};
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Compact compiled time zone rule (POSIX "Mm.w.d/time" form), 16 bytes.
+// Offsets are minutes east of UTC (UTC+9 → 540), same sign as tzOffsetMin from the browser.
+// Generated tables live in src/generated/TzDatabase.h (scripts/gen_tz_rules.py).
+struct TzTransitionRule {
+    uint8_t month;    // 1-12; 0 = no DST
+    uint8_t week;     // 1-5 (5 = last week of the month)
+    uint8_t weekday;  // 0 = Sunday
+    int16_t timeMin;  // local wall time of the transition (may exceed 24h, e.g. /26)
+};
+
+struct TzRule {
+    int16_t stdOffsetMin;
+    int16_t dstOffsetMin;      // == stdOffsetMin when the zone has no DST
+    TzTransitionRule dstStart; // wall clock in standard time
+    TzTransitionRule dstEnd;   // wall clock in daylight time
+};
+
+struct TzZone {
+    const char* name; // IANA name, table sorted by strcmp
+    TzRule rule;
+};
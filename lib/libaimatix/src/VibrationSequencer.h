@@ -1,5 +1,6 @@
 #pragma once
 #include <stdint.h>
+#include <algorithm>
 #include <vector>
 #include "IVibration.h"
 
@@ -7,6 +8,10 @@
  * VibrationSequencer drives a vibration output according to a sequence
  * of time segments (durationMs, dutyPercent). This module is pure logic
  * and has no dependency on Arduino/M5.
+ *
+ * loadPattern() compiles the segments into prefix sums (segment end offsets), so
+ * update() is a binary search and the output is written only when the duty changes.
+ * nextChangeAtMs() tells a timer-driven caller when the next edge is due.
  */
 class VibrationSequencer {
 public:
@@ -15,69 +20,110 @@ public:
 		uint8_t dutyPercent; // 0-100
 	};
 
-	VibrationSequencer() : repeat_(false), active_(false), startMs_(0) {}
+	VibrationSequencer() : repeat_(false), active_(false), startMs_(0), lastDuty_(kDutyUnknown) {}
 
 	void loadPattern(const std::vector<Segment>& pattern, bool repeat) {
-		pattern_ = pattern;
+		loadPattern(pattern.data(), pattern.size(), repeat);
+	}
+
+	// Const-table form (see HapticPattern); storage is reused, so reloads do not allocate
+	void loadPattern(const Segment* segments, size_t count, bool repeat) {
+		// 隣接する同一デューティは 1 区間にまとめる（区間境界 = 出力変化点）
+		duties_.clear();
+		endsMs_.clear();
+		uint32_t acc = 0;
+		for (size_t i = 0; i < count; ++i) {
+			const Segment& seg = segments[i];
+			if (seg.durationMs == 0) continue;
+			acc += seg.durationMs;
+			if (!duties_.empty() && duties_.back() == seg.dutyPercent) {
+				endsMs_.back() = acc;
+			} else {
+				duties_.push_back(seg.dutyPercent);
+				endsMs_.push_back(acc);
+			}
+		}
 		repeat_ = repeat;
 	}
 
 	void start(uint32_t nowMs) {
-		if (pattern_.empty()) {
+		if (endsMs_.empty()) {
 			active_ = false;
 			return;
 		}
 		startMs_ = nowMs;
 		active_ = true;
+		lastDuty_ = kDutyUnknown; // first update always writes
 	}
 
 	void stop(IVibrationOutput* output) {
 		active_ = false;
 		if (output) {
-			output->setDutyPercent(0);
+			write(output, 0);
 		}
 	}
 
 	void update(uint32_t nowMs, IVibrationOutput* output) {
-		if (!active_ || pattern_.empty() || output == nullptr) return;
+		if (!active_ || output == nullptr) return;
 
+		const uint32_t total = endsMs_.back();
 		uint32_t elapsed = nowMs - startMs_;
-		uint32_t total = totalDurationMs();
 		if (!repeat_ && elapsed >= total) {
 			active_ = false;
-			output->setDutyPercent(0);
+			write(output, 0);
 			return;
 		}
-
-		if (repeat_ && total > 0) {
+		if (repeat_) {
 			elapsed %= total;
 		}
+		write(output, duties_[segmentIndexAt(elapsed)]);
+	}
 
-		uint32_t acc = 0;
-		for (const auto& seg : pattern_) {
-			if (elapsed < acc + seg.durationMs) {
-				output->setDutyPercent(seg.dutyPercent);
-				return;
-			}
-			acc += seg.durationMs;
+	// Absolute time (same clock as start/update) of the next segment edge after nowMs.
+	// Only meaningful while isActive(); for one-shot patterns the last edge is the end.
+	uint32_t nextChangeAtMs(uint32_t nowMs) const {
+		if (!active_) return nowMs;
+		const uint32_t total = endsMs_.back();
+		const uint32_t elapsed = nowMs - startMs_;
+		if (!repeat_) {
+			if (elapsed >= total) return nowMs;
+			return startMs_ + endsMs_[segmentIndexAt(elapsed)];
 		}
-
-		output->setDutyPercent(0);
+		const uint32_t inCycle = elapsed % total;
+		return nowMs + (endsMs_[segmentIndexAt(inCycle)] - inCycle);
 	}
 
 	bool isActive() const { return active_; }
 
-	uint32_t totalDurationMs() const {
-		uint32_t sum = 0;
-		for (const auto& s : pattern_) sum += s.durationMs;
-		return sum;
-	}
+	uint32_t totalDurationMs() const { return endsMs_.empty() ? 0 : endsMs_.back(); }
 
 private:
-	std::vector<Segment> pattern_;
+	static constexpr uint8_t kDutyUnknown = 0xFF;
+
+	// First segment whose end is after elapsed (elapsed < total)
+	size_t segmentIndexAt(uint32_t elapsed) const {
+		return static_cast<size_t>(std::upper_bound(endsMs_.begin(), endsMs_.end(), elapsed) - endsMs_.begin());
+	}
+
+	void write(IVibrationOutput* output, uint8_t duty) {
+		if (duty == lastDuty_) return;
+		lastDuty_ = duty;
+		output->setDutyPercent(duty);
+	}
+
+	std::vector<uint8_t> duties_;
+	std::vector<uint32_t> endsMs_; // prefix sums: end offset of each segment
 	bool repeat_;
 	bool active_;
 	uint32_t startMs_;
+	uint8_t lastDuty_;
 };
 
-
+/**
+ * Immutable haptic pattern (keep instances in flash: static const, see AlertPatterns).
+ */
+struct HapticPattern {
+	const VibrationSequencer::Segment* segments;
+	uint8_t count;
+	bool repeat;
+};
@@ -0,0 +1,81 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+
+/**
+ * Per-frame view-model diffing shared by all screens.
+ * A state fills a small POD view-model every frame; each model type declares
+ *   enum Field { ..., kFieldCount };  uint32_t fingerprint(size_t field) const;
+ * and ViewModelDiffer returns the fields whose fingerprint differs from what the view last
+ * received, so the state calls only the matching view methods. Fingerprints are the value itself
+ * for small fields and a 32-bit FNV-1a hash for strings and lists (no copies are kept).
+ */
+namespace ViewFingerprint {
+constexpr uint32_t kSeed = 2166136261u;
+
+inline uint32_t mix(uint32_t h, uint32_t v) {
+    for (int i = 0; i < 4; ++i) {
+        h = (h ^ ((v >> (8 * i)) & 0xFFu)) * 16777619u;
+    }
+    return h;
+}
+
+inline uint32_t ofString(const char* s, uint32_t h = kSeed) {
+    if (s == nullptr) return h;
+    for (; *s != '\0'; ++s) {
+        h = (h ^ static_cast<uint8_t>(*s)) * 16777619u;
+    }
+    return h;
+}
+
+inline uint32_t ofTimes(const time_t* values, size_t count, uint32_t h = kSeed) {
+    h = mix(h, static_cast<uint32_t>(count));
+    for (size_t i = 0; i < count; ++i) {
+        const uint64_t v = static_cast<uint64_t>(values[i]);
+        h = mix(mix(h, static_cast<uint32_t>(v)), static_cast<uint32_t>(v >> 32));
+    }
+    return h;
+}
+
+inline uint32_t ofInts(const int* values, size_t count, uint32_t h = kSeed) {
+    h = mix(h, static_cast<uint32_t>(count));
+    for (size_t i = 0; i < count; ++i) {
+        h = mix(h, static_cast<uint32_t>(values[i]));
+    }
+    return h;
+}
+} // namespace ViewFingerprint
+
+template <typename Model>
+class ViewModelDiffer {
+public:
+    typedef uint32_t Mask;
+    static_assert(Model::kFieldCount <= 32, "one mask bit per field");
+
+    ViewModelDiffer() : known_(false) {}
+
+    // After onEnter()/clear(): the view shows nothing, every field is reported once
+    void invalidate() { known_ = false; }
+
+    // Fields of model that differ from the last diff(); records model as shown
+    Mask diff(const Model& model) {
+        Mask changed = 0;
+        for (size_t f = 0; f < static_cast<size_t>(Model::kFieldCount); ++f) {
+            const uint32_t fp = model.fingerprint(f);
+            if (!known_ || fp != shown_[f]) {
+                changed |= bit(f);
+                shown_[f] = fp;
+            }
+        }
+        known_ = true;
+        return changed;
+    }
+
+    static Mask bit(size_t field) { return static_cast<Mask>(1u << field); }
+    static bool has(Mask mask, size_t field) { return (mask & bit(field)) != 0; }
+
+private:
+    uint32_t shown_[Model::kFieldCount];
+    bool known_;
+};
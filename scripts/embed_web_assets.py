@@ -0,0 +1,97 @@
+"""
+Captive portal assets -> flash-resident gzip arrays (PlatformIO pre-script).
+
+web/<name>.html は {{TOKEN}} を1箇所だけ含む。トークン位置で prefix/suffix に分割し、
+  head = gzip header + deflate(prefix) + Z_FULL_FLUSH（バイト境界・非最終ブロック）
+  tail = deflate(suffix) + Z_FINISH（最終ブロック）
+を生成する。実行時は head | stored block(token) | tail | trailer を送出する
+（lib/libaimatix/src/GzipSplice.h 参照）。出力は src/generated/<Name>Asset.h。
+
+PlatformIO から pre: スクリプトとして実行されるほか、単体でも実行可能:
+  python scripts/embed_web_assets.py
+"""
+import hashlib
+import os
+import zlib
+
+PLACEHOLDER = b"{{TOKEN}}"
+ASSETS = [
+    # (source html, output header, C identifier prefix)
+    ("web/sync.html", "src/generated/SyncPageAsset.h", "kSyncPage"),
+]
+
+# mtime=0 / OS=unknown で出力を決定的にする
+GZIP_HEADER = bytes([0x1F, 0x8B, 0x08, 0x00, 0, 0, 0, 0, 0x02, 0xFF])
+
+
+def _deflate(data, flush_mode):
+    comp = zlib.compressobj(9, zlib.DEFLATED, -15, 9)
+    return comp.compress(data) + comp.flush(flush_mode)
+
+
+def _minify(html):
+    # 行頭インデントと改行、行単位の // コメントを除去
+    # （行を連結するため JS は文末に ; を付け、文字列リテラルは1行で記述すること）
+    lines = [line.strip() for line in html.splitlines()]
+    return b"".join(line for line in lines if line and not line.startswith(b"//"))
+
+
+def _c_array(name, data):
+    rows = []
+    for i in range(0, len(data), 16):
+        rows.append("    " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    return "static const uint8_t %s[] PROGMEM = {\n%s\n};\n" % (name, "\n".join(rows))
+
+
+def build_asset(src_path, ident):
+    with open(src_path, "rb") as f:
+        html = _minify(f.read())
+    if html.count(PLACEHOLDER) != 1:
+        raise ValueError("%s must contain exactly one %s" % (src_path, PLACEHOLDER.decode()))
+    prefix, suffix = html.split(PLACEHOLDER)
+    head = GZIP_HEADER + _deflate(prefix, zlib.Z_FULL_FLUSH)
+    tail = _deflate(suffix, zlib.Z_FINISH)
+    etag = hashlib.sha1(html).hexdigest()[:12]
+
+    out = []
+    out.append("// Generated by scripts/embed_web_assets.py from %s - do not edit.\n" % src_path)
+    out.append("// Source %d bytes -> gzip %d bytes (+ spliced token).\n" % (len(html), len(head) + len(tail)))
+    out.append("#pragma once\n\n#include <cstdint>\n#include \"GzipSplice.h\"\n")
+    out.append("#ifdef ARDUINO\n#include <pgmspace.h>\n#else\n#define PROGMEM\n#endif\n\n")
+    out.append(_c_array(ident + "Head", head))
+    out.append(_c_array(ident + "Tail", tail))
+    out.append(
+        "\nstatic const GzipSplice::SplicedAsset %sAsset = {\n"
+        "    %sHead, sizeof(%sHead),\n"
+        "    %sTail, sizeof(%sTail),\n"
+        "    0x%08xu, %du,\n"
+        "    0x%08xu, %du,\n"
+        "    \"%s\",\n"
+        "};\n" % (ident, ident, ident, ident, ident,
+                  zlib.crc32(prefix) & 0xFFFFFFFF, len(prefix),
+                  zlib.crc32(suffix) & 0xFFFFFFFF, len(suffix), etag))
+    return "".join(out)
+
+
+def generate(project_dir):
+    for src, dst, ident in ASSETS:
+        src_path = os.path.join(project_dir, src)
+        dst_path = os.path.join(project_dir, dst)
+        content = build_asset(src_path, ident).replace(src_path, src)
+        current = None
+        if os.path.exists(dst_path):
+            with open(dst_path, "r") as f:
+                current = f.read()
+        if current != content:  # 変更時のみ書き込み（不要な再ビルドを避ける）
+            os.makedirs(os.path.dirname(dst_path), exist_ok=True)
+            with open(dst_path, "w", newline="\n") as f:
+                f.write(content)
+            print("[embed_web_assets] generated %s" % dst)
+
+
+try:
+    Import("env")  # noqa: F821 (PlatformIO SCons)
+    generate(env.subst("$PROJECT_DIR"))  # noqa: F821
+except NameError:
+    if __name__ == "__main__":
+        generate(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
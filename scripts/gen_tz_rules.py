@@ -0,0 +1,102 @@
+"""
+Curated IANA zones -> compact compiled rules in flash (PlatformIO pre-script).
+
+scripts/tz_zones.csv（"<IANA名>,<POSIX TZ>"）を読み、各ゾーンを TzRule（16 バイト）へ
+コンパイルして src/generated/TzDatabase.h に名前順で出力する。実行時は二分探索で
+名前を引き、CompiledTimeZone が当年の遷移時刻をキャッシュして O(1) で UTC→ローカル変換する
+（lib/libaimatix/src/TzRule.h, CompiledTimeZone.h 参照）。
+
+PlatformIO から pre: スクリプトとして実行されるほか、単体でも実行可能:
+  python scripts/gen_tz_rules.py
+"""
+import os
+import re
+
+SRC = "scripts/tz_zones.csv"
+DST = "src/generated/TzDatabase.h"
+
+_NAME = r"(?:<[^>]+>|[A-Za-z]{3,})"
+_OFFSET = r"[+-]?\d{1,3}(?::\d{2}){0,2}"
+_RULE = r"M(\d{1,2})\.(\d)\.(\d)(?:/([+-]?\d{1,3}(?::\d{2}){0,2}))?"
+_POSIX = re.compile(
+    r"^(%s)(%s)(?:(%s)(%s)?(?:,%s,%s)?)?$" % (_NAME, _OFFSET, _NAME, _OFFSET, _RULE, _RULE))
+
+
+def _hms_to_minutes(text):
+    sign = -1 if text.startswith("-") else 1
+    parts = [int(p) for p in text.lstrip("+-").split(":")]
+    while len(parts) < 3:
+        parts.append(0)
+    if parts[2] != 0:
+        raise ValueError("seconds in offsets are not supported: %s" % text)
+    return sign * (parts[0] * 60 + parts[1])
+
+
+def compile_posix(tz):
+    """POSIX TZ -> (stdOffsetMin, dstOffsetMin, start, end); offsets east positive."""
+    m = _POSIX.match(tz)
+    if not m:
+        raise ValueError("unsupported POSIX TZ: %s" % tz)
+    std_off = -_hms_to_minutes(m.group(2))
+    if m.group(3) is None:
+        return std_off, std_off, (0, 0, 0, 0), (0, 0, 0, 0)
+    dst_off = -_hms_to_minutes(m.group(4)) if m.group(4) else std_off + 60
+    if m.group(5) is None:
+        raise ValueError("DST without transition rules: %s" % tz)
+    rules = []
+    for base in (5, 9):
+        month, week, wday = int(m.group(base)), int(m.group(base + 1)), int(m.group(base + 2))
+        time = _hms_to_minutes(m.group(base + 3)) if m.group(base + 3) else 120
+        if not (1 <= month <= 12 and 1 <= week <= 5 and 0 <= wday <= 6):
+            raise ValueError("bad transition rule: %s" % tz)
+        rules.append((month, week, wday, time))
+    return std_off, dst_off, rules[0], rules[1]
+
+
+def build_header(src_path):
+    zones = []
+    with open(src_path, "r") as f:
+        for line in f:
+            line = line.strip()
+            if not line or line.startswith("#"):
+                continue
+            name, posix = line.split(",", 1)
+            zones.append((name, compile_posix(posix), posix))
+    zones.sort(key=lambda z: z[0].encode())  # strcmp 順（二分探索用）
+    out = [
+        "// Generated by scripts/gen_tz_rules.py from %s - do not edit.\n" % SRC,
+        "// %d zones x %d bytes of rules (+ names), sorted by name for binary search.\n" % (len(zones), 16),
+        "#pragma once\n\n",
+        "#include \"TzRule.h\"\n\n",
+        "static const TzZone kTzZones[] = {\n",
+    ]
+    for name, (std_off, dst_off, start, end), posix in zones:
+        out.append("    { \"%s\", { %d, %d, { %d, %d, %d, %d }, { %d, %d, %d, %d } } }, // %s\n" % (
+            name, std_off, dst_off, start[0], start[1], start[2], start[3],
+            end[0], end[1], end[2], end[3], posix))
+    out.append("};\n")
+    out.append("static const size_t kTzZoneCount = sizeof(kTzZones) / sizeof(kTzZones[0]);\n")
+    return "".join(out)
+
+
+def generate(project_dir):
+    src_path = os.path.join(project_dir, SRC)
+    dst_path = os.path.join(project_dir, DST)
+    content = build_header(src_path)
+    current = None
+    if os.path.exists(dst_path):
+        with open(dst_path, "r") as f:
+            current = f.read()
+    if current != content:  # 変更時のみ書き込み（不要な再ビルドを避ける）
+        os.makedirs(os.path.dirname(dst_path), exist_ok=True)
+        with open(dst_path, "w", newline="\n") as f:
+            f.write(content)
+        print("[gen_tz_rules] generated %s" % DST)
+
+
+try:
+    Import("env")  # noqa: F821 (PlatformIO SCons)
+    generate(env.subst("$PROJECT_DIR"))  # noqa: F821
+except NameError:
+    if __name__ == "__main__":
+        generate(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
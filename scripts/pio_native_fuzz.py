@@ -0,0 +1,9 @@
+# PlatformIO pre-script for env:native-fuzz
+# - libFuzzer は clang 専用のためツールチェーンを clang/clang++ に差し替える
+# - sanitizer フラグはコンパイル・リンクの両方に必要
+Import("env")
+
+SANITIZE = "-fsanitize=fuzzer,address,undefined"
+
+env.Replace(CC="clang", CXX="clang++", LINK="clang++")
+env.Append(CCFLAGS=[SANITIZE], LINKFLAGS=[SANITIZE])
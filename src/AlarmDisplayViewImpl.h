@@ -26,9 +26,9 @@ public:
         }
         
         // 前回より項目が減った場合、減った分の領域をクリア
-        if (alarms.size() < lastDisplayedAlarms.size()) {
+        if (alarms.size() < lastDisplayedCount) {
             const int clearStartY = ALARM_DISPLAY_START_Y + alarms.size() * ALARM_LINE_HEIGHT - ALARM_BACKGROUND_OFFSET;
-            const int clearHeight = (std::min(static_cast<int>(lastDisplayedAlarms.size()), ALARM_MAX_DISPLAY) - static_cast<int>(alarms.size())) * ALARM_LINE_HEIGHT;
+            const int clearHeight = (std::min(static_cast<int>(lastDisplayedCount), ALARM_MAX_DISPLAY) - static_cast<int>(alarms.size())) * ALARM_LINE_HEIGHT;
             if (clearHeight > 0) {
                 disp->fillRect(0, clearStartY, SCREEN_WIDTH, clearHeight, TFT_BLACK);
             }
@@ -63,7 +63,7 @@ public:
         disp->setTextColor(AMBER_COLOR, TFT_BLACK);
         
         // 現在の状態を記憶
-        lastDisplayedAlarms = alarms;
+        lastDisplayedCount = alarms.size();
     }
     
     void showNoAlarms() override {
@@ -72,8 +72,8 @@ public:
         }
         
         // 前回アラームがあった場合は、その領域をクリア
-        if (!lastDisplayedAlarms.empty()) {
-            const int clearHeight = std::min(static_cast<int>(lastDisplayedAlarms.size()), ALARM_MAX_DISPLAY) * ALARM_LINE_HEIGHT;
+        if (lastDisplayedCount != 0) {
+            const int clearHeight = std::min(static_cast<int>(lastDisplayedCount), ALARM_MAX_DISPLAY) * ALARM_LINE_HEIGHT;
             disp->fillRect(0, ALARM_DISPLAY_START_Y - ALARM_BACKGROUND_OFFSET, SCREEN_WIDTH, clearHeight, TFT_BLACK);
         }
         
@@ -83,16 +83,17 @@ public:
         disp->drawText(SCREEN_WIDTH / 2, SCREEN_HEIGHT / 2, "NO ALARMS", FONT_AUXILIARY);
         
         // 空リスト状態を記憶
-        lastDisplayedAlarms.clear();
+        lastDisplayedCount = 0;
     }
     
+    // 画面遷移: 本文領域のみクリア（タイトル/ヒントは ChromeCache との差分だけ描き直す）
     void clear() override {
         if (disp) {
-            disp->clear();
+            disp->clearBody();
         }
     }
     
 private:
     IDisplay* disp;
-    std::vector<time_t> lastDisplayedAlarms;
+    size_t lastDisplayedCount = 0; // 前回表示した行数（減った行の消去用）
 }; 
\ No newline at end of file
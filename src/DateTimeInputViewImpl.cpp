@@ -9,7 +9,8 @@
 
 void DateTimeInputViewImpl::clear() {
     if (disp != nullptr) {
-        disp->clear();
+        // 本文領域のみクリア（タイトル/ヒントは ChromeCache との差分だけ描き直す）
+        disp->clearBody();
         // 状態をリセット
         lastCursorPosition = -1;
         lastDateTimeStr = "";
@@ -6,6 +6,7 @@
 #include <memory>
 // 色定数を追加
 #include "ui_constants.h"
+#include "ChromeCache.h"
 
 
 
@@ -13,6 +14,39 @@ class DisplayAdapter : public IDisplay {
 public:
     void clear() override {
         M5.Display.fillScreen(TFT_BLACK);
+        chrome_.invalidate();
+    }
+
+    // 画面遷移: タイトルバー下の区切り線からヒント上の区切り線までの本文だけを消す
+    void clearBody() override {
+        M5.Display.fillRect(0, TITLE_HEIGHT, SCREEN_WIDTH, SCREEN_HEIGHT - TITLE_HEIGHT - HINT_HEIGHT, TFT_BLACK);
+    }
+
+    ChromeCache* chromeCache() override {
+        return &chrome_;
+    }
+
+    // タイトル/ヒントのセルは 1bpp スプライトに一度だけ描き、以降は転送のみ（セル 1 個 = 1 ウィンドウ）
+    void drawTextCell(int x, int y, int w, int h, int textX, int textY, const char* text, int font,
+                      uint16_t color, uint16_t bgColor) override {
+        const char* s = text != nullptr ? text : "";
+        const uint32_t key = cellKey(x, y, w, h, s, font, color, bgColor);
+        M5Canvas* sprite = nullptr;
+        for (size_t i = 0; i < kCellSlots; ++i) {
+            if (cellSprites_[i] && cellKeys_[i] == key) {
+                sprite = cellSprites_[i].get();
+                break;
+            }
+        }
+        if (sprite == nullptr) {
+            sprite = renderCell(key, w, h, textX - x, textY - y, s, font, color, bgColor);
+        }
+        if (sprite == nullptr) {
+            // スプライトが確保できない場合は直接描画
+            IDisplay::drawTextCell(x, y, w, h, textX, textY, s, font, color, bgColor);
+            return;
+        }
+        sprite->pushSprite(x, y);
     }
     
     void drawText(int x, int y, const char* text, int fontSize) override {
@@ -55,6 +89,16 @@ public:
     }
 
 public:
+    // アイドルスリープ（IdleSleepManager）: パネルをスリープ/復帰。スリープ中も GRAM は保持されるため、
+    // 復帰時に clear/全面再描画は不要（各ビューの差分キャッシュと画面内容が一致したまま）
+    void sleepPanel() {
+        M5.Display.sleep();
+    }
+
+    void wakePanel() {
+        M5.Display.wakeup();
+    }
+
 #ifdef ENABLE_FILL_BENCH
     void runFillBench() {
         const int W = SCREEN_WIDTH;
@@ -82,6 +126,63 @@ private:
         }
     }
 
+    // 1bpp パレットスプライト: 107x19 で約 260 バイト。画面 5 種のタイトル/ヒントが収まる数
+    static constexpr size_t kCellSlots = 16;
+
+    static uint32_t cellKey(int x, int y, int w, int h, const char* text, int font, uint16_t color, uint16_t bgColor) {
+        // FNV-1a（ジオメトリ・色・フォント・文字列）
+        uint32_t hsh = 2166136261u;
+        const int32_t params[7] = { x, y, w, h, font, color, bgColor };
+        for (int32_t v : params) {
+            hsh = (hsh ^ static_cast<uint32_t>(v)) * 16777619u;
+        }
+        for (const char* p = text; *p != '\0'; ++p) {
+            hsh = (hsh ^ static_cast<uint8_t>(*p)) * 16777619u;
+        }
+        return hsh;
+    }
+
+    static void setPalette(M5Canvas& canvas, size_t index, uint16_t rgb565) {
+        const uint8_t r = static_cast<uint8_t>(((rgb565 >> 11) & 0x1F) * 255 / 31);
+        const uint8_t g = static_cast<uint8_t>(((rgb565 >> 5) & 0x3F) * 255 / 63);
+        const uint8_t b = static_cast<uint8_t>((rgb565 & 0x1F) * 255 / 31);
+        canvas.setPaletteColor(index, r, g, b);
+    }
+
+    M5Canvas* renderCell(uint32_t key, int w, int h, int textDx, int textDy, const char* text, int font,
+                         uint16_t color, uint16_t bgColor) {
+        // 空きスロット、なければ古い順に置き換え
+        const size_t slot = nextCellSlot_;
+        nextCellSlot_ = (nextCellSlot_ + 1) % kCellSlots;
+        if (!cellSprites_[slot]) {
+            cellSprites_[slot] = std::unique_ptr<M5Canvas>(new M5Canvas(&M5.Display));
+        } else {
+            cellSprites_[slot]->deleteSprite();
+        }
+        M5Canvas& canvas = *cellSprites_[slot];
+        canvas.setColorDepth(1);
+        if (canvas.createSprite(w, h) == nullptr) {
+            cellKeys_[slot] = 0;
+            return nullptr;
+        }
+        setPalette(canvas, 0, bgColor);
+        setPalette(canvas, 1, color);
+        canvas.fillSprite(0);
+        if (text[0] != '\0') {
+            canvas.setTextFont(font);
+            canvas.setTextColor(1, 0);
+            canvas.setTextDatum(textdatum_t::top_left);
+            canvas.drawString(text, textDx, textDy);
+        }
+        cellKeys_[slot] = key;
+        return &canvas;
+    }
+
+    ChromeCache chrome_;
+    std::unique_ptr<M5Canvas> cellSprites_[kCellSlots];
+    uint32_t cellKeys_[kCellSlots] = {};
+    size_t nextCellSlot_ = 0;
+
     std::unique_ptr<M5Canvas> overlaySprite_;
     int overlayW_ = 0;
     int overlayH_ = 0;
@@ -0,0 +1,59 @@
+#pragma once
+#include <Arduino.h>
+#if defined(CONFIG_PM_ENABLE)
+#include <esp_pm.h>
+#endif
+
+/**
+ * EspCpuClock applies CpuFrequencyGovernor decisions.
+ * - Without power management: setCpuFrequencyMhz() on change (APB stays at 80MHz, so
+ *   timers, UART and SPI keep their rates).
+ * - With CONFIG_PM_ENABLE: esp_pm scales between 80 and 240MHz; any clock above 80MHz
+ *   holds an ESP_PM_CPU_FREQ_MAX lock, 80MHz releases it (and lets tickless idle sleep).
+ */
+class EspCpuClock {
+public:
+	void begin() {
+#if defined(CONFIG_PM_ENABLE)
+		esp_pm_config_esp32_t pm = {};
+		pm.max_freq_mhz = 240;
+		pm.min_freq_mhz = 80;
+#if defined(CONFIG_FREERTOS_USE_TICKLESS_IDLE)
+		// Tickless idle: 長いフレーム待機中は自動 light sleep
+		pm.light_sleep_enable = true;
+#endif
+		const esp_err_t err = esp_pm_configure(&pm);
+		if (err == ESP_OK) {
+			pmActive_ = esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "governor", &maxLock_) == ESP_OK;
+		}
+		Serial.printf("[BOOT] esp_pm: %d\n", static_cast<int>(err));
+#endif
+		appliedMhz_ = static_cast<uint16_t>(getCpuFrequencyMhz());
+	}
+
+	void apply(uint16_t mhz) {
+		if (mhz == appliedMhz_) return;
+#if defined(CONFIG_PM_ENABLE)
+		if (pmActive_) {
+			const bool wantMax = mhz > 80;
+			if (wantMax != lockHeld_) {
+				if (wantMax) esp_pm_lock_acquire(maxLock_); else esp_pm_lock_release(maxLock_);
+				lockHeld_ = wantMax;
+			}
+			appliedMhz_ = mhz;
+			return;
+		}
+#endif
+		if (setCpuFrequencyMhz(mhz)) appliedMhz_ = mhz;
+	}
+
+	uint16_t appliedMhz() const { return appliedMhz_; }
+
+private:
+	uint16_t appliedMhz_ = 240;
+#if defined(CONFIG_PM_ENABLE)
+	esp_pm_lock_handle_t maxLock_ = nullptr;
+	bool pmActive_ = false;
+	bool lockHeld_ = false;
+#endif
+};
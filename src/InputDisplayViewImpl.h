@@ -69,8 +69,9 @@ public:
         disp->drawText(x0, y0, ":", FONT_IMPORTANT);
         disp->setTextDatum(prevDatum);
     }
+    // 画面遷移: 本文領域のみクリア（タイトル/ヒントは ChromeCache との差分だけ描き直す）
     void clear() override {
-        disp->clear();
+        disp->clearBody();
     }
 private:
     IDisplay* disp;
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <mutex>
+
+/**
+ * Serializes the M5 internal I2C bus (touch, PMIC, RTC; on Core2 also vibration and
+ * backlight via the AXP192). The bus is used by the logic tick task (M5.update, PMIC
+ * samples), the UI task (RTC writes) and the actuator timer; M5Unified does not lock it.
+ * Hold it only around the bus transaction itself. Any new caller on a task other than the
+ * loop (esp_timer callbacks included) must take it as well.
+ * Lock order: M5ActuatorTimeline's mutex, then this one (never the reverse).
+ */
+inline std::mutex& internalBusMutex() {
+	static std::mutex mutex;
+	return mutex;
+}
+
+typedef std::lock_guard<std::mutex> InternalBusGuard;
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <esp_timer.h>
+#include "ActuatorTimeline.h"
+#include "IBacklightAnimator.h"
+#include "IBacklight.h"
+#include "M5BacklightAdapter.h"
+#ifdef M5STACK_CORE2
+#include "Core2VibrationAdapter.h"
+#endif
+
+/**
+ * Device owner of ActuatorTimeline: one one-shot esp_timer, always armed at the
+ * earliest pending deadline of any track (backlight fade steps/edges, vibration edges).
+ * Nothing runs between deadlines and the main loop never polls actuators.
+ * Also the IBacklight for direct writes so getLastBrightness() stays accurate.
+ * A mutex serializes the timer task and the main loop; stop() is synchronous.
+ * Backlight/vibration writes run on the esp_timer task; the adapters take the internal
+ * bus lock (InternalBusLock.h) inside this mutex, as on Core2 both are AXP192 I2C writes.
+ */
+class M5ActuatorTimeline : public IBacklightAnimator, public IBacklight {
+public:
+	M5ActuatorTimeline()
+#ifdef M5STACK_CORE2
+		: timeline_(&backlightOut_, &vibrationOut_),
+#else
+		: timeline_(&backlightOut_, nullptr),
+#endif
+		  timer_(nullptr) {}
+
+	void begin() {
+		if (timer_ != nullptr) return;
+		esp_timer_create_args_t args{};
+		args.callback = &M5ActuatorTimeline::onTimer;
+		args.arg = this;
+		args.dispatch_method = ESP_TIMER_TASK;
+		args.name = "actuators";
+		if (esp_timer_create(&args, &timer_) != ESP_OK) {
+			timer_ = nullptr;
+		}
+	}
+
+	// IBacklightAnimator
+	void play(const BacklightPattern& pattern) override {
+		std::lock_guard<std::mutex> lock(mutex_);
+		const uint32_t nowMs = nowMillis();
+		timeline_.playBacklight(pattern, nowMs);
+		serviceLocked(nowMs);
+	}
+	void playAlert(const BacklightPattern& pattern, const HapticPattern& haptics) override {
+		std::lock_guard<std::mutex> lock(mutex_);
+		const uint32_t nowMs = nowMillis();
+		timeline_.playAlert(pattern, haptics, nowMs);
+		serviceLocked(nowMs);
+	}
+	void stop() override {
+		std::lock_guard<std::mutex> lock(mutex_);
+		timeline_.stopAll();
+		rearmLocked(nowMillis());
+	}
+	bool isActive() const override {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return timeline_.isBacklightActive();
+	}
+	uint8_t getLastBrightness() const override {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return timeline_.getLastBrightness();
+	}
+
+	// IBacklight
+	void setBrightness(uint8_t brightness) override {
+		std::lock_guard<std::mutex> lock(mutex_);
+		timeline_.setBrightness(brightness);
+	}
+
+	// Button feedback etc. (no-op without a vibration motor)
+	void playHaptics(const HapticPattern& pattern) {
+		std::lock_guard<std::mutex> lock(mutex_);
+		const uint32_t nowMs = nowMillis();
+		timeline_.playHaptics(pattern, nowMs);
+		serviceLocked(nowMs);
+	}
+	bool isHapticsActive() const {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return timeline_.isHapticsActive();
+	}
+
+private:
+	static void onTimer(void* arg) {
+		M5ActuatorTimeline* self = static_cast<M5ActuatorTimeline*>(arg);
+		std::lock_guard<std::mutex> lock(self->mutex_);
+		self->serviceLocked(nowMillis());
+	}
+
+	// Apply due edges right away (the first edge of a new pattern is due now), then re-arm
+	void serviceLocked(uint32_t nowMs) {
+		timeline_.runDue(nowMs);
+		rearmLocked(nowMs);
+	}
+
+	void rearmLocked(uint32_t nowMs) {
+		if (timer_ == nullptr) return;
+		esp_timer_stop(timer_); // start_once fails on an armed timer
+		uint32_t dueMs = 0;
+		if (!timeline_.nextDeadline(dueMs)) return; // idle: no wakeups at all
+		const int32_t delayMs = static_cast<int32_t>(dueMs - nowMs);
+		esp_timer_start_once(timer_, delayMs <= 0 ? 1ULL : static_cast<uint64_t>(delayMs) * 1000ULL);
+	}
+
+	static uint32_t nowMillis() { return static_cast<uint32_t>(esp_timer_get_time() / 1000); }
+
+	M5BacklightAdapter backlightOut_;
+#ifdef M5STACK_CORE2
+	Core2VibrationAdapter vibrationOut_;
+#endif
+	ActuatorTimeline timeline_;
+	esp_timer_handle_t timer_;
+	mutable std::mutex mutex_;
+};
@@ -4,15 +4,18 @@
 #include <algorithm>
 #include <M5Unified.h>
 #include "IBacklight.h"
+#include "InternalBusLock.h"
 
 /**
  * M5Unified adapter for backlight brightness.
  * Accepts 0-255 and clamps to device-acceptable range (0-255 for M5.Display).
+ * Core2 drives the backlight through the AXP192, so the write holds the internal bus.
  */
 class M5BacklightAdapter : public IBacklight {
 public:
 	void setBrightness(uint8_t brightness) override {
 		const uint8_t clamped = std::min<uint8_t>(255, std::max<uint8_t>(0, brightness));
+		InternalBusGuard bus(internalBusMutex());
 		M5.Display.setBrightness(clamped);
 	}
 };
@@ -0,0 +1,46 @@
+#pragma once
+#include <M5Unified.h>
+#include <mutex>
+#include "BatteryTelemetry.h"
+#include "InternalBusLock.h"
+
+/**
+ * M5PowerTelemetry samples the PMIC (AXP192 on Core2, IP5306 on Fire) at a low rate
+ * and serves the smoothed, cached values through IPowerTelemetry.
+ * poll() runs on the logic tick task next to M5.update() and holds the internal bus lock
+ * for the PMIC reads. Between samples poll() is a timestamp comparison; readers (UI task)
+ * never touch the bus and only take the cache lock.
+ */
+class M5PowerTelemetry : public IPowerTelemetry {
+public:
+	void poll(uint32_t nowMs) {
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			if (!cache_.isSampleDue(nowMs)) return;
+		}
+		int32_t level = 0;
+		int16_t mv = 0;
+		bool charging = false;
+		{
+			InternalBusGuard bus(internalBusMutex());
+			level = M5.Power.getBatteryLevel();
+			mv = M5.Power.getBatteryVoltage();
+			charging = M5.Power.isCharging() == m5::Power_Class::is_charging;
+		}
+		std::lock_guard<std::mutex> lock(mutex_);
+		cache_.addSample(nowMs, static_cast<int>(level), mv > 0 ? static_cast<uint16_t>(mv) : 0, charging);
+	}
+
+	BatteryStatus batteryStatus() const override {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return cache_.batteryStatus();
+	}
+	uint32_t generation() const override {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return cache_.generation();
+	}
+
+private:
+	mutable std::mutex mutex_;
+	BatteryTelemetry cache_;
+};
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <M5Unified.h>
+#include <Preferences.h>
+#include "IRtc.h"
+#include "RtcTimeService.h"
+#include "CivilTime.h"
+#include "InternalBusLock.h"
+#include <cstring>
+
+/**
+ * M5Unified adapter for the on-board BM8563 RTC (Fire/Core2).
+ * Stores UTC. The VL (voltage-low) flag maps to integrityLost.
+ * The timezone lives in NVS ("clock"/"tz_name", "tz_off_min") since the RTC has no spare RAM.
+ */
+class M5RtcAdapter : public IRtc {
+public:
+	bool read(RtcDateTime& out, bool& integrityLost) override {
+		if (!M5.Rtc.isEnabled()) return false;
+		rtc_datetime_t dt;
+		{
+			InternalBusGuard bus(internalBusMutex());
+			if (!M5.Rtc.getDateTime(&dt)) return false;
+			integrityLost = M5.Rtc.getVoltLow();
+		}
+		out.year = dt.date.year;
+		out.month = dt.date.month;
+		out.day = dt.date.date;
+		out.hour = dt.time.hours;
+		out.minute = dt.time.minutes;
+		out.second = dt.time.seconds;
+		return true;
+	}
+
+	bool write(const RtcDateTime& value) override {
+		if (!M5.Rtc.isEnabled()) return false;
+		time_t epoch = 0;
+		if (!RtcTimeService::toEpoch(value, epoch)) return false;
+		rtc_datetime_t dt;
+		dt.date.year = static_cast<int16_t>(value.year);
+		dt.date.month = static_cast<int8_t>(value.month);
+		dt.date.date = static_cast<int8_t>(value.day);
+		dt.date.weekDay = static_cast<int8_t>(CivilTime::weekdayFromDays(epoch / 86400));
+		dt.time.hours = static_cast<int8_t>(value.hour);
+		dt.time.minutes = static_cast<int8_t>(value.minute);
+		dt.time.seconds = static_cast<int8_t>(value.second);
+		InternalBusGuard bus(internalBusMutex());
+		M5.Rtc.setDateTime(dt); // 書き込みで VL フラグもクリアされる
+		return true;
+	}
+
+	bool loadTimeZone(char* name, size_t cap, int& offsetMinutes) override {
+		if (cap == 0) return false;
+		Preferences prefs;
+		if (!prefs.begin(kNvsNamespace, true)) return false;
+		const bool has = prefs.isKey(kNvsTzOffsetKey);
+		if (has) {
+			offsetMinutes = prefs.getInt(kNvsTzOffsetKey, 0);
+			name[0] = '\0';
+			if (prefs.isKey(kNvsTzNameKey)) prefs.getString(kNvsTzNameKey, name, cap);
+			name[cap - 1] = '\0';
+		}
+		prefs.end();
+		return has;
+	}
+
+	void saveTimeZone(const char* name, size_t nameLen, int offsetMinutes) override {
+		char value[RtcTimeService::kTzNameMaxLen + 1] = {};
+		if (nameLen > RtcTimeService::kTzNameMaxLen) nameLen = 0;
+		if (nameLen > 0) std::memcpy(value, name, nameLen);
+		Preferences prefs;
+		if (!prefs.begin(kNvsNamespace, false)) return;
+		// 変化時のみ書き込み（フラッシュ摩耗対策）
+		if (!prefs.isKey(kNvsTzOffsetKey) || prefs.getInt(kNvsTzOffsetKey, 0) != offsetMinutes) {
+			prefs.putInt(kNvsTzOffsetKey, offsetMinutes);
+		}
+		char stored[RtcTimeService::kTzNameMaxLen + 1] = {};
+		if (prefs.isKey(kNvsTzNameKey)) prefs.getString(kNvsTzNameKey, stored, sizeof(stored));
+		if (!prefs.isKey(kNvsTzNameKey) || std::strcmp(stored, value) != 0) {
+			prefs.putString(kNvsTzNameKey, value);
+		}
+		prefs.end();
+	}
+
+private:
+	static constexpr const char* kNvsNamespace = "clock";
+	static constexpr const char* kNvsTzOffsetKey = "tz_off_min";
+	static constexpr const char* kNvsTzNameKey = "tz_name";
+};
@@ -0,0 +1,18 @@
+#include "M5TimeService.h"
+#include "../lib/libaimatix/src/TimeZoneUtil.h"
+#include "generated/TzDatabase.h"
+#include <stdlib.h>
+
+void M5TimeService::applyTimeZone(const char* ianaName, size_t nameLen, int offsetMinutes) {
+    const TzZone* zone = TimeZoneUtil::findZone(kTzZones, kTzZoneCount, ianaName, nameLen);
+    if (zone != nullptr) {
+        zone_.setRule(zone->rule);
+    } else {
+        // 未収録の名前・名前なし → ブラウザの現在オフセット固定（DST 切替は次回同期まで追従しない）
+        zone_.setFixedOffset(offsetMinutes);
+    }
+    // strftime/mktime 等 libc 側も同じ規則に揃える
+    const std::string tz = TimeZoneUtil::buildPosixTzFromRule(zone_.rule());
+    setenv("TZ", tz.c_str(), 1);
+    tzset();
+}
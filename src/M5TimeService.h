@@ -1,20 +1,108 @@
 #pragma once
 #include "../lib/libaimatix/src/ITimeService.h"
+#include "../lib/libaimatix/src/ClockDiscipline.h"
+#include "../lib/libaimatix/src/CompiledTimeZone.h"
 #include <Arduino.h>
+#include <Preferences.h>
 #include <sys/time.h>
+#include <esp_timer.h>
 
 // Arduino/M5Stack implementation of ITimeService
+// - Syncs within ClockDiscipline::stepThresholdUs() (≈0.9 s, converges within 3 min) are slewed via adjtime (no jumps)
+// - Drift estimate persists in NVS ("clock"/"drift_ppb") and is compensated every frame
+// - localtime() converts with compiled zone rules (no libc TZ parsing per frame)
 class M5TimeService : public ITimeService {
 public:
+    // Call once from setup() (NVS is not ready during static init)
+    void begin() {
+        Preferences prefs;
+        if (prefs.begin(kNvsNamespace, true)) {
+            if (prefs.isKey(kNvsDriftKey)) {
+                discipline_.restoreDriftPpb(prefs.getInt(kNvsDriftKey, 0));
+            }
+            prefs.end();
+        }
+    }
+
     time_t now() const override { return ::time(nullptr); }
-    struct tm* localtime(time_t* t) const override { return ::localtime(t); }
-    bool setSystemTime(time_t t) override {
+    int64_t nowMicros() const override {
         struct timeval tv = {};
-        tv.tv_sec = t;
-        tv.tv_usec = 0;
-        return ::settimeofday(&tv, nullptr) == 0;
+        ::gettimeofday(&tv, nullptr);
+        return static_cast<int64_t>(tv.tv_sec) * 1000000LL + tv.tv_usec;
+    }
+    struct tm* localtime(time_t* t) const override {
+        zone_.toLocal(*t, tmBuf_);
+        return &tmBuf_;
+    }
+    bool setSystemTime(time_t t) override {
+        discipline_.onExternalStep();
+        return stepTo(static_cast<int64_t>(t) * 1000000LL);
+    }
+    bool setSystemTimeMicros(int64_t epochUs) override {
+        discipline_.onExternalStep();
+        return stepTo(epochUs);
+    }
+    bool applySyncedTime(int64_t epochUs) override {
+        bool driftUpdated = false;
+        const ClockDiscipline::SyncAction action = discipline_.onSync(effectiveNowMicros(), epochUs, driftUpdated);
+        if (driftUpdated) {
+            saveDrift();
+        }
+        if (action == ClockDiscipline::SyncAction::Step) {
+            return stepTo(epochUs);
+        }
+        return true;
+    }
+    int32_t driftPpb() const override { return discipline_.driftPpb(); }
+    void applyTimeZone(const char* ianaName, size_t nameLen, int offsetMinutes) override;
+    void disciplineTick() override {
+        const int64_t dueUs = discipline_.correctionDue(monotonicMillis());
+        if (dueUs == 0) return;
+        // Add to whatever adjtime has not applied yet; the kernel slews it smoothly
+        struct timeval pending = {};
+        ::adjtime(nullptr, &pending);
+        const int64_t totalUs = static_cast<int64_t>(pending.tv_sec) * 1000000LL + pending.tv_usec + dueUs;
+        struct timeval delta = {};
+        delta.tv_sec = static_cast<time_t>(totalUs / 1000000LL);
+        delta.tv_usec = static_cast<suseconds_t>(totalUs % 1000000LL);
+        ::adjtime(&delta, nullptr);
     }
     uint32_t monotonicMillis() const override { return static_cast<uint32_t>(::millis()); }
-};
+    // esp_timer: 64-bit µs since boot, unaffected by settimeofday/adjtime
+    int64_t monotonicMicros() const override { return ::esp_timer_get_time(); }
 
+private:
+    static constexpr const char* kNvsNamespace = "clock";
+    static constexpr const char* kNvsDriftKey = "drift_ppb";
 
+    bool stepTo(int64_t epochUs) {
+        // Drop any unfinished adjtime slew before stepping
+        struct timeval zero = {};
+        ::adjtime(&zero, nullptr);
+        struct timeval tv = {};
+        tv.tv_sec = static_cast<time_t>(epochUs / 1000000);
+        tv.tv_usec = static_cast<suseconds_t>(epochUs % 1000000);
+        return ::settimeofday(&tv, nullptr) == 0;
+    }
+    // Current time including the adjtime remainder still to be applied
+    int64_t effectiveNowMicros() const {
+        struct timeval tv = {};
+        ::gettimeofday(&tv, nullptr);
+        struct timeval pending = {};
+        ::adjtime(nullptr, &pending);
+        return static_cast<int64_t>(tv.tv_sec) * 1000000LL + tv.tv_usec
+             + static_cast<int64_t>(pending.tv_sec) * 1000000LL + pending.tv_usec;
+    }
+    void saveDrift() {
+        Preferences prefs;
+        if (prefs.begin(kNvsNamespace, false)) {
+            prefs.putInt(kNvsDriftKey, discipline_.driftPpb());
+            prefs.end();
+        }
+    }
+
+    ClockDiscipline discipline_;
+    // Conversion cache + result buffer (localtime() is const and returns a pointer like ::localtime)
+    mutable CompiledTimeZone zone_;
+    mutable struct tm tmBuf_ = {};
+};
@@ -26,7 +26,7 @@ public:
         const int y = GRID_Y(7) + (GRID_HEIGHT - kProgressBarHeight) / 2;
         disp->fillProgressBarSprite(GRID_X(0), y, SCREEN_WIDTH, kProgressBarHeight, percent);
     }
-    void showAlarmList(const std::vector<std::string>& alarmStrs) override {
+    void showAlarmList(const FrameStringList& alarmStrs) override {
         const int alermColStep = (14 * GRID_WIDTH / 5);
         disp->setTextDatum(MC_DATUM);
         const int clearW = 48;
@@ -45,8 +45,9 @@ public:
     void showHints(const char* btnA, const char* btnB, const char* btnC) override {
         drawButtonHintsGrid(disp, btnA, btnB, btnC);
     }
+    // 画面遷移: 本文領域のみクリア（タイトル/ヒントは ChromeCache との差分だけ描き直す）
     void clear() override {
-        disp->clear();
+        disp->clearBody();
     }
 private:
     IDisplay* disp;
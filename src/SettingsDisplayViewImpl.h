@@ -19,8 +19,9 @@ public:
     }
     
     void showSettingsList(const std::vector<std::string>& items, size_t selectedIndex) override;
+    // 画面遷移: 本文領域のみクリア（タイトル/ヒントは ChromeCache との差分だけ描き直す）
     void clear() override {
-        if (disp) disp->clear();
+        if (disp) disp->clearBody();
     }
     
 private:
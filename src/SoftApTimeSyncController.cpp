@@ -5,7 +5,8 @@
 #include "M5TimeService.h"
 #include "ArduinoRandomProvider.h"
 #include "TimeSyncCore.h"
-#include "TimeZoneUtil.h"
+#include "GzipSplice.h"
+#include "generated/SyncPageAsset.h"
 
 #ifdef ARDUINO
 #include <Arduino.h>
@@ -13,8 +14,15 @@
 #include <WebServer.h>
 #include <DNSServer.h>
 #include <esp_timer.h>
-static WebServer server(80);
-static DNSServer dnsServer; // Captive: wildcard DNS → AP IP
+// Time Sync 専用: 初回の begin() まで構築しない（起動時の静的初期化から外す）
+static WebServer& httpServer() {
+    static WebServer server(80);
+    return server;
+}
+static DNSServer& captiveDns() {
+    static DNSServer dnsServer; // Captive: wildcard DNS → AP IP
+    return dnsServer;
+}
 extern ITimeService* g_time_service;   // provided in main.cpp
 #endif
 
@@ -43,104 +51,130 @@ void SoftApTimeSyncController::begin() {
     // Captive DNS: 任意ホスト名をAP IPへ解決
     {
         const IPAddress apIp = WiFi.softAPIP();
-        dnsServer.setTTL(1);
-        dnsServer.start(53, "*", apIp);
+        captiveDns().setTTL(1);
+        captiveDns().start(53, "*", apIp);
     }
 
-    // Register station-connected event → Step2 昇格
+    // Register station-connected event → Step2 昇格（WiFi イベントタスクではフラグだけ立て、loopTick で反映）
+    stationConnected_.store(false);
     WiFi.onEvent([this](WiFiEvent_t /*event*/, WiFiEventInfo_t /*info*/) {
-        logic_.onStationConnected();
+        stationConnected_.store(true);
     }, ARDUINO_EVENT_WIFI_AP_STACONNECTED);
-    // Setup minimal routes for Step2 (sync + time/set) and captive redirects
-    server.on("/sync", HTTP_GET, [this]() {
-        // Minimal HTML that auto-posts Date.now()/getTimezoneOffset()
-        String html;
-        html.reserve(1024);
-        html += F("<!doctype html><html><head><meta charset=\"utf-8\"><meta name=\"viewport\" content=\"width=device-width,initial-scale=1\"></head><body><pre id='log'>Sync...</pre><script>");
-        html += F("const TOKEN='"), html += token_.c_str(), html += F("';\n");
-        html += F("const epochMs=Date.now(); const tzOffsetMin = -new Date().getTimezoneOffset();\n");
-        html += F("fetch('/time/set',{method:'POST',headers:{'Content-Type':'application/json'},body: JSON.stringify({epochMs, tzOffsetMin, token:TOKEN})}).then(async r=>{document.getElementById('log').textContent=r.ok?('OK\\n'+await r.text()):('ERR '+r.status+'\\n'+await r.text());}).catch(e=>{document.getElementById('log').textContent='ERR\\n'+e;});");
-        html += F("</script></body></html>");
-        server.send(200, "text/html", html);
-        
-    });
+    // Per-session canned responses (token is fixed until reissue)
+    rebuildCannedResponses();
+    // Routes are registered once; handlers read the per-session buffers above
+    if (!routesRegistered_) {
+        registerRoutes();
+        routesRegistered_ = true;
+    }
+    httpServer().begin();
+#ifdef ARDUINO
+    // Arm AP stop at window end (success path stops earlier)
+    {
+        const int64_t nowUs = g_time_service ? g_time_service->monotonicMicros() : esp_timer_get_time();
+        const uint32_t remain = logic_.getWindowRemainingMs(nowUs);
+        esp_timer_create_args_t args{};
+        args.callback = [](void* /*arg*/){ captiveDns().stop(); httpServer().stop(); WiFi.softAPdisconnect(true); WiFi.mode(WIFI_OFF); };
+        args.dispatch_method = ESP_TIMER_TASK;
+        args.name = "ts_window";
+        esp_timer_handle_t h = nullptr;
+        if (esp_timer_create(&args, &h) == ESP_OK) {
+            esp_timer_start_once(h, static_cast<uint64_t>(remain) * 1000ULL);
+            // Keep handle to cancel on success/cancel
+            windowTimer_ = reinterpret_cast<void*>(h);
+        }
+    }
+#endif
+#endif
+    running_ = true;
+}
 
-    // iOS接続性チェック経路（CNAトリガ目的で302→/sync）。Hostは任意（DNSで自IPへ）。
-    server.on("/hotspot-detect.html", HTTP_GET, [this]() {
-        String loc = "/sync?t=";
-        loc += token_.c_str();
-        server.sendHeader("Location", loc, true);
-        server.send(302, "text/plain", "");
-    });
-    // 汎用success系・Windows/NCSI等も302へ（最小セット）
-    server.on("/success.txt", HTTP_GET, [this]() {
-        String loc = "/sync?t=";
-        loc += token_.c_str();
-        server.sendHeader("Location", loc, true);
-        server.send(302, "text/plain", "");
-    });
-    server.on("/success.html", HTTP_GET, [this]() {
-        String loc = "/sync?t=";
-        loc += token_.c_str();
-        server.sendHeader("Location", loc, true);
-        server.send(302, "text/plain", "");
-    });
-    server.on("/ncsi.txt", HTTP_GET, [this]() {
-        String loc = "/sync?t=";
-        loc += token_.c_str();
-        server.sendHeader("Location", loc, true);
-        server.send(302, "text/plain", "");
-    });
-    // Android系の /generate_204 は204で返すとCNAは開かないが、iOS優先のため302で誘導
-    server.on("/generate_204", HTTP_GET, [this]() {
-        String loc = "/sync?t=";
-        loc += token_.c_str();
-        server.sendHeader("Location", loc, true);
-        server.send(302, "text/plain", "");
-    });
+#ifdef ARDUINO
+void SoftApTimeSyncController::rebuildCannedResponses() {
+    redirectResponseLen_ = TimeSyncCore::buildRedirectResponse(token_.c_str(), redirectResponse_, sizeof(redirectResponse_));
+    TimeSyncCore::buildSessionEtag(kSyncPageAsset.etag, token_.c_str(), sessionEtag_, sizeof(sessionEtag_));
+    syncFrameOk_ = GzipSplice::buildFrame(kSyncPageAsset, token_.data(), token_.size(), syncFrame_);
+}
 
-    // ルート/未知パスは一律 /sync へリダイレクト
-    server.on("/", HTTP_GET, [this]() {
-        String loc = "/sync?t=";
-        loc += token_.c_str();
-        server.sendHeader("Location", loc, true);
-        server.send(302, "text/plain", "");
-    });
-    server.onNotFound([this]() {
-        String loc = "/sync?t=";
-        loc += token_.c_str();
-        server.sendHeader("Location", loc, true);
-        server.send(302, "text/plain", "");
-    });
-    server.on("/time/set", HTTP_POST, [this]() {
-        if (!server.hasArg("plain")) { server.send(400, "text/plain", "Bad Request"); return; }
-        const String body = server.arg("plain");
-        // Use pure JSON extractors from TimeSyncCore
-        std::string bodyStd(body.c_str());
-        int64_t epochMs = 0;
-        int tzOffsetMin = 0;
-        std::string tokenStd;
-        bool okEpoch = TimeSyncCore::jsonExtractInt64(bodyStd, "epochMs", epochMs);
-        bool okTz = TimeSyncCore::jsonExtractInt(bodyStd, "tzOffsetMin", tzOffsetMin);
-        bool okToken = TimeSyncCore::jsonExtractString(bodyStd, "token", tokenStd);
-        if (!okEpoch || !okTz || !okToken) { server.send(400, "text/plain", "Invalid JSON"); return; }
-        std::string token = tokenStd;
+void SoftApTimeSyncController::sendRedirect() {
+    httpServer().client().write(reinterpret_cast<const uint8_t*>(redirectResponse_), redirectResponseLen_);
+}
+
+void SoftApTimeSyncController::sendSyncPage() {
+    if (!syncFrameOk_) { httpServer().send(500, "text/plain", "Page unavailable"); return; }
+    char header[192];
+    WiFiClient client = httpServer().client();
+    // CNA の再読込は If-None-Match で 304（本文は送らない）
+    if (httpServer().hasHeader("If-None-Match") && httpServer().header("If-None-Match") == sessionEtag_) {
+        const size_t n = TimeSyncCore::buildNotModifiedResponse(sessionEtag_, header, sizeof(header));
+        client.write(reinterpret_cast<const uint8_t*>(header), n);
+        return;
+    }
+    const size_t n = TimeSyncCore::buildGzipPageResponseHeader(syncFrame_.contentLength, sessionEtag_, header, sizeof(header));
+    if (n == 0) { httpServer().send(500, "text/plain", "Page unavailable"); return; }
+    // head | stored block(token) | tail | trailer: flash から直接送出、ヒープ確保なし
+    client.write(reinterpret_cast<const uint8_t*>(header), n);
+    client.write(kSyncPageAsset.head, kSyncPageAsset.headLen);
+    client.write(syncFrame_.storedHeader, GzipSplice::kStoredBlockHeaderLen);
+    client.write(reinterpret_cast<const uint8_t*>(token_.data()), token_.size());
+    client.write(kSyncPageAsset.tail, kSyncPageAsset.tailLen);
+    client.write(syncFrame_.trailer, GzipSplice::kTrailerLen);
+}
+
+void SoftApTimeSyncController::sendProbe() {
+    const uint32_t recvMs = g_time_service ? g_time_service->monotonicMillis() : millis();
+    const String t = httpServer().arg("t");
+    if (!TimeSyncCore::verifyToken(token_, t.c_str(), t.length())) {
+        httpServer().send(403, "text/plain", "TOKEN MISMATCH");
+        return;
+    }
+    char response[160];
+    // t2 は書き出し直前に採取（処理時間は delay から除外される）
+    const uint32_t sendMs = g_time_service ? g_time_service->monotonicMillis() : millis();
+    const size_t n = TimeSyncCore::buildProbeResponse(recvMs, sendMs, response, sizeof(response));
+    httpServer().client().write(reinterpret_cast<const uint8_t*>(response), n);
+}
+
+void SoftApTimeSyncController::registerRoutes() {
+    static const char* kCollectedHeaders[] = { "If-None-Match" };
+    httpServer().collectHeaders(kCollectedHeaders, 1);
+
+    httpServer().on("/sync", HTTP_GET, [this]() { sendSyncPage(); });
+    // 往復遅延計測用（NTP 方式の t1/t2 を装置単調時計で返す）
+    httpServer().on("/time/probe", HTTP_GET, [this]() { sendProbe(); });
+
+    // 接続性チェック経路（iOS/汎用success/Windows NCSI/Android）とルート・未知パスは
+    // すべて同一の事前生成 302 → /sync。Android の /generate_204 も iOS 優先で 302 誘導。
+    static const char* const kProbePaths[] = {
+        "/hotspot-detect.html", "/success.txt", "/success.html", "/ncsi.txt", "/generate_204", "/",
+    };
+    for (const char* path : kProbePaths) {
+        httpServer().on(path, HTTP_GET, [this]() { sendRedirect(); });
+    }
+    httpServer().onNotFound([this]() { sendRedirect(); });
+
+    httpServer().on("/time/set", HTTP_POST, [this]() {
+        if (!httpServer().hasArg("plain")) { httpServer().send(400, "text/plain", "Bad Request"); return; }
+        const String body = httpServer().arg("plain");
+        // Single-pass parse straight over the request buffer (token stays a view into body)
+        TimeSyncCore::TimeSetRequest req{};
+        const TimeSyncCore::ParseResult parsed =
+            TimeSyncCore::parseTimeSetRequest(body.c_str(), body.length(), req);
+        if (parsed != TimeSyncCore::ParseResult::Ok) {
+            const int status = (parsed == TimeSyncCore::ParseResult::TooLarge) ? 413 : 400;
+            httpServer().send(status, "text/plain", TimeSyncCore::parseResultCode(parsed));
+            return;
+        }
 
         bool ok = false;
         if (g_time_service) {
             // Validate token against our one-time token_
-            logic_.setExpectedToken(token_.c_str());
+            logic_.setExpectedToken(token_);
 
-            
-            if (token == token_.c_str()) {
-                if (logic_.handleTimeSetRequest(epochMs, tzOffsetMin, token, g_time_service)) {
-                    // Apply TZ immediately so localtime reflects smartphone's locale
-                    #ifdef ARDUINO
-                    const std::string tz = TimeZoneUtil::buildPosixTzFromOffsetMinutes(tzOffsetMin);
-                    setenv("TZ", tz.c_str(), 1);
-                    tzset();
-                    #endif
-                    server.send(200, "text/plain", "Time applied");
+            if (TimeSyncCore::verifyToken(token_, req.token, req.tokenLen)) {
+                // Time and timezone (IANA rules or offset) are applied by the time service
+                if (logic_.handleTimeSetRequest(req, g_time_service)) {
+                    httpServer().send(200, "text/plain", "Time applied");
                     ok = true;
                 } else {
                     const char* code = logic_.getErrorMessage();
@@ -152,15 +186,15 @@ void SoftApTimeSyncController::begin() {
                     else if (strcmp(code, "time_out_of_range") == 0) { status = 422; msg = "TIME OUT OF RANGE"; }
                     else if (strcmp(code, "tz_offset_out_of_range") == 0) { status = 422; msg = "TZ OFFSET OUT OF RANGE"; }
                     else if (strcmp(code, "apply_failed") == 0) { status = 500; msg = "APPLY FAILED"; }
-                    server.send(status, "text/plain", msg);
+                    httpServer().send(status, "text/plain", msg);
                     
                 }
             } else {
-                server.send(403, "text/plain", "TOKEN MISMATCH");
+                httpServer().send(403, "text/plain", "TOKEN MISMATCH");
                 
             }
         } else {
-            server.send(500, "text/plain", "No time adapters");
+            httpServer().send(500, "text/plain", "No time adapters");
             
         }
         if (ok) {
@@ -170,35 +204,16 @@ void SoftApTimeSyncController::begin() {
                 esp_timer_delete(h);
                 windowTimer_ = nullptr;
             }
-            dnsServer.stop();
-            server.stop();
+            captiveDns().stop();
+            httpServer().stop();
             WiFi.softAPdisconnect(true);
             WiFi.mode(WIFI_OFF);
             delay(50);
             running_ = false;
         }
     });
-    server.begin();
-#ifdef ARDUINO
-    // Arm AP stop at window end (success path stops earlier)
-    {
-        const uint32_t nowMs = millis();
-        const uint32_t remain = logic_.getWindowRemainingMs(nowMs);
-        esp_timer_create_args_t args{};
-        args.callback = [](void* /*arg*/){ dnsServer.stop(); server.stop(); WiFi.softAPdisconnect(true); WiFi.mode(WIFI_OFF); };
-        args.dispatch_method = ESP_TIMER_TASK;
-        args.name = "ts_window";
-        esp_timer_handle_t h = nullptr;
-        if (esp_timer_create(&args, &h) == ESP_OK) {
-            esp_timer_start_once(h, static_cast<uint64_t>(remain) * 1000ULL);
-            // Keep handle to cancel on success/cancel
-            windowTimer_ = reinterpret_cast<void*>(h);
-        }
-    }
-#endif
-#endif
-    running_ = true;
 }
+#endif
 
 void SoftApTimeSyncController::cancel() {
 #ifdef ARDUINO
@@ -208,8 +223,8 @@ void SoftApTimeSyncController::cancel() {
         esp_timer_delete(h);
         windowTimer_ = nullptr;
     }
-    dnsServer.stop();
-    server.stop();
+    captiveDns().stop();
+    httpServer().stop();
     WiFi.softAPdisconnect(true);
     WiFi.mode(WIFI_OFF);
     delay(50);
@@ -220,14 +235,14 @@ void SoftApTimeSyncController::cancel() {
 void SoftApTimeSyncController::loopTick() {
 #ifdef ARDUINO
     // Handle incoming HTTP requests for /sync and /time/set
-    server.handleClient();
+    httpServer().handleClient();
     // Process DNS queries for captive portal
-    dnsServer.processNextRequest();
+    captiveDns().processNextRequest();
 
-    // Fallback: station count check → Step2
+    // Station connected (event flag, or station count as a fallback) → Step2
+    const bool connectedEvent = stationConnected_.exchange(false);
     if (logic_.getStatus() == TimeSyncLogic::Status::Step1) {
-        const int stations = WiFi.softAPgetStationNum();
-        if (stations > 0) {
+        if (connectedEvent || WiFi.softAPgetStationNum() > 0) {
             logic_.onStationConnected();
         }
     }
@@ -241,6 +256,7 @@ void SoftApTimeSyncController::reissue() {
     ssid_  = logic_.getCredentials().ssid;
     psk_   = logic_.getCredentials().psk;
     token_ = logic_.getCredentials().token;
+    rebuildCannedResponses();
     if (running_) {
         WiFi.softAPdisconnect(true);
         WiFi.softAP(ssid_.c_str(), psk_.c_str());
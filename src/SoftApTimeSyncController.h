@@ -2,7 +2,9 @@
 
 #include "ITimeSyncController.h"
 #include "TimeSyncLogic.h"
+#include "GzipSplice.h"
 #include <string>
+#include <atomic>
 
 // SoftAP controller for ESP32 (Step1 scope: Wi‑Fi QR only)
 class SoftApTimeSyncController : public ITimeSyncController {
@@ -21,6 +23,9 @@ public:
     void getUrlPayload(std::string& outUrl) const override;
     const char* getErrorMessage() const override;
 
+    // Session status transitions are published as SyncStatusChanged
+    void setEventBus(EventBus* bus) { logic_.setEventBus(bus); }
+
 private:
     // Cached credentials mirrored from logic
     std::string ssid_;
@@ -41,6 +46,21 @@ private:
     void cancelWindowTimer();
     void stopApInternal();
     void* windowTimer_{nullptr};
+    // Set by the WiFi event task; consumed by loopTick() (TimeSyncLogic/EventBus are loop-context only)
+    std::atomic<bool> stationConnected_{false};
+
+    // Captive portal responses, rebuilt per session (begin/reissue) so handlers never allocate
+    void rebuildCannedResponses();
+    void registerRoutes();
+    void sendRedirect();
+    void sendSyncPage();
+    void sendProbe();
+    char redirectResponse_[160]{};
+    size_t redirectResponseLen_{0};
+    char sessionEtag_[64]{};
+    GzipSplice::SpliceFrame syncFrame_{};
+    bool syncFrameOk_{false};
+    bool routesRegistered_{false};
 #endif
 };
 
@@ -13,11 +13,10 @@ extern "C" {
 
 void TimeSyncViewImpl::showTitle(const char* text) {
     if (adapter_ == nullptr) return;
-    // 画面初期化は入場時の1回のみ呼ばれる想定
-    adapter_->clear();
-    constexpr int BATTERY_LEVEL_PLACEHOLDER = 42;
-    const bool IS_CHARGING_PLACEHOLDER = false;
-    drawTitleBar(adapter_, text, BATTERY_LEVEL_PLACEHOLDER, IS_CHARGING_PLACEHOLDER);
+    // 画面初期化は入場時の1回のみ呼ばれる想定（本文のみクリア。QR も本文領域内）
+    adapter_->clearBody();
+    const BatteryStatus bat = telemetry_ ? telemetry_->batteryStatus() : BatteryStatus{ -1, false, 0 };
+    drawTitleBar(adapter_, text, bat.percent, bat.charging);
 }
 
 void TimeSyncViewImpl::showHints(const char* hintA, const char* hintB, const char* hintC) {
@@ -3,6 +3,7 @@
 #include "ITimeSyncView.h"
 #include "DisplayAdapter.h"
 #include "ui_constants.h"
+#include "IPowerTelemetry.h"
 #include <string>
 
 // Hardware-dependent implementation of ITimeSyncView for M5Stack devices.
@@ -16,8 +17,12 @@ public:
     void showUrlQr(const char* payload) override;
     void showError(const char* message) override;
 
+    // 電池表示の取得元（キャッシュ値のみ参照、バスアクセスなし）
+    void setPowerTelemetry(const IPowerTelemetry* telemetry) { telemetry_ = telemetry; }
+
 private:
     DisplayAdapter* adapter_;
+    const IPowerTelemetry* telemetry_ = nullptr;
 };
 
 
@@ -0,0 +1,74 @@
+// Generated by scripts/embed_web_assets.py from web/sync.html - do not edit.
+// Source 1334 bytes -> gzip 782 bytes (+ spliced token).
+#pragma once
+
+#include <cstdint>
+#include "GzipSplice.h"
+#ifdef ARDUINO
+#include <pgmspace.h>
+#else
+#define PROGMEM
+#endif
+
+static const uint8_t kSyncPageHead[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x2c, 0x8c, 0x31, 0x0e, 0x02, 0x21,
+    0x10, 0x45, 0xaf, 0x82, 0x34, 0x36, 0xee, 0x6e, 0xec, 0x2c, 0x80, 0xce, 0xca, 0x44, 0x0b, 0xbd,
+    0x00, 0x0e, 0xa3, 0x4c, 0xc2, 0x02, 0x81, 0x71, 0x37, 0xdc, 0x5e, 0xa2, 0xdb, 0xfc, 0xe4, 0xbf,
+    0xbc, 0x3c, 0xb5, 0x73, 0x09, 0xb8, 0x65, 0x14, 0x9e, 0xe7, 0x60, 0xd4, 0xb6, 0x68, 0x9d, 0x51,
+    0x33, 0xb2, 0x15, 0xe0, 0x6d, 0xa9, 0xc8, 0x5a, 0x7e, 0xf8, 0x35, 0x9c, 0xe4, 0x46, 0xa3, 0x9d,
+    0x51, 0xcb, 0x85, 0x70, 0xcd, 0xa9, 0xb0, 0x14, 0x90, 0x22, 0x63, 0xec, 0xd6, 0x4a, 0x8e, 0xbd,
+    0x76, 0xb8, 0x10, 0xe0, 0xf0, 0x3b, 0x07, 0x8a, 0xc4, 0x64, 0xc3, 0x50, 0xc1, 0x06, 0xd4, 0xc7,
+    0x9e, 0x98, 0xfe, 0xfd, 0x67, 0x72, 0xcd, 0xa8, 0x5c, 0x50, 0x90, 0xd3, 0x32, 0xa4, 0xb7, 0x34,
+    0xf7, 0x16, 0x61, 0x1c, 0x47, 0x35, 0x75, 0x6a, 0x54, 0x85, 0x42, 0x99, 0x4d, 0x8f, 0x57, 0x16,
+    0x8f, 0xdb, 0xe5, 0x7c, 0xd5, 0xfb, 0x2f, 0x00, 0x00, 0x00, 0xff, 0xff,
+};
+static const uint8_t kSyncPageTail[] PROGMEM = {
+    0x7d, 0x53, 0xc1, 0x72, 0xd3, 0x30, 0x10, 0xfd, 0x95, 0x9c, 0x22, 0x69, 0xec, 0x38, 0x81, 0x32,
+    0x1c, 0xec, 0xa8, 0x9d, 0x29, 0x84, 0x99, 0x52, 0xda, 0x74, 0x92, 0x70, 0xa1, 0xf4, 0xa0, 0x38,
+    0xeb, 0xd8, 0xad, 0x23, 0x19, 0x69, 0x4d, 0x49, 0xdd, 0xfc, 0x3b, 0xda, 0xd8, 0x29, 0x19, 0xe8,
+    0x70, 0xb1, 0xac, 0xd5, 0x7b, 0x6f, 0x57, 0xbb, 0x4f, 0x2c, 0x49, 0x8d, 0x76, 0xd8, 0xbb, 0x99,
+    0x4d, 0xcf, 0x27, 0x73, 0xf9, 0xbe, 0xdb, 0x96, 0x66, 0x2d, 0xb9, 0x13, 0xf2, 0xb4, 0x59, 0x99,
+    0xb4, 0xde, 0x80, 0xc6, 0x68, 0x0d, 0x38, 0x29, 0x81, 0x7e, 0xcf, 0xb7, 0x17, 0x2b, 0xce, 0x3c,
+    0x84, 0x89, 0x08, 0xe1, 0x17, 0x7e, 0x30, 0x1a, 0x7d, 0x58, 0xba, 0x64, 0xd7, 0xd1, 0xf1, 0x69,
+    0x9a, 0x65, 0x0e, 0xf0, 0xaa, 0xd0, 0x72, 0xa0, 0xe1, 0xb1, 0xf7, 0x51, 0x21, 0x70, 0x41, 0x1a,
+    0x8b, 0x62, 0x03, 0x4f, 0x46, 0x43, 0x0b, 0xe0, 0x22, 0x29, 0x81, 0xf0, 0xd7, 0x6a, 0x03, 0x92,
+    0xb1, 0x04, 0xed, 0xb6, 0xe9, 0x76, 0x17, 0x1a, 0xcb, 0x88, 0x88, 0x44, 0xf9, 0x64, 0xec, 0x46,
+    0x79, 0x78, 0x64, 0xc1, 0x99, 0xf2, 0x27, 0xac, 0xa6, 0x15, 0x16, 0x3e, 0x97, 0x8f, 0xa0, 0x3f,
+    0xfe, 0xe6, 0x15, 0x9f, 0x9f, 0x3d, 0x7f, 0x97, 0x2a, 0x4c, 0x73, 0x0e, 0xa2, 0xd9, 0xb5, 0xa5,
+    0x2c, 0x95, 0x03, 0x49, 0x2a, 0x91, 0x36, 0x8f, 0x5c, 0x0c, 0x2a, 0xb0, 0x19, 0x69, 0xe9, 0xb4,
+    0x8b, 0x24, 0xca, 0x6d, 0x75, 0xda, 0xcb, 0x6a, 0x9d, 0x92, 0x62, 0xaf, 0xb2, 0x66, 0x09, 0xbc,
+    0x10, 0x4d, 0xcb, 0xaf, 0x6d, 0x29, 0xe9, 0x06, 0x5f, 0x67, 0x5f, 0x38, 0x1b, 0x52, 0xae, 0xe1,
+    0x1e, 0x71, 0x86, 0x92, 0x05, 0x8b, 0xe9, 0xe5, 0xe4, 0x3a, 0x60, 0xfd, 0xc2, 0xff, 0x17, 0x61,
+    0x69, 0x7c, 0x72, 0x2f, 0x11, 0xe5, 0x16, 0x32, 0xb1, 0xff, 0x76, 0xfd, 0x50, 0x47, 0x15, 0x74,
+    0x21, 0x2b, 0xd5, 0xa3, 0x2a, 0xb0, 0x97, 0x01, 0xd5, 0xeb, 0xb3, 0x84, 0x4d, 0xaa, 0xd2, 0x1c,
+    0x62, 0xa6, 0xcd, 0xc0, 0xa1, 0xb1, 0xc0, 0x76, 0x07, 0xec, 0x7d, 0x87, 0xb5, 0xd1, 0xbd, 0x33,
+    0xfa, 0x45, 0x62, 0xf9, 0xaf, 0x2a, 0xc8, 0xe3, 0xfb, 0xd1, 0xc8, 0x34, 0xda, 0x02, 0xdc, 0xf9,
+    0x96, 0x5a, 0x4a, 0x69, 0x44, 0x54, 0x99, 0xea, 0x05, 0x8f, 0x23, 0xc9, 0xa1, 0xdf, 0x07, 0xdf,
+    0xd6, 0x1f, 0x35, 0x38, 0x9c, 0xa3, 0xb2, 0x28, 0xce, 0xae, 0x14, 0xe6, 0x91, 0x35, 0xb5, 0x5e,
+    0x71, 0xea, 0x5f, 0xf0, 0xd7, 0x79, 0xac, 0x0e, 0xf4, 0x93, 0x17, 0xba, 0xab, 0x7c, 0x04, 0xfe,
+    0xc3, 0x3f, 0x06, 0xc4, 0xcb, 0xc4, 0x02, 0xd6, 0x56, 0xf7, 0x6e, 0x71, 0x14, 0xde, 0x47, 0xf8,
+    0x86, 0x3e, 0x6f, 0x43, 0x3c, 0xb9, 0x4b, 0x76, 0x7c, 0x3f, 0x10, 0x4e, 0xe6, 0x6b, 0xb3, 0x38,
+    0xb5, 0xa9, 0x4a, 0x70, 0xf2, 0xf6, 0x2e, 0xf1, 0x57, 0xe3, 0x64, 0x98, 0x42, 0x8e, 0x92, 0x62,
+    0xdc, 0x9a, 0x36, 0x29, 0x82, 0x40, 0x34, 0x64, 0x9c, 0x0e, 0x18, 0x55, 0xb5, 0xcb, 0x79, 0xdb,
+    0xb2, 0xc3, 0x34, 0xc5, 0xb1, 0x33, 0x0e, 0xd6, 0x30, 0xab, 0xad, 0x6c, 0xa0, 0x32, 0x69, 0x7e,
+    0xe5, 0xe2, 0x3f, 0xbd, 0x0c, 0x8f, 0xec, 0x1b, 0xa2, 0x79, 0x00, 0x1d, 0xef, 0x07, 0xbd, 0x4b,
+    0x8a, 0x8c, 0x1f, 0x72, 0x94, 0xa0, 0xd7, 0x98, 0x0b, 0xd2, 0x88, 0x0e, 0x05, 0x76, 0x2b, 0xc1,
+    0x5a, 0x0f, 0xf7, 0xfb, 0xed, 0xda, 0xa1, 0xc7, 0xf2, 0xdd, 0xa8, 0x65, 0x74, 0x16, 0x6f, 0x97,
+    0x57, 0x1d, 0xd1, 0x79, 0xcd, 0x57, 0xc1, 0xc2, 0x66, 0x03, 0x98, 0x9b, 0x55, 0xcc, 0x6e, 0xa6,
+    0xf3, 0x05, 0x0b, 0x73, 0x50, 0x2b, 0xb0, 0x2e, 0x6e, 0x58, 0xf7, 0xf2, 0x06, 0x8b, 0x6d, 0x05,
+    0x2c, 0x66, 0xaa, 0xaa, 0xca, 0xa2, 0xf5, 0xe0, 0x90, 0x9c, 0xc2, 0x76, 0x21, 0x65, 0x8b, 0x3f,
+    0xcf, 0xa7, 0xd7, 0x91, 0xf3, 0x46, 0xd0, 0xeb, 0x22, 0xdb, 0x72, 0x8a, 0x09, 0x6f, 0x2e, 0xff,
+    0x82, 0xb9, 0x8d, 0xcc, 0xc3, 0x19, 0x67, 0xd3, 0xcb, 0xef, 0x9a, 0x05, 0x07, 0x97, 0xd1, 0xa3,
+    0xe6, 0x42, 0xc4, 0x9c, 0x4d, 0x66, 0xb3, 0x1e, 0x0b, 0xac, 0x27, 0x2b, 0xac, 0x5d, 0xc0, 0x5e,
+    0x41, 0xf9, 0xce, 0x0a, 0xff, 0x0a, 0xbb, 0xee, 0xfa, 0xa1, 0x91, 0x2c, 0x11, 0x09, 0x0b, 0x74,
+    0x9a, 0x8c, 0x87, 0x2e, 0xb5, 0x45, 0x85, 0xa7, 0xe3, 0x21, 0xe5, 0xf6, 0x4b, 0x8e, 0x9b, 0xf2,
+    0xf4, 0x37,
+};
+
+static const GzipSplice::SplicedAsset kSyncPageAsset = {
+    kSyncPageHead, sizeof(kSyncPageHead),
+    kSyncPageTail, sizeof(kSyncPageTail),
+    0x16acee8au, 177u,
+    0x4262e4cdu, 1148u,
+    "8e045475da89",
+};
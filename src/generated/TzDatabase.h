@@ -0,0 +1,77 @@
+// Generated by scripts/gen_tz_rules.py from scripts/tz_zones.csv - do not edit.
+// 68 zones x 16 bytes of rules (+ names), sorted by name for binary search.
+#pragma once
+
+#include "TzRule.h"
+
+static const TzZone kTzZones[] = {
+    { "Africa/Cairo", { 120, 180, { 4, 5, 5, 0 }, { 10, 5, 4, 1440 } } }, // EET-2EEST,M4.5.5/0,M10.5.4/24
+    { "Africa/Johannesburg", { 120, 120, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } } }, // SAST-2
+    { "Africa/Lagos", { 60, 60, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } } }, // WAT-1
+    { "Africa/Nairobi", { 180, 180, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } } }, // EAT-3
+    { "America/Anchorage", { -540, -480, { 3, 2, 0, 120 }, { 11, 1, 0, 120 } } }, // AKST9AKDT,M3.2.0,M11.1.0
+    { "America/Argentina/Buenos_Aires", { -180, -180, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } } }, // <-03>3
+    { "America/Bogota", { -300, -300, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } } }, // <-05>5
+    { "America/Chicago", { -360, -300, { 3, 2, 0, 120 }, { 11, 1, 0, 120 } } }, // CST6CDT,M3.2.0,M11.1.0
+    { "America/Denver", { -420, -360, { 3, 2, 0, 120 }, { 11, 1, 0, 120 } } }, // MST7MDT,M3.2.0,M11.1.0
+    { "America/Halifax", { -240, -180, { 3, 2, 0, 120 }, { 11, 1, 0, 120 } } }, // AST4ADT,M3.2.0,M11.1.0
+    { "America/Lima", { -300, -300, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } } }, // <-05>5
+    { "America/Los_Angeles", { -480, -420, { 3, 2, 0, 120 }, { 11, 1, 0, 120 } } }, // PST8PDT,M3.2.0,M11.1.0
+    { "America/Mexico_City", { -360, -360, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } } }, // CST6
+    { "America/New_York", { -300, -240, { 3, 2, 0, 120 }, { 11, 1, 0, 120 } } }, // EST5EDT,M3.2.0,M11.1.0
+    { "America/Phoenix", { -420, -420, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } } }, // MST7
+    { "America/Santiago", { -240, -180, { 9, 1, 6, 1440 }, { 4, 1, 6, 1440 } } }, // <-04>4<-03>,M9.1.6/24,M4.1.6/24
+    { "America/Sao_Paulo", { -180, -180, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } } }, // <-03>3
+    { "America/St_Johns", { -210, -150, { 3, 2, 0, 120 }, { 11, 1, 0, 120 } } }, // NST3:30NDT,M3.2.0,M11.1.0
+    { "America/Toronto", { -300, -240, { 3, 2, 0, 120 }, { 11, 1, 0, 120 } } }, // EST5EDT,M3.2.0,M11.1.0
+    { "America/Vancouver", { -480, -420, { 3, 2, 0, 120 }, { 11, 1, 0, 120 } } }, // PST8PDT,M3.2.0,M11.1.0
+    { "Asia/Bangkok", { 420, 420, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } } }, // <+07>-7
+    { "Asia/Dhaka", { 360, 360, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } } }, // <+06>-6
+    { "Asia/Dubai", { 240, 240, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } } }, // <+04>-4
+    { "Asia/Ho_Chi_Minh", { 420, 420, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } } }, // <+07>-7
+    { "Asia/Hong_Kong", { 480, 480, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } } }, // HKT-8
+    { "Asia/Jakarta", { 420, 420, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } } }, // WIB-7
+    { "Asia/Jerusalem", { 120, 180, { 3, 4, 4, 1560 }, { 10, 5, 0, 120 } } }, // IST-2IDT,M3.4.4/26,M10.5.0
+    { "Asia/Karachi", { 300, 300, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } } }, // PKT-5
+    { "Asia/Kathmandu", { 345, 345, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } } }, // <+0545>-5:45
+    { "Asia/Kolkata", { 330, 330, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } } }, // IST-5:30
+    { "Asia/Manila", { 480, 480, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } } }, // PST-8
+    { "Asia/Seoul", { 540, 540, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } } }, // KST-9
+    { "Asia/Shanghai", { 480, 480, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } } }, // CST-8
+    { "Asia/Singapore", { 480, 480, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } } }, // <+08>-8
+    { "Asia/Taipei", { 480, 480, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } } }, // CST-8
+    { "Asia/Tehran", { 210, 210, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } } }, // <+0330>-3:30
+    { "Asia/Tokyo", { 540, 540, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } } }, // JST-9
+    { "Atlantic/Reykjavik", { 0, 0, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } } }, // GMT0
+    { "Australia/Adelaide", { 570, 630, { 10, 1, 0, 120 }, { 4, 1, 0, 180 } } }, // ACST-9:30ACDT,M10.1.0,M4.1.0/3
+    { "Australia/Brisbane", { 600, 600, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } } }, // AEST-10
+    { "Australia/Darwin", { 570, 570, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } } }, // ACST-9:30
+    { "Australia/Lord_Howe", { 630, 660, { 10, 1, 0, 120 }, { 4, 1, 0, 120 } } }, // <+1030>-10:30<+11>-11,M10.1.0,M4.1.0
+    { "Australia/Melbourne", { 600, 660, { 10, 1, 0, 120 }, { 4, 1, 0, 180 } } }, // AEST-10AEDT,M10.1.0,M4.1.0/3
+    { "Australia/Perth", { 480, 480, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } } }, // AWST-8
+    { "Australia/Sydney", { 600, 660, { 10, 1, 0, 120 }, { 4, 1, 0, 180 } } }, // AEST-10AEDT,M10.1.0,M4.1.0/3
+    { "Etc/UTC", { 0, 0, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } } }, // UTC0
+    { "Europe/Amsterdam", { 60, 120, { 3, 5, 0, 120 }, { 10, 5, 0, 180 } } }, // CET-1CEST,M3.5.0,M10.5.0/3
+    { "Europe/Athens", { 120, 180, { 3, 5, 0, 180 }, { 10, 5, 0, 240 } } }, // EET-2EEST,M3.5.0/3,M10.5.0/4
+    { "Europe/Berlin", { 60, 120, { 3, 5, 0, 120 }, { 10, 5, 0, 180 } } }, // CET-1CEST,M3.5.0,M10.5.0/3
+    { "Europe/Brussels", { 60, 120, { 3, 5, 0, 120 }, { 10, 5, 0, 180 } } }, // CET-1CEST,M3.5.0,M10.5.0/3
+    { "Europe/Dublin", { 60, 0, { 10, 5, 0, 120 }, { 3, 5, 0, 60 } } }, // IST-1GMT0,M10.5.0,M3.5.0/1
+    { "Europe/Helsinki", { 120, 180, { 3, 5, 0, 180 }, { 10, 5, 0, 240 } } }, // EET-2EEST,M3.5.0/3,M10.5.0/4
+    { "Europe/Istanbul", { 180, 180, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } } }, // <+03>-3
+    { "Europe/Lisbon", { 0, 60, { 3, 5, 0, 60 }, { 10, 5, 0, 120 } } }, // WET0WEST,M3.5.0/1,M10.5.0
+    { "Europe/London", { 0, 60, { 3, 5, 0, 60 }, { 10, 5, 0, 120 } } }, // GMT0BST,M3.5.0/1,M10.5.0
+    { "Europe/Madrid", { 60, 120, { 3, 5, 0, 120 }, { 10, 5, 0, 180 } } }, // CET-1CEST,M3.5.0,M10.5.0/3
+    { "Europe/Moscow", { 180, 180, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } } }, // MSK-3
+    { "Europe/Paris", { 60, 120, { 3, 5, 0, 120 }, { 10, 5, 0, 180 } } }, // CET-1CEST,M3.5.0,M10.5.0/3
+    { "Europe/Prague", { 60, 120, { 3, 5, 0, 120 }, { 10, 5, 0, 180 } } }, // CET-1CEST,M3.5.0,M10.5.0/3
+    { "Europe/Rome", { 60, 120, { 3, 5, 0, 120 }, { 10, 5, 0, 180 } } }, // CET-1CEST,M3.5.0,M10.5.0/3
+    { "Europe/Stockholm", { 60, 120, { 3, 5, 0, 120 }, { 10, 5, 0, 180 } } }, // CET-1CEST,M3.5.0,M10.5.0/3
+    { "Europe/Vienna", { 60, 120, { 3, 5, 0, 120 }, { 10, 5, 0, 180 } } }, // CET-1CEST,M3.5.0,M10.5.0/3
+    { "Europe/Warsaw", { 60, 120, { 3, 5, 0, 120 }, { 10, 5, 0, 180 } } }, // CET-1CEST,M3.5.0,M10.5.0/3
+    { "Europe/Zurich", { 60, 120, { 3, 5, 0, 120 }, { 10, 5, 0, 180 } } }, // CET-1CEST,M3.5.0,M10.5.0/3
+    { "Pacific/Auckland", { 720, 780, { 9, 5, 0, 120 }, { 4, 1, 0, 180 } } }, // NZST-12NZDT,M9.5.0,M4.1.0/3
+    { "Pacific/Chatham", { 765, 825, { 9, 5, 0, 165 }, { 4, 1, 0, 225 } } }, // <+1245>-12:45<+1345>,M9.5.0/2:45,M4.1.0/3:45
+    { "Pacific/Honolulu", { -600, -600, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } } }, // HST10
+    { "UTC", { 0, 0, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } } }, // UTC0
+};
+static const size_t kTzZoneCount = sizeof(kTzZones) / sizeof(kTzZones[0]);
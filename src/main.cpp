@@ -1,5 +1,6 @@
 #include "DisplayCommon.h"
 #include "StateManager.h"
+#include "FrameContext.h"
 #include "MainDisplayState.h"
 #include "InputDisplayState.h"
 #include "AlarmDisplayState.h"
@@ -18,17 +19,14 @@
 #include "DisplayAdapter.h"
 #include "TimeValidationLogic.h"
 #include "BootAutoSyncPolicy.h"
-#include "ButtonManager.h"
+#include "LogicTick.h"
 #include "TimeSyncDisplayState.h"
 #include "TimeSyncViewImpl.h"
 #include "SoftApTimeSyncController.h"
 #include "M5TimeService.h"
-#ifdef ARDUINO
-#ifdef M5STACK_CORE2
-#include "VibrationSequencer.h"
-#include "Core2VibrationAdapter.h"
-#endif
-#endif
+#include "M5RtcAdapter.h"
+#include "RtcTimeService.h"
+#include "M5PowerTelemetry.h"
 
 // 共通include（全環境で使用）
 #include <Arduino.h>
@@ -86,7 +84,7 @@ auto m5_fill_rect_impl(int pos_x, int pos_y, int width, int height, int color) -
 // ITimeService へ一本化したため、ITimeManager/DateTimeAdapter は削除
 
 // --- アラームリスト ---
-std::vector<time_t> alarm_times;
+AlarmStore alarm_times;
 
 // --- 状態管理クラスのグローバル生成 ---
 StateManager state_manager;
@@ -99,31 +97,43 @@ DateTimeInputViewImpl datetime_input_view_impl(&display_adapter);
 TimeLogic time_logic;
 AlarmLogic alarm_logic;
 SettingsLogic settings_logic;
-ButtonManager button_manager;
 
 #ifdef ARDUINO
 #include "FrameClockPlanner.h"
+#include "FramePacingPolicy.h"
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
-// Core2 vibration: single file-scope instances used by setup()/loop()
-#ifdef M5STACK_CORE2
-static VibrationSequencer g_vibe_seq;
-static Core2VibrationAdapter g_vibe_out;
-#endif
-// Backlight sequencer (frame-synced brightness)
-#include "BacklightSequencer.h"
-#include "M5BacklightAdapter.h"
-static BacklightSequencer g_backlight_seq;
-static M5BacklightAdapter g_backlight_out;
+#include <sys/time.h>
+#include "FrameLoadMeter.h"
+#include "CpuFrequencyGovernor.h"
+#include "AllocationStats.h"
+#include "TickLatencyHistogram.h"
+#include "InternalBusLock.h"
+#include <atomic>
+#include "FrameArena.h"
+#include "EspCpuClock.h"
+// Backlight + Core2 vibration: one timeline, one timer armed at the earliest deadline
+// (independent of the frame clock; alert patterns share a time origin)
+#include "AlertPatterns.h"
+#include "M5ActuatorTimeline.h"
+static M5ActuatorTimeline g_actuators;
+// 起動フェーズの µs タイムスタンプ（setup 完了時にシリアルへ CSV 出力）
+#include "BootProfiler.h"
+static BootProfiler g_boot_profiler;
+// 電池残量: 10s 毎にループ上で PMIC を読み、平滑化した値をキャッシュ（タイトルバーはキャッシュのみ参照）
+static M5PowerTelemetry g_power;
 // M5Stack関連のクラス（全デバイス共通）
 static M5TimeService g_time_service_impl;
-ITimeService* g_time_service = &g_time_service_impl;
-const std::shared_ptr<ITimeService> m5_time_service{ &g_time_service_impl, [](ITimeService*){} };
+// BM8563 RTC: 起動時に一度だけ読み出し、Time Sync 成功毎に書き込み
+static M5RtcAdapter g_rtc_adapter;
+static RtcTimeService g_rtc_time_service(&g_time_service_impl, &g_rtc_adapter);
+ITimeService* g_time_service = &g_rtc_time_service;
+const std::shared_ptr<ITimeService> m5_time_service{ &g_rtc_time_service, [](ITimeService*){} };
 InputLogic input_logic(m5_time_service);
 InputDisplayState input_display_state(&input_logic, &input_display_view_impl, g_time_service);
 MainDisplayState main_display_state(&state_manager, &input_display_state, &main_display_view_impl, &time_logic, &alarm_logic);
 AlarmDisplayState alarm_display_state(&state_manager, &alarm_display_view_impl, m5_time_service);
-AlarmActiveState alarm_active_state(&state_manager, &main_display_state, &g_backlight_seq, &g_backlight_out, &settings_logic);
+AlarmActiveState alarm_active_state(&state_manager, &main_display_state, &g_actuators, &g_actuators, &settings_logic);
 SettingsDisplayState settings_display_state(&settings_logic, &settings_display_view_impl);
 TimeSyncViewImpl time_sync_view_impl(&display_adapter);
 SoftApTimeSyncController time_sync_controller;
@@ -131,16 +141,182 @@ TimeSyncDisplayState time_sync_display_state(&time_sync_view_impl, &time_sync_co
 // 起動時自動開始の抑止管理（同一ブート内）
 BootAutoSyncPolicy g_boot_auto_policy;
 DateTimeInputState datetime_input_state(g_time_service, &datetime_input_view_impl);
-// フレームクロック（16fps固定, tick=1ms）
+// フレームクロック（基本16fps, tick=1ms）。アイドル時は同じ格子上でフレームを間引く
 static TickType_t g_last_wake = 0;
 static FrameClockPlanner g_frame_clock_planner(62500, 1000);
+static FramePacingPolicy g_frame_pacing;
+// loop タスク = UI タスク（イベント処理と描画、優先度 1）。ロジックティックがイベントを渡すと起こされる
+static TaskHandle_t g_loop_task = nullptr;
+// CPU クロック: 画面/負荷に応じて 80/160/240MHz（ボタン操作と Time Sync 開始時は一時的に最大）
+static FrameLoadMeter g_frame_load;
+static CpuFrequencyGovernor g_cpu_governor;
+static EspCpuClock g_cpu_clock;
+static uint32_t g_frame_start_us = 0;
+static uint32_t g_frame_busy_us = 0;
+static constexpr uint32_t kInputBoostMs = 500;     // 画面遷移の全面再描画
+static constexpr uint32_t kTimeSyncBoostMs = 3000; // AP 起動 + QR 生成
+// フレーム毎のヒープ確保数（loop タスクのみ計上）。確保したフレームがあれば定期的に報告
+// フレーム内の一時文字列/リストは frameArena()（毎フレーム先頭でリセット）から確保し、最大使用量も併せて報告
+static FrameAllocationMonitor g_frame_allocs;
+static uint32_t g_alloc_report_ms = 0;
+static constexpr uint32_t kAllocReportMs = 10000;
+static size_t g_arena_reported_bytes = 0;
+static bool isLoopTaskContext() { return xTaskGetCurrentTaskHandle() == g_loop_task; }
+// 100Hz ロジックティック（仕様 3.1 メインループ 100Hz）: 入力サンプリング/デバウンスと PMIC サンプル。
+// 専用タスク（優先度 2、loop と同じコア）で回し、描画に時間がかかってもティックは遅れない
+static ButtonEventQueue g_button_events;
+static LogicTick g_logic_tick(&g_button_events);
+// ティックのレイテンシ（予定時刻からの遅れ + 処理時間）。60 秒毎にスナップショットを UI タスクへ渡す
+static TickLatencyHistogram g_tick_latency(LogicTick::kPeriodMs * 1000u);
+static TickLatencyHistogram g_tick_report(LogicTick::kPeriodMs * 1000u);
+static std::atomic<bool> g_tick_report_ready(false);
+static constexpr uint32_t kTickReportTicks = 60000u / LogicTick::kPeriodMs;
+#ifdef LOOP_SOAK_BENCH
+static constexpr bool kTickReportAlways = true;  // ソーク計測: 毎回出力
+#else
+static constexpr bool kTickReportAlways = false; // 締め切り超過があった区間だけ出力
+#endif
+// アイドルスリープ（仕様 2.5.1/2.5.2）: 無操作 5 分で減光 → パネルスリープ、描画（onDraw の SPI 転送）も停止。
+// カウントダウン中/アラーム鳴動中/Time Sync 中は眠らない。任意ボタンで直前の画面に復帰（その押下は操作に使わない）
+#include "IdleSleepManager.h"
+static IdleSleepManager g_idle_sleep;
+static constexpr uint32_t kAsleepPollMs = 60000; // スリープ中の再評価間隔（通常はボタン通知で起きる）
+// モジュール間イベントバス（静的確保）: アラーム/時刻/設定/Time Sync の変化を購読者へ配る。
+// loop は設定変更（輝度の反映）と時刻変更（アラームの rebase）を購読。トピック別の件数は落ちた通知があった区間だけ報告
+#include "EventBus.h"
+static EventBus g_event_bus;
+static EventBus::SubscriberId g_loop_events = EventBus::kNoSubscriber;
+// アラームは単調時計上の締め切りで鳴る。時刻変更の通知が無い壁時計の動き（adjtime のスルー）も定期的に取り込む
+static uint32_t g_alarm_rebase_ms = 0;
+static constexpr uint32_t kAlarmRebaseMs = 60000;
+// 締め切りちょうどに loop を起こすワンショットタイマー（フレーム格子/秒境界を待たずに判定する）。
+// 鳴動画面への入場が締め切りからどれだけ遅れたかをアラーム毎に記録し、鳴る度にヒストグラムと併せて出力
+#include <esp_timer.h>
+#include "AlarmFireJitter.h"
+static esp_timer_handle_t g_alarm_wake_timer = nullptr;
+static int64_t g_alarm_wake_armed_us = 0; // 0: 未設定
+static AlarmFireJitter g_alarm_fire_jitter(&alarm_times, g_time_service);
+static void alarmWakeCallback(void*) {
+	if (g_loop_task != nullptr) xTaskNotifyGive(g_loop_task);
+}
+// 先頭の締め切りが変わったときだけタイマーを張り直す
+static void armAlarmWake() {
+	if (g_alarm_wake_timer == nullptr) return;
+	int64_t deadlineUs = 0;
+	if (!alarm_times.nextDeadlineUs(deadlineUs)) deadlineUs = 0;
+	if (deadlineUs == g_alarm_wake_armed_us) return;
+	esp_timer_stop(g_alarm_wake_timer);
+	g_alarm_wake_armed_us = deadlineUs;
+	if (deadlineUs == 0) return;
+	const int64_t delayUs = deadlineUs - g_time_service->monotonicMicros();
+	esp_timer_start_once(g_alarm_wake_timer, delayUs > 0 ? static_cast<uint64_t>(delayUs) : 0);
+}
+static StaticTask_t g_logic_task_tcb;
+static StackType_t g_logic_task_stack[4096];
+static void logicTaskMain(void*) {
+	TickType_t wake = xTaskGetTickCount();
+	// 起床予定時刻（µs）: vTaskDelayUntil は遅れても予定を 1 周期ずつ進めるので同じだけ進める。
+	// 遅れは esp_timer で測る（ティック数では 1ms 単位にしかならない）
+	int64_t dueUs = -1;
+	for (;;) {
+		vTaskDelayUntil(&wake, pdMS_TO_TICKS(LogicTick::kPeriodMs));
+		const int64_t startUs = esp_timer_get_time();
+		dueUs = dueUs < 0 ? startUs : dueUs + static_cast<int64_t>(LogicTick::kPeriodMs) * 1000;
+		const uint32_t lateUs = startUs > dueUs ? static_cast<uint32_t>(startUs - dueUs) : 0u;
+		bool pressedA = false;
+		bool pressedB = false;
+		bool pressedC = false;
+		{
+			InternalBusGuard bus(internalBusMutex());
+			M5.update();
+			pressedA = M5.BtnA.isPressed();
+			pressedB = M5.BtnB.isPressed();
+			pressedC = M5.BtnC.isPressed();
+		}
+		g_power.poll(millis());
+		if (g_logic_tick.tick(esp_timer_get_time(), pressedA, pressedB, pressedC)) {
+			xTaskNotifyGive(g_loop_task);
+		}
+		g_tick_latency.record(lateUs + static_cast<uint32_t>(esp_timer_get_time() - startUs));
+		if (g_tick_latency.count() >= kTickReportTicks && !g_tick_report_ready.load()) {
+			g_tick_report = g_tick_latency;
+			g_tick_report_ready.store(true);
+			g_tick_latency.clear();
+		}
+	}
+}
+static void startLogicTask() {
+	xTaskCreateStaticPinnedToCore(logicTaskMain, "logic", sizeof(g_logic_task_stack), nullptr, 2,
+		g_logic_task_stack, &g_logic_task_tcb, xPortGetCoreID());
+}
+// 論理イベントを StateManager へ伝搬（画面遷移を伴う操作は処理前にクロックを上げる）
+static void dispatchButtonEvents(const ButtonEvents& events, const FrameContext& frame) {
+	const uint8_t a = ButtonEvents::bit(ButtonManager::BtnA);
+	const uint8_t b = ButtonEvents::bit(ButtonManager::BtnB);
+	const uint8_t c = ButtonEvents::bit(ButtonManager::BtnC);
+	if ((events.shortPress | events.longPress) != 0) {
+		g_cpu_governor.boost(millis(), kInputBoostMs);
+		g_cpu_clock.apply(g_cpu_governor.currentMhz());
+	}
+	if (events.shortPress & a) { state_manager.handleButtonA(frame); }
+	if (events.shortPress & b) { state_manager.handleButtonB(frame); }
+	if (events.shortPress & c) { state_manager.handleButtonC(frame); }
+	if (events.longPress & a) { state_manager.handleButtonALongPress(frame); }
+	if (events.longPress & b) { state_manager.handleButtonBLongPress(frame); }
+	if (events.longPress & c) { state_manager.handleButtonCLongPress(frame); }
+#ifdef M5STACK_CORE2
+	// Core2: press/longPress の触覚フィードバック（区間の切替はアクチュエータタイムライン側）
+	if (events.pressDown != 0) {
+		g_actuators.playHaptics(AlertPatterns::kButtonPress);
+	}
+	if (events.longPress != 0) {
+		g_actuators.playHaptics(AlertPatterns::kButtonLongPress);
+	}
+#endif
+}
+// 減光は設定輝度からのフェード（アクチュエータタイムライン）。復帰はパネルを起こして設定輝度へ戻すだけで、
+// パネルの GRAM が直前の画面を保持しているので clear/onEnter はしない（差分描画がそのまま続く）
+static uint8_t configuredBrightness() {
+	const int configured = settings_logic.getLcdBrightness();
+	return (configured >= 0 && configured <= 255) ? static_cast<uint8_t>(configured) : DEFAULT_LCD_BRIGHTNESS;
+}
+static void applyIdleAction(IdleSleepManager::Action action) {
+	const uint8_t baseline = configuredBrightness();
+	switch (action) {
+	case IdleSleepManager::Action::Dim:
+		g_actuators.play(g_idle_sleep.dimPattern(baseline));
+		break;
+	case IdleSleepManager::Action::Sleep:
+		g_actuators.stop();
+		g_actuators.setBrightness(0);
+		{
+			InternalBusGuard bus(internalBusMutex());
+			display_adapter.sleepPanel();
+		}
+		break;
+	case IdleSleepManager::Action::Wake:
+		{
+			InternalBusGuard bus(internalBusMutex());
+			display_adapter.wakePanel();
+		}
+		g_actuators.stop();
+		g_actuators.setBrightness(baseline);
+		break;
+	case IdleSleepManager::Action::Undim:
+		g_actuators.stop();
+		g_actuators.setBrightness(baseline);
+		break;
+	case IdleSleepManager::Action::None:
+		break;
+	}
+}
 #else
 // Native環境用のモック（テスト用）
 InputLogic input_logic(nullptr);
 InputDisplayState input_display_state(&input_logic, &input_display_view_impl);
 MainDisplayState main_display_state(&state_manager, &input_display_state, &main_display_view_impl, &time_logic, &alarm_logic);
 AlarmDisplayState alarm_display_state(&state_manager, &alarm_display_view_impl, nullptr);
-AlarmActiveState alarm_active_state(&state_manager, &main_display_state, &g_backlight_seq, &g_backlight_out, &settings_logic);
+AlarmActiveState alarm_active_state(&state_manager, &main_display_state, &g_actuators, &g_actuators, &settings_logic);
 SettingsDisplayState settings_display_state(&settings_logic, &settings_display_view_impl);
 DateTimeInputState datetime_input_state(nullptr, &datetime_input_view_impl);
 #endif
@@ -148,6 +324,8 @@ DateTimeInputState datetime_input_state(nullptr, &datetime_input_view_impl);
 // 統一されたsetup関数
 #ifdef ARDUINO
 void setup() {
+	// 起動フェーズ計測（micros: 静的初期化と Arduino コア起動を含むアプリ開始からの経過）
+	g_boot_profiler.mark("setup", micros());
 	auto cfg = M5.config();
 	// シリアル出力のボーレート設定（platformio.ini の SERIAL_BAUD に準拠）
 #ifdef SERIAL_BAUD
@@ -159,36 +337,38 @@ void setup() {
 	cfg.output_power = true;
 	M5.begin(cfg);
 	Serial.begin(cfg.serial_baudrate);
-	Serial.println("[BOOT] M5.begin done");
 	M5.Display.setTextColor(AMBER_COLOR, TFT_BLACK);
-#ifdef ENABLE_BACKLIGHT_BOOT_DEMO
-	// Simple non-repeating boot demo: fade in (8f), hold (8f), off (8f)
-	g_backlight_seq.clear();
-	g_backlight_seq.enqueueStep(0, 4);
-	g_backlight_seq.enqueueStep(64, 4);
-	g_backlight_seq.enqueueStep(128, 4);
-	g_backlight_seq.enqueueStep(200, 4);
-	g_backlight_seq.enqueueStep(255, 8);
-	g_backlight_seq.enqueueStep(0, 8);
-	g_backlight_seq.setRepeat(false);
-	g_backlight_seq.start();
-#endif
-#if defined(M5STACK_CORE2) && defined(ENABLE_CORE2_BOOT_VIBE_DEMO)
-	g_vibe_seq.loadPattern({
-		{100, 100},   // 100ms ON（100%）
-		{100, 0},     // 100ms OFF
-		{100, 100},   // 100ms ON（100%）
-		{500, 0},     // 500ms OFF
-		{1000, 80},   // 1000ms ON（80%）
-		{500, 0},     // 500ms OFF
-		{1000, 80}    // 1000ms ON（80%）
-	}, false);        // 繰り返しなし
-	g_vibe_seq.start(millis()); // パターン再生開始
-	Serial.println("[VIBE] pattern loaded and started");
-#endif
-	
-	// ITimeService一本化後も、必要なら here で初期化ロジックを追加可能
+	g_boot_profiler.mark("m5_begin", micros());
+
+	// イベントバスの配線（発行: アラーム/時刻/設定/Time Sync、購読: メイン/Time Sync 画面と loop）
+	alarm_times.setEventBus(&g_event_bus);
+	alarm_times.setTimeSource(g_time_service);
+	g_rtc_time_service.setEventBus(&g_event_bus);
+	settings_logic.setEventBus(&g_event_bus);
+	time_sync_controller.setEventBus(&g_event_bus);
+	main_display_state.setEventBus(&g_event_bus);
+	time_sync_display_state.setEventBus(&g_event_bus);
+	g_loop_events = g_event_bus.subscribe(EventBus::mask(EventTopic::SettingsChanged) | EventBus::mask(EventTopic::TimeChanged));
+
+	// --- 最初の画面に必要なものだけを先に行う ---
+	// RTC から時刻を復元（有効なら Wi‑Fi なしで即座に正しい時刻）、前回の TZ も復元
+	{
+		const RtcTimeService::BootResult rtcResult = g_rtc_time_service.restoreAtBoot();
+		Serial.printf("[BOOT] RTC restore: %d\n", static_cast<int>(rtcResult));
+		g_rtc_time_service.restoreTimeZone();
+	}
+	g_boot_profiler.mark("rtc_restore", micros());
 	
+	// 電池残量の初回サンプル（最初の画面のタイトルバーから実測値を表示）
+	g_power.poll(millis());
+	main_display_state.setPowerTelemetry(&g_power);
+	input_display_state.setPowerTelemetry(&g_power);
+	alarm_display_state.setPowerTelemetry(&g_power);
+	settings_display_state.setPowerTelemetry(&g_power);
+	datetime_input_state.setPowerTelemetry(&g_power);
+	time_sync_view_impl.setPowerTelemetry(&g_power);
+	g_boot_profiler.mark("power_sample", micros());
+
 	// アラームリスト初期化
 	alarm_times.clear();
 	time_t now = time(nullptr);
@@ -232,7 +412,59 @@ void setup() {
 	if (state_manager.getCurrentState() == nullptr) {
 		state_manager.setState(&main_display_state);
 	}
+	// 最初のフレーム（時刻・残り時間まで）を setup 内で描画
+	if (state_manager.getCurrentState() != nullptr) {
+		state_manager.getCurrentState()->onDraw();
+	}
+	g_boot_profiler.mark("first_frame", micros());
+
+	// --- 以降は最初の画面に不要な初期化 ---
+	// 時刻サービス初期化（NVS からドリフト推定値を復元）
+	g_time_service_impl.begin();
+	g_boot_profiler.mark("drift_restore", micros());
+	g_actuators.begin();
+#ifdef ENABLE_BACKLIGHT_BOOT_DEMO
+	// Simple non-repeating boot demo: gamma-corrected fade in (1s), hold, off
+	g_actuators.play(AlertPatterns::kBootDemo);
+#endif
+#if defined(M5STACK_CORE2) && defined(ENABLE_CORE2_BOOT_VIBE_DEMO)
+	static const VibrationSequencer::Segment kBootDemoSegments[] = {
+		{100, 100},   // 100ms ON（100%）
+		{100, 0},     // 100ms OFF
+		{100, 100},   // 100ms ON（100%）
+		{500, 0},     // 500ms OFF
+		{1000, 80},   // 1000ms ON（80%）
+		{500, 0},     // 500ms OFF
+		{1000, 80}    // 1000ms ON（80%）
+	};
+	static const HapticPattern kBootDemoPattern = { kBootDemoSegments, 7, false }; // 繰り返しなし
+	g_actuators.playHaptics(kBootDemoPattern); // パターン再生開始
+	Serial.println("[VIBE] pattern loaded and started");
+#endif
+	g_boot_profiler.mark("actuators", micros());
+
+	// CPU クロック制御（esp_pm 有効ビルドでは tickless idle もここで設定）
+	g_cpu_clock.begin();
+	g_loop_task = xTaskGetCurrentTaskHandle();
+	AllocationStats::setContextFilter(isLoopTaskContext);
+	{
+		esp_timer_create_args_t args{};
+		args.callback = &alarmWakeCallback;
+		args.name = "alarm_wake";
+		(void)esp_timer_create(&args, &g_alarm_wake_timer);
+	}
+	alarm_active_state.setFireJitter(&g_alarm_fire_jitter);
+	startLogicTask();
+	g_boot_profiler.mark("power_mgmt", micros());
 
+	// 起動タイムラインを出力（CSV: phase,at_us,delta_us）
+	g_boot_profiler.mark("setup_done", micros());
+	{
+		char timeline[640];
+		g_boot_profiler.formatTimeline(timeline, sizeof(timeline));
+		Serial.print("[BOOT] timeline\n");
+		Serial.print(timeline);
+	}
 	// フレームクロック初期化（位相維持の基準）
 	g_last_wake = xTaskGetTickCount();
 	}
@@ -241,55 +473,159 @@ void setup() {
 // 統一されたloop関数
 #ifdef ARDUINO
 void loop() {
-	M5.update();
-	// 物理ボタン状態をButtonManagerに渡す
-	button_manager.update(ButtonManager::BtnA, M5.BtnA.isPressed(), millis());
-	button_manager.update(ButtonManager::BtnB, M5.BtnB.isPressed(), millis());
-	button_manager.update(ButtonManager::BtnC, M5.BtnC.isPressed(), millis());
-	// 論理イベントを一度だけ取得し、以降で共有利用（消費の二重化を防止）
-	const bool pdA = button_manager.isPressDown(ButtonManager::BtnA);
-	const bool pdB = button_manager.isPressDown(ButtonManager::BtnB);
-	const bool pdC = button_manager.isPressDown(ButtonManager::BtnC);
-	const bool spA = button_manager.isShortPress(ButtonManager::BtnA);
-	const bool spB = button_manager.isShortPress(ButtonManager::BtnB);
-	const bool spC = button_manager.isShortPress(ButtonManager::BtnC);
-	const bool lpA = button_manager.isLongPress(ButtonManager::BtnA);
-	const bool lpB = button_manager.isLongPress(ButtonManager::BtnB);
-	const bool lpC = button_manager.isLongPress(ButtonManager::BtnC);
-
-	// 論理イベントでStateManagerに伝搬（ローカル値を使用）
-	if (spA) { state_manager.handleButtonA(); }
-	if (spB) { state_manager.handleButtonB(); }
-	if (spC) { state_manager.handleButtonC(); }
-	if (lpA) { state_manager.handleButtonALongPress(); }
-	if (lpB) { state_manager.handleButtonBLongPress(); }
-	if (lpC) { state_manager.handleButtonCLongPress(); }
-	// 現在の状態の描画
+	// 待機中に届いた通知は下のキュー取り出しで消化するので破棄（以降の通知は待機を中断する）
+	(void)ulTaskNotifyTake(pdTRUE, 0);
+	// 前フレームの負荷（処理時間 / 周期）を計測
+	const uint32_t frameStartUs = micros();
+	if (g_frame_start_us != 0) {
+		g_frame_load.addFrame(g_frame_busy_us, frameStartUs - g_frame_start_us);
+	}
+	g_frame_start_us = frameStartUs;
+	frameArena().reset();
+	g_frame_allocs.beginFrame();
+	// このフレームの時刻（ボタン処理と描画で共有し、画面ごとに取り直さない）
+	FrameContext frame = FrameContext::capture(g_time_service);
+	// ロジックティック（100Hz）が検出したボタンイベントを発生順に処理
+	IState* const previous = state_manager.getCurrentState();
+	bool pressedThisFrame = false;
+	ButtonEvents events;
+	while (g_button_events.pop(events)) {
+		pressedThisFrame = pressedThisFrame || events.pressDown != 0;
+		// スリープ中の押下は復帰だけに使い、StateManager へは渡さない
+		applyIdleAction(g_idle_sleep.onButtonEvents(millis(), events));
+		dispatchButtonEvents(events, frame);
+	}
+	// アイドルスリープ判定（カウントダウン/鳴動/Time Sync/押下中は起きたまま。スリープ中なら復帰させる）
 	IState* current = state_manager.getCurrentState();
-	if (current != nullptr) {
-		current->onDraw();
+	const bool held = g_logic_tick.anyHeld();
+	const bool holdAwake = held || !alarm_times.empty()
+		|| current == &alarm_active_state || current == &time_sync_display_state;
+	applyIdleAction(g_idle_sleep.update(millis(), holdAwake));
+	// 設定変更の通知: 輝度は起きていてパターン再生中でなければ即反映（減光/スリープ中は復帰時に設定値へ戻る）
+	// 時刻変更の通知: 絶対アラームの締め切り/相対アラームの表示時刻を取り直す（描画前に）
+	BusEvent busEvent;
+	bool rebaseAlarms = static_cast<int32_t>(millis() - g_alarm_rebase_ms) >= 0;
+	while (g_event_bus.poll(g_loop_events, busEvent)) {
+		if (busEvent.topic == EventTopic::TimeChanged) {
+			rebaseAlarms = true;
+			frame = FrameContext::capture(g_time_service); // 時刻設定/同期の後は新しい時刻で描く
+		} else if (static_cast<SettingsItem>(busEvent.value) == SettingsItem::LCD_BRIGHTNESS
+			&& g_idle_sleep.phase() == IdleSleepManager::Phase::Awake && !g_actuators.isActive()) {
+			g_actuators.setBrightness(configuredBrightness());
+		}
 	}
-
-	// --- Core2: Haptics feedback on press/longPress ---
-#ifdef M5STACK_CORE2
-	// 設定: press/longPressで個別のパターン（初期: 100ms/100%）
-	static const std::vector<VibrationSequencer::Segment> kPressDownPattern = { {100, 100} };
-	static const std::vector<VibrationSequencer::Segment> kLongPressPattern = { {100, 100} };
-	if (pdA || pdB || pdC) {
-		g_vibe_seq.loadPattern(kPressDownPattern, false);
-		g_vibe_seq.start(millis());
+	if (rebaseAlarms) {
+		alarm_times.rebase();
+		g_alarm_rebase_ms = millis() + kAlarmRebaseMs;
 	}
-	if (lpA || lpB || lpC) {
-		g_vibe_seq.loadPattern(kLongPressPattern, false);
-		g_vibe_seq.start(millis());
+	// 現在の状態の描画（スリープ中は描画しない）
+	if (current != nullptr && g_idle_sleep.isRendering()) {
+		current->onDraw(frame);
 	}
-	g_vibe_seq.update(millis(), &g_vibe_out);
+	// 時計のドリフト補償/スルー（同期時の段差を作らない）
+	g_time_service->disciplineTick();
+	// CPU クロック: Time Sync（Wi-Fi/HTTP/QR）とメイン以外の画面/押下中は床 160MHz、待機中は 80MHz（負荷率で上げる）
+	IState* const shown = state_manager.getCurrentState();
+	if (shown == &time_sync_display_state && previous != &time_sync_display_state) {
+		g_cpu_governor.boost(millis(), kTimeSyncBoostMs);
+	}
+	CpuFrequencyGovernor::Workload workload = CpuFrequencyGovernor::Workload::Idle;
+	if (!g_idle_sleep.isRendering()) {
+		workload = CpuFrequencyGovernor::Workload::Idle;
+	} else if (shown == &time_sync_display_state) {
+		workload = CpuFrequencyGovernor::Workload::Radio;
+	} else if (held || shown != &main_display_state) {
+		workload = CpuFrequencyGovernor::Workload::Interactive;
+	}
+	g_cpu_clock.apply(g_cpu_governor.update(millis(), workload, g_frame_load.busyPermille()));
+	g_frame_busy_us = micros() - frameStartUs;
+	g_frame_allocs.endFrame();
+	if (static_cast<int32_t>(millis() - g_alloc_report_ms) >= 0) {
+		g_alloc_report_ms = millis() + kAllocReportMs;
+		if (g_frame_allocs.allocatingFrames() != 0) {
+			const AllocationStats::Snapshot worst = g_frame_allocs.worstFrame();
+			Serial.printf("[ALLOC] %u/%u frames allocated, worst %u allocs %u bytes\n",
+				static_cast<unsigned>(g_frame_allocs.allocatingFrames()), static_cast<unsigned>(g_frame_allocs.frames()),
+				static_cast<unsigned>(worst.count), static_cast<unsigned>(worst.bytes));
+		}
+		g_frame_allocs.resetPeaks();
+		FrameArena& arena = frameArena();
+		if (arena.overflows() != 0 || arena.highWater() > g_arena_reported_bytes) {
+			Serial.printf("[ARENA] high-water %u/%u bytes, %u overflows\n",
+				static_cast<unsigned>(arena.highWater()), static_cast<unsigned>(arena.capacity()),
+				static_cast<unsigned>(arena.overflows()));
+			g_arena_reported_bytes = arena.highWater();
+			arena.resetStats();
+		}
+		if (g_event_bus.totalDropped() != 0) {
+			for (size_t t = 0; t < EventBus::kTopicCount; ++t) {
+				const EventTopic topic = static_cast<EventTopic>(t);
+				const EventBus::TopicStats& stats = g_event_bus.stats(topic);
+				if (stats.published == 0) continue;
+				Serial.printf("[EVENT] %s: %u published, %u delivered, %u dropped\n", EventBus::topicName(topic),
+					static_cast<unsigned>(stats.published), static_cast<unsigned>(stats.delivered),
+					static_cast<unsigned>(stats.dropped));
+			}
+		}
+		g_event_bus.resetStats();
+	}
+	if (g_tick_report_ready.load()) {
+		const TickLatencyHistogram& ticks = g_tick_report;
+		if (kTickReportAlways || ticks.misses() != 0 || g_button_events.dropped() != 0) {
+			Serial.printf("[TICK] %u ticks, p50/p99/p99.9 %u/%u/%u us, max %u us, %u over %u us, %u events dropped\n",
+				static_cast<unsigned>(ticks.count()), static_cast<unsigned>(ticks.percentileUs(500)),
+				static_cast<unsigned>(ticks.percentileUs(990)), static_cast<unsigned>(ticks.percentileUs(999)),
+				static_cast<unsigned>(ticks.maxUs()), static_cast<unsigned>(ticks.misses()),
+				static_cast<unsigned>(ticks.deadlineUs()), static_cast<unsigned>(g_button_events.dropped()));
+		}
+		g_tick_report_ready.store(false);
+	}
+	AlarmFireJitter::Sample fire;
+	if (g_alarm_fire_jitter.takeSample(fire)) {
+		const TickLatencyHistogram& late = g_alarm_fire_jitter.histogram();
+		Serial.printf("[ALARM] %u fired: scheduled %lld us, entered %lld us, late %u us; %u alarms p50/p99/max %u/%u/%u us, %u over %u us\n",
+			static_cast<unsigned>(fire.alarms), static_cast<long long>(fire.scheduledUs), static_cast<long long>(fire.enteredUs),
+			static_cast<unsigned>(fire.lateUs), static_cast<unsigned>(late.count()), static_cast<unsigned>(late.percentileUs(500)),
+			static_cast<unsigned>(late.percentileUs(990)), static_cast<unsigned>(late.maxUs()),
+			static_cast<unsigned>(late.misses()), static_cast<unsigned>(late.deadlineUs()));
+	}
+	// フレームペーシング: 操作中/画面遷移中/アクチュエータ再生中は 16fps、
+	// 待機中のメイン画面は秒（カウントダウン表示時）または分の境界でのみ描画
+	FramePacingPolicy::Activity activity;
+	activity.input = held || pressedThisFrame;
+	activity.busy = shown != &main_display_state
+		|| g_actuators.isActive() || g_actuators.isHapticsActive();
+	activity.secondsVisible = !alarm_times.empty();
+#ifdef FRAME_PACING_FORCE_RATE
+	// 消費電力測定用: 0=Full, 1=Seconds, 2=Minutes に固定
+	(void)g_frame_pacing.select(millis(), activity);
+	const FramePacingPolicy::Rate rate = static_cast<FramePacingPolicy::Rate>(FRAME_PACING_FORCE_RATE);
+#else
+	const FramePacingPolicy::Rate rate = g_frame_pacing.select(millis(), activity);
 #endif
-    // Drive backlight on 16fps frame boundary only (always enabled)
-    g_backlight_seq.tick(&g_backlight_out);
-	// 位相維持フレームクロック（16fps）
-	const TickType_t step = pdMS_TO_TICKS(g_frame_clock_planner.nextDelayMs());
-	vTaskDelayUntil(&g_last_wake, step);
+	// 次の描画格子点まで眠る（ロジックティックのイベント通知/アラームの締め切りタイマーで中断）。
+	// Full は次の格子点、それ以外は壁時計の境界以降で最初の格子点（格子＝位相は維持）
+	// スリープ中は描画しないので、ボタン通知か kAsleepPollMs まで眠る
+	uint32_t frames = 1;
+	if (!g_idle_sleep.isRendering()) {
+		frames = g_frame_clock_planner.framesToCover(kAsleepPollMs);
+	} else if (rate != FramePacingPolicy::Rate::Full) {
+		struct timeval tv = {};
+		gettimeofday(&tv, nullptr);
+		const uint32_t wallMsOfMinute = static_cast<uint32_t>(tv.tv_sec % 60) * 1000u + static_cast<uint32_t>(tv.tv_usec / 1000);
+		frames = g_frame_clock_planner.framesToCover(FramePacingPolicy::msUntilBoundary(rate, wallMsOfMinute));
+	}
+	armAlarmWake();
+	const TickType_t target = g_last_wake + pdMS_TO_TICKS(g_frame_clock_planner.nextDelayMs(frames));
+	const TickType_t nowTick = xTaskGetTickCount();
+	const TickType_t wait = static_cast<int32_t>(target - nowTick) > 0 ? target - nowTick : 0;
+	if (ulTaskNotifyTake(pdTRUE, wait) != 0) {
+		// ボタン/締め切りで起床: その時刻を新しい位相基準にして即座に次フレームを処理
+		g_last_wake = xTaskGetTickCount();
+		g_frame_clock_planner.reset();
+	} else {
+		g_last_wake = target;
+	}
 }
 #endif
 
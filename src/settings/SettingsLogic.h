@@ -1,12 +1,16 @@
 #pragma once
 #include "ISettingsLogic.h"
 #include "ui_constants.h"
+#include "EventBus.h"
 #include <string>
 
 class SettingsLogic : public ISettingsLogic {
 public:
     SettingsLogic();
 
+    // 値の変更を SettingsChanged（value: SettingsItem）として発行
+    void setEventBus(EventBus* bus) { bus_ = bus; }
+
     auto getLcdBrightness() const -> int override;
     void setLcdBrightness(int value) override;
     auto isSoundEnabled() const -> bool override;
@@ -34,19 +38,32 @@ private:
     bool soundEnabled_;
     SettingsItem selectedItem_;
     bool valueEditMode_;
+    EventBus* bus_ = nullptr;
+
+    void publishChanged(SettingsItem item) {
+        if (bus_ != nullptr) bus_->publish(EventTopic::SettingsChanged, static_cast<int64_t>(item));
+    }
 };
 
-inline SettingsLogic::SettingsLogic() { resetSettings(); }
+inline SettingsLogic::SettingsLogic()
+    : lcdBrightness_(DEFAULT_LCD_BRIGHTNESS), soundEnabled_(true), selectedItem_(SettingsItem::SOUND), valueEditMode_(false) {
+    resetSettings();
+}
 inline auto SettingsLogic::getLcdBrightness() const -> int { return lcdBrightness_; }
 inline void SettingsLogic::setLcdBrightness(int value) {
     constexpr int MIN_LCD_BRIGHTNESS = 50;
     constexpr int MAX_LCD_BRIGHTNESS = 250;
-    if (value >= MIN_LCD_BRIGHTNESS && value <= MAX_LCD_BRIGHTNESS) {
+    if (value >= MIN_LCD_BRIGHTNESS && value <= MAX_LCD_BRIGHTNESS && value != lcdBrightness_) {
         lcdBrightness_ = value;
+        publishChanged(SettingsItem::LCD_BRIGHTNESS);
     }
 }
 inline auto SettingsLogic::isSoundEnabled() const -> bool { return soundEnabled_; }
-inline void SettingsLogic::setSoundEnabled(bool enabled) { soundEnabled_ = enabled; }
+inline void SettingsLogic::setSoundEnabled(bool enabled) {
+    if (enabled == soundEnabled_) return;
+    soundEnabled_ = enabled;
+    publishChanged(SettingsItem::SOUND);
+}
 inline auto SettingsLogic::getSelectedItem() const -> SettingsItem { return selectedItem_; }
 inline void SettingsLogic::setSelectedItem(SettingsItem item) { selectedItem_ = item; }
 inline auto SettingsLogic::getItemCount() const -> int { return 4; }
@@ -76,10 +93,15 @@ inline void SettingsLogic::setValueEditMode(bool editMode) { valueEditMode_ = ed
 inline void SettingsLogic::loadSettings() { resetSettings(); }
 inline void SettingsLogic::saveSettings() const {}
 inline void SettingsLogic::resetSettings() {
+    // 値が変わった項目だけ通知（setSoundEnabled/setLcdBrightness と同じ）
+    const bool soundChanged = !soundEnabled_;
+    const bool brightnessChanged = lcdBrightness_ != DEFAULT_LCD_BRIGHTNESS;
     lcdBrightness_ = DEFAULT_LCD_BRIGHTNESS;
     soundEnabled_ = true;
     selectedItem_ = SettingsItem::SOUND;
     valueEditMode_ = false;
+    if (soundChanged) publishChanged(SettingsItem::SOUND);
+    if (brightnessChanged) publishChanged(SettingsItem::LCD_BRIGHTNESS);
 }
 inline auto SettingsLogic::validateSettings() const -> bool {
     constexpr int MIN_LCD_BRIGHTNESS = 50;
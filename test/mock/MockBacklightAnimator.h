@@ -0,0 +1,39 @@
+#pragma once
+#include <stdint.h>
+#include "IBacklightAnimator.h"
+#include "ActuatorTimeline.h"
+
+// ActuatorTimeline on a manual clock: advanceTo() replays every timer wakeup up to ms.
+class MockBacklightAnimator : public IBacklightAnimator {
+public:
+    explicit MockBacklightAnimator(IBacklight* out, IVibrationOutput* vibration = nullptr)
+        : timeline(out, vibration), nowMs(0), plays(0), alerts(0) {}
+
+    void play(const BacklightPattern& pattern) override {
+        ++plays;
+        timeline.playBacklight(pattern, nowMs);
+        timeline.runDue(nowMs);
+    }
+    void playAlert(const BacklightPattern& pattern, const HapticPattern& haptics) override {
+        ++alerts;
+        timeline.playAlert(pattern, haptics, nowMs);
+        timeline.runDue(nowMs);
+    }
+    void stop() override { timeline.stopAll(); }
+    bool isActive() const override { return timeline.isBacklightActive(); }
+    uint8_t getLastBrightness() const override { return timeline.getLastBrightness(); }
+
+    void advanceTo(uint32_t ms) {
+        uint32_t due = 0;
+        while (timeline.nextDeadline(due) && static_cast<int32_t>(due - ms) <= 0) {
+            nowMs = due;
+            timeline.runDue(nowMs);
+        }
+        nowMs = ms;
+    }
+
+    ActuatorTimeline timeline;
+    uint32_t nowMs;
+    int plays;
+    int alerts;
+};
@@ -5,7 +5,8 @@
 class MockVibrationOut : public IVibrationOutput {
 public:
     uint8_t lastDuty = 0;
-    void setDutyPercent(uint8_t dutyPercent) override { lastDuty = dutyPercent; }
+    int writes = 0;
+    void setDutyPercent(uint8_t dutyPercent) override { lastDuty = dutyPercent; ++writes; }
 };
 
 
@@ -0,0 +1,27 @@
+#pragma once
+#include <ctime>
+#include <cstdint>
+#include "ITimeService.h"
+
+// Host virtual clock: 64-bit monotonic microseconds advanced by the test.
+// monotonicMillis() truncates like millis() on device (wraps after 2^32 ms), so
+// soak tests can start just before the wrap and run past it in virtual time.
+class MockVirtualClock : public ITimeService {
+public:
+    explicit MockVirtualClock(int64_t monoUs = 0, time_t wallSec = 1735689600)
+        : monoUs_(monoUs), wallUs_(static_cast<int64_t>(wallSec) * 1000000) {}
+
+    void advanceUs(int64_t us) { monoUs_ += us; wallUs_ += us; }
+    void advanceMs(int64_t ms) { advanceUs(ms * 1000); }
+
+    time_t now() const override { return static_cast<time_t>(wallUs_ / 1000000); }
+    struct tm* localtime(time_t* t) const override { return ::gmtime(t); }
+    int64_t nowMicros() const override { return wallUs_; }
+    bool setSystemTime(time_t t) override { wallUs_ = static_cast<int64_t>(t) * 1000000; return true; }
+    uint32_t monotonicMillis() const override { return static_cast<uint32_t>(monoUs_ / 1000); }
+    int64_t monotonicMicros() const override { return monoUs_; }
+
+private:
+    int64_t monoUs_;
+    int64_t wallUs_;
+};
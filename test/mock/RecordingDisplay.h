@@ -0,0 +1,86 @@
+#pragma once
+#include <stdint.h>
+#include <cstring>
+#include "IDisplay.h"
+#include "ChromeCache.h"
+#include "ui_constants.h"
+
+// IDisplay that records how many pixels each call sends to the panel and estimates the SPI time.
+// Text is costed as its glyph boxes (approximate per-font cell sizes), fills and cells as their area.
+// chromeCaching=false models the previous behaviour: no ChromeCache, clearBody() is a full clear().
+class RecordingDisplay : public IDisplay {
+public:
+    static constexpr uint32_t kSpiHz = 40000000;  // Core2/Fire LCD SPI clock
+    static constexpr uint32_t kCommandOverheadBits = 11 * 8; // CASET/RASET/RAMWR per window
+
+    explicit RecordingDisplay(bool chromeCaching = true) : caching_(chromeCaching) { reset(); }
+
+    void reset() {
+        pixels = 0;
+        windows = 0;
+        clears = 0;
+        bodyClears = 0;
+        cells = 0;
+    }
+    // Estimated transfer time of everything recorded since reset()
+    uint32_t transferUs() const {
+        const uint64_t bits = pixels * 16ULL + windows * static_cast<uint64_t>(kCommandOverheadBits);
+        return static_cast<uint32_t>(bits * 1000000ULL / kSpiHz);
+    }
+
+    void clear() override {
+        ++clears;
+        window(SCREEN_WIDTH, SCREEN_HEIGHT);
+        chrome_.invalidate();
+    }
+    void clearBody() override {
+        if (!caching_) { clear(); return; }
+        ++bodyClears;
+        window(SCREEN_WIDTH, SCREEN_HEIGHT - TITLE_HEIGHT - HINT_HEIGHT);
+    }
+    ChromeCache* chromeCache() override { return caching_ ? &chrome_ : nullptr; }
+    void drawTextCell(int x, int y, int w, int h, int textX, int textY, const char* text, int font,
+                      uint16_t color, uint16_t bgColor) override {
+        if (!caching_) {
+            IDisplay::drawTextCell(x, y, w, h, textX, textY, text, font, color, bgColor);
+            return;
+        }
+        ++cells;
+        window(w, h); // one pre-rendered blit
+    }
+    void drawText(int, int, const char* text, int fontSize) override {
+        if (text == nullptr) return;
+        int cw = 8, ch = 16;
+        if (fontSize == FONT_MAIN) { cw = 14; ch = 26; }
+        else if (fontSize == FONT_IMPORTANT) { cw = 32; ch = 48; }
+        window(static_cast<int>(std::strlen(text)) * cw, ch);
+    }
+    void setTextColor(uint16_t, uint16_t) override {}
+    void fillRect(int, int, int w, int h, uint16_t) override { window(w, h); }
+    void drawRect(int, int, int w, int h, uint16_t) override { window(w, 1); window(w, 1); window(1, h); window(1, h); }
+    void setTextDatum(uint8_t) override {}
+    void setTextFont(int) override {}
+    void fillProgressBarSprite(int, int, int w, int h, int) override { window(w, h); }
+    void drawLine(int x0, int y0, int x1, int y1, uint16_t) override {
+        const int dx = x1 > x0 ? x1 - x0 : x0 - x1;
+        const int dy = y1 > y0 ? y1 - y0 : y0 - y1;
+        window((dx > dy ? dx : dy) + 1, 1);
+    }
+    int getTextDatum() const override { return 0; }
+
+    uint64_t pixels;
+    uint32_t windows;
+    int clears;
+    int bodyClears;
+    int cells;
+
+private:
+    void window(int w, int h) {
+        if (w <= 0 || h <= 0) return;
+        pixels += static_cast<uint64_t>(w) * static_cast<uint64_t>(h);
+        ++windows;
+    }
+
+    bool caching_;
+    ChromeCache chrome_;
+};
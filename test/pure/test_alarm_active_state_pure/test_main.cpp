@@ -1,6 +1,7 @@
 #include <unity.h>
 #include "AlarmActiveState.h"
-#include "BacklightSequencer.h"
+#include "../mock/MockBacklightAnimator.h"
+#include "../mock/MockVibrationOutput.h"
 
 namespace {
 struct DummyState : public IState {
@@ -26,27 +27,23 @@ struct MockBacklight : public IBacklight {
 void setUp() {}
 void tearDown() {}
 
-// 1) onEnter でデフォルトパターンが開始され、1秒(16f)の代表点が期待値になる
+// 1) onEnter でデフォルトパターンが開始され、1秒の代表点（旧 16fps の各フレーム位置）が期待値になる
 void test_alarm_enter_and_frame_progression(void) {
   StateManager mgr;
   DummyState main;
-  BacklightSequencer seq;
   MockBacklight out;
-  AlarmActiveState s(&mgr, &main, &seq, &out);
+  MockBacklightAnimator anim(&out);
+  AlarmActiveState s(&mgr, &main, &anim, &out);
 
   // ベースラインを作る: 事前に任意明度にしておく
-  seq.clear();
-  seq.enqueueStep(123, 1);
-  seq.start();
-  seq.tick(&out);
+  anim.timeline.setBrightness(123);
 
   // 鳴動開始
   s.onEnter();
-  // 1秒=16f の代表フレームを検証
-  // f0..f15: 255,255,0,0,255,255,0,0,255,255,0,0,0,0,0,0
+  // f0..f15 (62.5ms 間隔): 255,255,0,0,255,255,0,0,255,255,0,0,0,0,0,0
   const uint8_t expected[16] = {255,255,0,0,255,255,0,0,255,255,0,0,0,0,0,0};
   for (int i = 0; i < 16; ++i) {
-    seq.tick(&out);
+    anim.advanceTo(static_cast<uint32_t>(i * 625 / 10));
     TEST_ASSERT_EQUAL_UINT8(expected[i], out.last);
   }
 }
@@ -55,19 +52,20 @@ void test_alarm_enter_and_frame_progression(void) {
 void test_alarm_completion_restores_baseline(void) {
   StateManager mgr;
   DummyState main;
-  BacklightSequencer seq;
   MockBacklight out;
-  AlarmActiveState s(&mgr, &main, &seq, &out);
+  MockBacklightAnimator anim(&out);
+  AlarmActiveState s(&mgr, &main, &anim, &out);
 
-  // ベースライン=123
-  seq.clear(); seq.enqueueStep(123, 1); seq.start(); seq.tick(&out);
+  // ベースライン=123（設定なし → アニメータの最終明度）
+  anim.timeline.setBrightness(123);
 
   s.onEnter();
-  // 4秒=64f 進める
-  for (int i = 0; i < 64; ++i) { seq.tick(&out); }
+  anim.advanceTo(3999);
+  TEST_ASSERT_TRUE(anim.isActive());
+  anim.advanceTo(4000);
   // onDrawで終了検出→復帰を行う
   s.onDraw();
-  TEST_ASSERT_FALSE(seq.isActive());
+  TEST_ASSERT_FALSE(anim.isActive());
   TEST_ASSERT_EQUAL_UINT8(123, out.last);
 }
 
@@ -75,18 +73,55 @@ void test_alarm_completion_restores_baseline(void) {
 void test_alarm_immediate_stop_restores_baseline(void) {
   StateManager mgr;
   DummyState main;
-  BacklightSequencer seq;
   MockBacklight out;
-  AlarmActiveState s(&mgr, &main, &seq, &out);
+  MockBacklightAnimator anim(&out);
+  AlarmActiveState s(&mgr, &main, &anim, &out);
 
   // ベースライン=77
-  seq.clear(); seq.enqueueStep(77, 1); seq.start(); seq.tick(&out);
+  anim.timeline.setBrightness(77);
 
   s.onEnter();
-  seq.tick(&out); // 何フレームか進める
+  anim.advanceTo(100); // 少し進める
   s.onButtonA();  // 即時停止
-  // 即復帰していること
+  // 即復帰していること、以後アニメータは書き込まない
   TEST_ASSERT_EQUAL_UINT8(77, out.last);
+  const int calls = out.calls;
+  anim.advanceTo(300);
+  TEST_ASSERT_EQUAL_INT(calls, out.calls);
+}
+
+// 4) フラッシュ 1 周期の書き込みはエッジのみ（毎フレーム書かない）
+void test_alarm_writes_only_on_edges(void) {
+  StateManager mgr;
+  DummyState main;
+  MockBacklight out;
+  MockBacklightAnimator anim(&out);
+  AlarmActiveState s(&mgr, &main, &anim, &out);
+
+  s.onEnter();
+  anim.advanceTo(999);
+  TEST_ASSERT_EQUAL_INT(6, out.calls);
+}
+
+// 5) バイブのパルスはフラッシュと同一時刻原点（位相一致）、停止でバイブも止まる
+void test_alarm_haptics_phase_aligned_with_flash(void) {
+  StateManager mgr;
+  DummyState main;
+  MockBacklight out;
+  MockVibrationOut vib;
+  MockBacklightAnimator anim(&out, &vib);
+  AlarmActiveState s(&mgr, &main, &anim, &out);
+
+  anim.advanceTo(1234); // 任意の開始時刻
+  s.onEnter();
+  TEST_ASSERT_EQUAL_INT(1, anim.alerts);
+  for (uint32_t t = 0; t < 2000; t += 5) {
+    anim.advanceTo(1234 + t);
+    TEST_ASSERT_EQUAL_UINT8(out.last == 255 ? 100 : 0, vib.lastDuty);
+  }
+  s.onButtonB();
+  TEST_ASSERT_EQUAL_UINT8(0, vib.lastDuty);
+  TEST_ASSERT_FALSE(anim.timeline.isHapticsActive());
 }
 
 int main(int, char**) {
@@ -94,6 +129,7 @@ int main(int, char**) {
   RUN_TEST(test_alarm_enter_and_frame_progression);
   RUN_TEST(test_alarm_completion_restores_baseline);
   RUN_TEST(test_alarm_immediate_stop_restores_baseline);
+  RUN_TEST(test_alarm_writes_only_on_edges);
+  RUN_TEST(test_alarm_haptics_phase_aligned_with_flash);
   return UNITY_END();
 }
-
@@ -92,7 +92,7 @@ public:
 
 // テスト用のアラームリスト
 std::vector<time_t> test_alarm_times;
-extern std::vector<time_t> alarm_times; // 外部変数の宣言
+extern AlarmStore alarm_times; // 外部変数の宣言
 
 void setUp(void) {
     test_alarm_times.clear();
@@ -135,8 +135,8 @@ void test_AlarmDisplayState_MoveUp() {
     AlarmDisplayState state(&mockManager, &mockView, timeService);
     
     // アラームを追加
-    alarm_times.push_back(time(nullptr) + 3600);
-    alarm_times.push_back(time(nullptr) + 7200);
+    alarm_times.insert(time(nullptr) + 3600);
+    alarm_times.insert(time(nullptr) + 7200);
     
     state.setSelectedIndex(1);
     state.onButtonA(); // 上移動
@@ -152,8 +152,8 @@ void test_AlarmDisplayState_MoveDown() {
     AlarmDisplayState state(&mockManager, &mockView, timeService);
     
     // アラームを追加
-    alarm_times.push_back(time(nullptr) + 3600);
-    alarm_times.push_back(time(nullptr) + 7200);
+    alarm_times.insert(time(nullptr) + 3600);
+    alarm_times.insert(time(nullptr) + 7200);
     
     state.setSelectedIndex(0);
     state.onButtonB(); // 下移動
@@ -169,8 +169,8 @@ void test_AlarmDisplayState_MoveToTop() {
     AlarmDisplayState state(&mockManager, &mockView, timeService);
     
     // アラームを追加
-    alarm_times.push_back(time(nullptr) + 3600);
-    alarm_times.push_back(time(nullptr) + 7200);
+    alarm_times.insert(time(nullptr) + 3600);
+    alarm_times.insert(time(nullptr) + 7200);
     
     state.setSelectedIndex(1);
     state.onButtonALongPress(); // 一番上に移動
@@ -186,8 +186,8 @@ void test_AlarmDisplayState_MoveToBottom() {
     AlarmDisplayState state(&mockManager, &mockView, timeService);
     
     // アラームを追加
-    alarm_times.push_back(time(nullptr) + 3600);
-    alarm_times.push_back(time(nullptr) + 7200);
+    alarm_times.insert(time(nullptr) + 3600);
+    alarm_times.insert(time(nullptr) + 7200);
     
     state.setSelectedIndex(0);
     state.onButtonBLongPress(); // 一番下に移動
@@ -206,7 +206,7 @@ void test_AlarmDisplayState_DeleteAlarm_Normal() {
     
     // アラームを追加
     time_t alarmTime = time(nullptr) + 3600;
-    alarm_times.push_back(alarmTime);
+    alarm_times.insert(alarmTime);
     
     state.setSelectedIndex(0);
     size_t initialSize = alarm_times.size();
@@ -226,7 +226,7 @@ void test_AlarmDisplayState_DeleteAlarm_AlreadyRemoved() {
     alarm_times.clear(); // 明示的にリセット
     // アラームを追加して削除
     time_t alarmTime = time(nullptr) + 3600;
-    alarm_times.push_back(alarmTime);
+    alarm_times.insert(alarmTime);
     size_t initialSize = alarm_times.size();
     
     state.setSelectedIndex(0);
@@ -250,7 +250,7 @@ void test_AlarmDisplayState_HybridApproach_RealTimeUpdate() {
     timeService->setMillis(5000); // 5秒経過
     
     // アラームを追加して描画を有効にする
-    alarm_times.push_back(time(nullptr) + 3600);
+    alarm_times.insert(time(nullptr) + 3600);
     
     state.onDraw(); // リアルタイム更新が実行される
     
@@ -299,8 +299,8 @@ void test_AlarmDisplayState_BoundaryConditions() {
     AlarmDisplayState state(&mockManager, &mockView, timeService);
     
     // アラームを追加
-    alarm_times.push_back(time(nullptr) + 3600);
-    alarm_times.push_back(time(nullptr) + 7200);
+    alarm_times.insert(time(nullptr) + 3600);
+    alarm_times.insert(time(nullptr) + 7200);
     
     // 上端での移動制限
     state.setSelectedIndex(0);
@@ -323,8 +323,8 @@ void test_AlarmDisplayState_ValueBasedDeletion() {
     
     // 同じ時刻のアラームを複数追加
     time_t alarmTime = time(nullptr) + 3600;
-    alarm_times.push_back(alarmTime);
-    alarm_times.push_back(alarmTime); // 重複
+    alarm_times.insert(alarmTime);
+    alarm_times.insert(alarmTime); // 重複
     
     state.setSelectedIndex(0);
     size_t initialSize = alarm_times.size();
@@ -345,7 +345,7 @@ void test_AlarmDisplayState_TimeBasedDeletion_DisplayClear() {
     alarm_times.clear(); // 明示的にリセット
     // 過去のアラームを追加
     time_t pastAlarm = time(nullptr) - 3600; // 1時間前
-    alarm_times.push_back(pastAlarm);
+    alarm_times.insert(pastAlarm);
     
     // MockTimeServiceの時刻を未来に設定
     timeService->setTime(time(nullptr) + 3600); // 1時間後
@@ -387,9 +387,9 @@ void test_AlarmDisplayState_PartialAreaClear() {
     
     alarm_times.clear(); // 明示的にリセット
     // 複数のアラームを追加
-    alarm_times.push_back(time(nullptr) + 3600);
-    alarm_times.push_back(time(nullptr) + 7200);
-    alarm_times.push_back(time(nullptr) + 10800);
+    alarm_times.insert(time(nullptr) + 3600);
+    alarm_times.insert(time(nullptr) + 7200);
+    alarm_times.insert(time(nullptr) + 10800);
     
     state.onEnter();
     TEST_ASSERT_EQUAL(3, mockView.lastShownAlarms.size());
@@ -432,8 +432,8 @@ void test_AlarmDisplayState_MultipleEntryDisplayBug() {
     
     // アラームを追加
     alarm_times.clear();
-    alarm_times.push_back(time(nullptr) + 3600); // 1時間後
-    alarm_times.push_back(time(nullptr) + 7200); // 2時間後
+    alarm_times.insert(time(nullptr) + 3600); // 1時間後
+    alarm_times.insert(time(nullptr) + 7200); // 2時間後
     
     // 初回表示 - 正しく表示される
     state.onEnter();
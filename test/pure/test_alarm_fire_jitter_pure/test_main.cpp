@@ -0,0 +1,99 @@
+#include <unity.h>
+#include "AlarmFireJitter.h"
+#include "AlarmStore.h"
+
+// 単調時計だけを進めるホスト用の時計
+class FakeClock : public ITimeService {
+public:
+    FakeClock() : monoUs(1000000) {}
+    time_t now() const override { return 1000; }
+    struct tm* localtime(time_t* t) const override { return ::localtime(t); }
+    int64_t nowMicros() const override { return 1000LL * 1000000 + monoUs; }
+    bool setSystemTime(time_t) override { return true; }
+    uint32_t monotonicMillis() const override { return static_cast<uint32_t>(monoUs / 1000); }
+    int64_t monotonicMicros() const override { return monoUs; }
+    int64_t monoUs;
+};
+
+void setUp() {}
+void tearDown() {}
+
+void test_next_deadline_is_earliest() {
+    FakeClock clock;
+    AlarmStore store;
+    store.setTimeSource(&clock);
+    int64_t deadline = 0;
+    TEST_ASSERT_FALSE(store.nextDeadlineUs(deadline));
+    store.insert(2010);
+    store.insert(2005);
+    TEST_ASSERT_TRUE(store.nextDeadlineUs(deadline));
+    // 壁時計 = 単調時計 + 1000 秒
+    TEST_ASSERT_TRUE(deadline == 1005LL * 1000000);
+}
+
+void test_records_lateness_of_each_fired_alarm() {
+    FakeClock clock;
+    AlarmStore store;
+    store.setTimeSource(&clock);
+    AlarmFireJitter jitter(&store, &clock);
+    store.insert(1002);
+    store.insert(1003);
+    clock.monoUs = 3000000 + 1500; // 2 件とも締め切りを過ぎたフレーム
+    TEST_ASSERT_EQUAL_INT(2, (int)store.removeDue(0));
+    clock.monoUs += 500;           // 入場までの処理
+    jitter.onEntered();
+    AlarmFireJitter::Sample sample;
+    TEST_ASSERT_TRUE(jitter.takeSample(sample));
+    TEST_ASSERT_EQUAL_UINT32(1002000, sample.lateUs); // 先頭（最も早い締め切り）基準
+    TEST_ASSERT_EQUAL_UINT8(2, sample.alarms);
+    TEST_ASSERT_TRUE(sample.scheduledUs == 2000000);
+    TEST_ASSERT_FALSE(jitter.takeSample(sample));
+    TEST_ASSERT_EQUAL_UINT32(2, jitter.histogram().count());
+    TEST_ASSERT_EQUAL_UINT32(1002000, jitter.histogram().maxUs());
+    TEST_ASSERT_EQUAL_UINT32(1, jitter.histogram().misses()); // 1 件目だけ予算超え
+    TEST_ASSERT_EQUAL_UINT32(2100, jitter.histogram().percentileUs(500)); // 100us ビンの上端
+}
+
+void test_ignores_entries_without_a_fresh_batch() {
+    FakeClock clock;
+    AlarmStore store;
+    store.setTimeSource(&clock);
+    AlarmFireJitter jitter(&store, &clock);
+    AlarmFireJitter::Sample sample;
+    jitter.onEntered(); // 何も消化していない
+    TEST_ASSERT_FALSE(jitter.takeSample(sample));
+    // 別画面で消化された（鳴らなかった）バッチは後の入場で数えない
+    store.insert(1002);
+    clock.monoUs = 2000000;
+    store.removeDue(0);
+    clock.monoUs += 5000000;
+    jitter.onEntered();
+    TEST_ASSERT_FALSE(jitter.takeSample(sample));
+    // 同じバッチで二度は数えない
+    store.insert(1010);
+    clock.monoUs = 10000000;
+    store.removeDue(0);
+    jitter.onEntered();
+    jitter.onEntered();
+    TEST_ASSERT_EQUAL_UINT32(1, jitter.histogram().count());
+    TEST_ASSERT_TRUE(jitter.takeSample(sample));
+    TEST_ASSERT_EQUAL_UINT32(0, sample.lateUs);
+}
+
+void test_without_time_source_nothing_is_recorded() {
+    AlarmStore store;
+    AlarmFireJitter jitter(&store, nullptr);
+    store.insert(100);
+    store.removeDue(100);
+    jitter.onEntered();
+    TEST_ASSERT_EQUAL_UINT32(0, jitter.histogram().count());
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_next_deadline_is_earliest);
+    RUN_TEST(test_records_lateness_of_each_fired_alarm);
+    RUN_TEST(test_ignores_entries_without_a_fresh_batch);
+    RUN_TEST(test_without_time_source_nothing_is_recorded);
+    return UNITY_END();
+}
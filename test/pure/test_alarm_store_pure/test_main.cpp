@@ -0,0 +1,168 @@
+#include <unity.h>
+#include <string>
+#include "AlarmStore.h"
+#include "AlarmLogic.h"
+
+// 壁時計と単調時計を別々に動かせる時計（壁時計の段差 = 時刻同期/手動設定）
+class SteppableClock : public ITimeService {
+public:
+    SteppableClock() : wallUs(1000LL * 1000000), monoUs(5LL * 1000000) {}
+    time_t now() const override { return static_cast<time_t>(wallUs / 1000000); }
+    struct tm* localtime(time_t* t) const override { return ::localtime(t); }
+    int64_t nowMicros() const override { return wallUs; }
+    bool setSystemTime(time_t t) override { wallUs = static_cast<int64_t>(t) * 1000000; return true; }
+    uint32_t monotonicMillis() const override { return static_cast<uint32_t>(monoUs / 1000); }
+    int64_t monotonicMicros() const override { return monoUs; }
+    void advanceUs(int64_t us) { wallUs += us; monoUs += us; }
+    void stepWall(int64_t sec) { wallUs += sec * 1000000; }
+    int64_t wallUs;
+    int64_t monoUs;
+};
+
+void setUp() {}
+void tearDown() {}
+
+void test_insert_keeps_order_and_bumps_generation() {
+    AlarmStore store;
+    const uint32_t g0 = store.generation();
+    TEST_ASSERT_TRUE(g0 != 0);
+    store.insert(300);
+    store.insert(100);
+    store.insert(200);
+    TEST_ASSERT_EQUAL_UINT32(g0 + 3, store.generation());
+    TEST_ASSERT_EQUAL_INT(3, (int)store.size());
+    TEST_ASSERT_EQUAL_INT(100, (int)store[0]);
+    TEST_ASSERT_EQUAL_INT(200, (int)store[1]);
+    TEST_ASSERT_EQUAL_INT(300, (int)store.back());
+}
+
+void test_reads_do_not_copy_or_bump() {
+    AlarmStore store;
+    store.insert(100);
+    store.insert(200);
+    const uint32_t g = store.generation();
+    const std::vector<time_t>& view = store.times();
+    TEST_ASSERT_TRUE(view.data() == store.data());
+    int sum = 0;
+    for (AlarmStore::const_iterator it = store.begin(); it != store.end(); ++it) sum += (int)*it;
+    TEST_ASSERT_EQUAL_INT(300, sum);
+    TEST_ASSERT_EQUAL_INT(100, AlarmLogic::getRemainSec(store.times(), 0));
+    TEST_ASSERT_EQUAL_UINT32(g, store.generation());
+}
+
+void test_remove_up_to_bumps_only_when_something_elapsed() {
+    AlarmStore store;
+    store.insert(100);
+    store.insert(200);
+    const uint32_t g = store.generation();
+    AlarmLogic::removePastAlarms(store, 50);   // 何も消化されない定常フレーム
+    TEST_ASSERT_EQUAL_UINT32(g, store.generation());
+    AlarmLogic::removePastAlarms(store, 100);  // 同時刻は消化
+    TEST_ASSERT_EQUAL_UINT32(g + 1, store.generation());
+    TEST_ASSERT_EQUAL_INT(1, (int)store.size());
+    TEST_ASSERT_EQUAL_INT(200, (int)store.front());
+}
+
+void test_erase_by_value_and_no_op_mutations() {
+    AlarmStore store;
+    store.clear(); // 空の clear は変更なし
+    const uint32_t g0 = store.generation();
+    TEST_ASSERT_EQUAL_UINT32(g0, store.generation());
+    store.insert(100);
+    store.insert(200);
+    const uint32_t g = store.generation();
+    TEST_ASSERT_FALSE(store.erase(150));
+    TEST_ASSERT_EQUAL_UINT32(g, store.generation());
+    TEST_ASSERT_TRUE(store.erase(100));
+    TEST_ASSERT_EQUAL_UINT32(g + 1, store.generation());
+    store.pop_back();
+    TEST_ASSERT_TRUE(store.empty());
+}
+
+void test_relative_alarm_ignores_wall_clock_step() {
+    SteppableClock clock;
+    AlarmStore store;
+    store.setTimeSource(&clock);
+    AlarmLogic::initAlarms(store, clock.now()); // +10/+30/+60/+120 秒（相対）
+    // 壁時計が 1 時間進んでも、まとめて鳴らない
+    clock.stepWall(3600);
+    TEST_ASSERT_EQUAL_INT(0, (int)AlarmLogic::removePastAlarms(store, clock.now()));
+    TEST_ASSERT_TRUE(store.rebase());
+    TEST_ASSERT_EQUAL_INT(1000 + 3600 + 10, (int)store.front()); // 表示時刻が追従
+    // 壁時計が戻っても遅れない: 経過 10 秒で 1 件目
+    clock.stepWall(-7200);
+    TEST_ASSERT_TRUE(store.rebase());
+    clock.advanceUs(9999999);
+    TEST_ASSERT_EQUAL_INT(0, (int)store.removeDue(clock.now()));
+    clock.advanceUs(1);
+    TEST_ASSERT_EQUAL_INT(1, (int)store.removeDue(clock.now()));
+    TEST_ASSERT_EQUAL_INT(1000 - 3600 + 30, (int)store.front());
+}
+
+void test_absolute_alarm_follows_wall_clock_after_rebase() {
+    SteppableClock clock;
+    AlarmStore store;
+    store.setTimeSource(&clock);
+    store.insert(1600); // 10 分後の時刻指定
+    const uint32_t g = store.generation();
+    clock.stepWall(300); // 時刻同期で 5 分進んだ
+    TEST_ASSERT_FALSE(store.rebase()); // 表示（時刻/並び）は変わらない
+    TEST_ASSERT_EQUAL_UINT32(g, store.generation());
+    clock.advanceUs(299LL * 1000000);
+    TEST_ASSERT_EQUAL_INT(0, (int)store.removeDue(clock.now()));
+    clock.advanceUs(1000000);
+    TEST_ASSERT_EQUAL_INT(1, (int)store.removeDue(clock.now()));
+}
+
+void test_rebase_reorders_mixed_kinds() {
+    SteppableClock clock;
+    AlarmStore store;
+    store.setTimeSource(&clock);
+    store.insert(1100, AlarmKind::Relative); // 経過 100 秒後
+    store.insert(1200);                      // 時刻 1200
+    TEST_ASSERT_TRUE(store.kind(0) == AlarmKind::Relative);
+    clock.stepWall(150); // 時刻指定が先に来る
+    TEST_ASSERT_TRUE(store.rebase());
+    TEST_ASSERT_EQUAL_INT(1200, (int)store[0]);
+    TEST_ASSERT_EQUAL_INT(1250, (int)store[1]);
+    TEST_ASSERT_TRUE(store.kind(1) == AlarmKind::Relative);
+    TEST_ASSERT_TRUE(store.deadlineUs(0) < store.deadlineUs(1));
+}
+
+void test_sub_second_deadline() {
+    SteppableClock clock;
+    clock.wallUs += 400000; // 1000.4 秒
+    AlarmStore store;
+    store.setTimeSource(&clock);
+    store.insert(1001);
+    clock.advanceUs(599999);
+    TEST_ASSERT_EQUAL_INT(0, (int)store.removeDue(clock.now()));
+    clock.advanceUs(1);
+    TEST_ASSERT_EQUAL_INT(1, (int)store.removeDue(clock.now()));
+}
+
+void test_add_alarm_through_store() {
+    AlarmStore store;
+    AlarmLogic::initAlarms(store, 1000);
+    TEST_ASSERT_EQUAL_INT(4, (int)store.size());
+    const uint32_t g = store.generation();
+    AlarmLogic::AddAlarmResult result;
+    std::string msg;
+    TEST_ASSERT_TRUE(AlarmLogic::addAlarmAtTime(store, 1005, AlarmKind::Absolute, result, msg));
+    TEST_ASSERT_TRUE(store.generation() != g);
+    TEST_ASSERT_EQUAL_INT(1005, (int)store.front());
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_insert_keeps_order_and_bumps_generation);
+    RUN_TEST(test_reads_do_not_copy_or_bump);
+    RUN_TEST(test_remove_up_to_bumps_only_when_something_elapsed);
+    RUN_TEST(test_erase_by_value_and_no_op_mutations);
+    RUN_TEST(test_relative_alarm_ignores_wall_clock_step);
+    RUN_TEST(test_absolute_alarm_follows_wall_clock_after_rebase);
+    RUN_TEST(test_rebase_reorders_mixed_kinds);
+    RUN_TEST(test_sub_second_deadline);
+    RUN_TEST(test_add_alarm_through_store);
+    return UNITY_END();
+}
@@ -0,0 +1,133 @@
+#include <unity.h>
+#include "BacklightEngine.h"
+#include "AlertPatterns.h"
+
+class MockBacklight : public IBacklight {
+public:
+	MockBacklight() : lastBrightness(0), calls(0) {}
+	void setBrightness(uint8_t b) override { lastBrightness = b; ++calls; }
+	uint8_t lastBrightness;
+	int calls;
+};
+
+namespace {
+const BacklightKeyframe kFadeFrames[] = {
+	{   0,   0, 0 },
+	{ 100, 200, 1 }, // linear 0 → 200 over 100ms
+	{ 300, 200, 0 },
+};
+const BacklightPattern kFade = { kFadeFrames, 3, 400, 1 };
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_gamma_endpoints_and_monotonic() {
+	TEST_ASSERT_EQUAL_UINT8(0, BacklightEngine::gammaToPwm(0));
+	TEST_ASSERT_EQUAL_UINT8(1, BacklightEngine::gammaToPwm(1));
+	TEST_ASSERT_EQUAL_UINT8(255, BacklightEngine::gammaToPwm(255));
+	// perceptual midpoint is far below half PWM
+	TEST_ASSERT_TRUE(BacklightEngine::gammaToPwm(128) < 64);
+	for (int i = 1; i < 256; ++i) {
+		TEST_ASSERT_TRUE(BacklightEngine::gammaToPwm(static_cast<uint8_t>(i)) >=
+		                 BacklightEngine::gammaToPwm(static_cast<uint8_t>(i - 1)));
+	}
+}
+
+void test_pwm_to_level_inverts_gamma() {
+	TEST_ASSERT_EQUAL_UINT8(0, BacklightEngine::pwmToLevel(0));
+	TEST_ASSERT_EQUAL_UINT8(255, BacklightEngine::pwmToLevel(255));
+	for (int pwm = 0; pwm < 256; ++pwm) {
+		const uint8_t level = BacklightEngine::pwmToLevel(static_cast<uint8_t>(pwm));
+		TEST_ASSERT_TRUE(BacklightEngine::gammaToPwm(level) >= pwm);
+		if (level > 0) TEST_ASSERT_TRUE(BacklightEngine::gammaToPwm(static_cast<uint8_t>(level - 1)) < pwm);
+	}
+}
+
+void test_level_interpolates_ramp() {
+	TEST_ASSERT_EQUAL_UINT8(0, BacklightEngine::levelAt(kFade, 0));
+	TEST_ASSERT_EQUAL_UINT8(100, BacklightEngine::levelAt(kFade, 50));
+	TEST_ASSERT_EQUAL_UINT8(200, BacklightEngine::levelAt(kFade, 100));
+	TEST_ASSERT_EQUAL_UINT8(200, BacklightEngine::levelAt(kFade, 250));
+}
+
+void test_step_keyframe_jumps() {
+	TEST_ASSERT_EQUAL_UINT8(255, BacklightEngine::levelAt(AlertPatterns::kAlarmFlash, 124));
+	TEST_ASSERT_EQUAL_UINT8(0, BacklightEngine::levelAt(AlertPatterns::kAlarmFlash, 125));
+	TEST_ASSERT_EQUAL_UINT8(0, BacklightEngine::levelAt(AlertPatterns::kAlarmFlash, 999));
+}
+
+void test_update_writes_gamma_mapped_pwm() {
+	BacklightEngine e; MockBacklight out;
+	e.play(kFade, 1000);
+	e.update(1050, &out);
+	TEST_ASSERT_EQUAL_UINT8(BacklightEngine::gammaToPwm(100), out.lastBrightness);
+	TEST_ASSERT_EQUAL_UINT8(out.lastBrightness, e.getLastBrightness());
+}
+
+void test_update_skips_unchanged_pwm() {
+	BacklightEngine e; MockBacklight out;
+	e.play(kFade, 0);
+	e.update(150, &out);
+	e.update(200, &out);
+	e.update(250, &out);
+	TEST_ASSERT_EQUAL_INT(1, out.calls);
+}
+
+void test_next_update_steps_through_ramp_then_jumps_to_edge() {
+	BacklightEngine e;
+	e.play(kFade, 0);
+	TEST_ASSERT_EQUAL_UINT32(BacklightEngine::kRampStepMs, e.nextUpdateAtMs(0));
+	TEST_ASSERT_EQUAL_UINT32(100, e.nextUpdateAtMs(95));   // never overshoots the keyframe
+	TEST_ASSERT_EQUAL_UINT32(300, e.nextUpdateAtMs(100));  // hold: sleep until the edge
+	TEST_ASSERT_EQUAL_UINT32(400, e.nextUpdateAtMs(300));  // last keyframe: until the end
+}
+
+void test_finite_loops_end_and_keep_last() {
+	BacklightEngine e; MockBacklight out;
+	e.play(AlertPatterns::kAlarmFlash, 0);
+	e.update(3500, &out);
+	TEST_ASSERT_TRUE(e.isActive());
+	e.update(4000, &out);
+	TEST_ASSERT_FALSE(e.isActive());
+	TEST_ASSERT_EQUAL_UINT8(0, out.lastBrightness);
+}
+
+void test_repeat_forever_wraps() {
+	const BacklightPattern forever = { kFadeFrames, 3, 400, 0 };
+	BacklightEngine e; MockBacklight out;
+	e.play(forever, 0);
+	e.update(400 * 1000 + 50, &out);
+	TEST_ASSERT_TRUE(e.isActive());
+	TEST_ASSERT_EQUAL_UINT8(BacklightEngine::gammaToPwm(100), out.lastBrightness);
+}
+
+void test_millis_wrap() {
+	BacklightEngine e; MockBacklight out;
+	e.play(kFade, 0xFFFFFFE0u);
+	e.update(0x00000012u, &out); // 50ms after start
+	TEST_ASSERT_EQUAL_UINT8(BacklightEngine::gammaToPwm(100), out.lastBrightness);
+}
+
+void test_empty_pattern_is_ignored() {
+	const BacklightPattern empty = { nullptr, 0, 0, 1 };
+	BacklightEngine e;
+	e.play(empty, 0);
+	TEST_ASSERT_FALSE(e.isActive());
+}
+
+int main(int, char**) {
+	UNITY_BEGIN();
+	RUN_TEST(test_gamma_endpoints_and_monotonic);
+	RUN_TEST(test_pwm_to_level_inverts_gamma);
+	RUN_TEST(test_level_interpolates_ramp);
+	RUN_TEST(test_step_keyframe_jumps);
+	RUN_TEST(test_update_writes_gamma_mapped_pwm);
+	RUN_TEST(test_update_skips_unchanged_pwm);
+	RUN_TEST(test_next_update_steps_through_ramp_then_jumps_to_edge);
+	RUN_TEST(test_finite_loops_end_and_keep_last);
+	RUN_TEST(test_repeat_forever_wraps);
+	RUN_TEST(test_millis_wrap);
+	RUN_TEST(test_empty_pattern_is_ignored);
+	return UNITY_END();
+}
@@ -0,0 +1,91 @@
+#include <unity.h>
+#include "BatteryTelemetry.h"
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_unknown_until_first_sample() {
+    BatteryTelemetry t;
+    TEST_ASSERT_EQUAL_INT(-1, t.batteryStatus().percent);
+    TEST_ASSERT_TRUE(t.isSampleDue(0));
+    t.addSample(0, 73, 3950, false);
+    TEST_ASSERT_EQUAL_INT(73, t.batteryStatus().percent);
+    TEST_ASSERT_EQUAL_UINT16(3950, t.batteryStatus().millivolts);
+    TEST_ASSERT_EQUAL_UINT32(1, t.generation());
+}
+
+void test_sampling_interval_is_wrap_safe() {
+    BatteryTelemetry t;
+    t.addSample(0xFFFFF000u, 50, 3800, false);
+    TEST_ASSERT_FALSE(t.isSampleDue(0xFFFFF000u + BatteryTelemetry::kSampleIntervalMs - 1));
+    TEST_ASSERT_TRUE(t.isSampleDue(0xFFFFF000u + BatteryTelemetry::kSampleIntervalMs));
+}
+
+void test_single_outlier_is_smoothed() {
+    BatteryTelemetry t;
+    t.addSample(0, 60, 3900, false);
+    t.addSample(10000, 40, 3700, false); // 一瞬の電圧降下（バックライト点灯など）
+    TEST_ASSERT_EQUAL_INT(55, t.batteryStatus().percent);
+    TEST_ASSERT_EQUAL_UINT16(3850, t.batteryStatus().millivolts);
+}
+
+void test_noise_around_step_does_not_flicker() {
+    BatteryTelemetry t;
+    t.addSample(0, 50, 3800, false);
+    const uint32_t gen = t.generation();
+    for (int i = 1; i <= 20; ++i) {
+        t.addSample(i * 10000u, (i % 2) ? 51 : 50, 3800, false);
+    }
+    TEST_ASSERT_EQUAL_INT(50, t.batteryStatus().percent);
+    TEST_ASSERT_EQUAL_UINT32(gen, t.generation());
+}
+
+void test_sustained_drop_is_followed() {
+    BatteryTelemetry t;
+    t.addSample(0, 50, 3800, false);
+    for (int i = 1; i <= 20; ++i) t.addSample(i * 10000u, 45, 3750, false);
+    TEST_ASSERT_EQUAL_INT(45, t.batteryStatus().percent);
+}
+
+void test_charging_change_publishes_immediately() {
+    BatteryTelemetry t;
+    t.addSample(0, 30, 3700, false);
+    const uint32_t gen = t.generation();
+    t.addSample(10000, 34, 4100, true);
+    TEST_ASSERT_TRUE(t.batteryStatus().charging);
+    TEST_ASSERT_EQUAL_INT(34, t.batteryStatus().percent);
+    TEST_ASSERT_EQUAL_UINT32(gen + 1, t.generation());
+}
+
+void test_invalid_level_is_ignored() {
+    BatteryTelemetry t;
+    t.addSample(0, 70, 3900, false);
+    t.addSample(10000, -1, 0, false);
+    TEST_ASSERT_EQUAL_INT(70, t.batteryStatus().percent);
+    TEST_ASSERT_FALSE(t.isSampleDue(10001)); // 失敗でも次の読み出しは間隔を空ける
+}
+
+void test_title_indicator_tracks_generation() {
+    BatteryTelemetry t;
+    TitleBatteryIndicator indicator;
+    TEST_ASSERT_EQUAL_INT(-1, indicator.take().percent);
+    TEST_ASSERT_FALSE(indicator.changed());
+    indicator.setSource(&t);
+    t.addSample(0, 90, 4000, false);
+    TEST_ASSERT_TRUE(indicator.changed());
+    TEST_ASSERT_EQUAL_INT(90, indicator.take().percent);
+    TEST_ASSERT_FALSE(indicator.changed());
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_unknown_until_first_sample);
+    RUN_TEST(test_sampling_interval_is_wrap_safe);
+    RUN_TEST(test_single_outlier_is_smoothed);
+    RUN_TEST(test_noise_around_step_does_not_flicker);
+    RUN_TEST(test_sustained_drop_is_followed);
+    RUN_TEST(test_charging_change_publishes_immediately);
+    RUN_TEST(test_invalid_level_is_ignored);
+    RUN_TEST(test_title_indicator_tracks_generation);
+    return UNITY_END();
+}
@@ -0,0 +1,52 @@
+#include <unity.h>
+#include <cstring>
+#include "BootProfiler.h"
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static void test_marks_are_recorded_in_order(void) {
+	BootProfiler p;
+	p.mark("setup", 120000);
+	p.mark("m5_begin", 480000);
+	p.mark("first_frame", 530000);
+	TEST_ASSERT_EQUAL_UINT32(3, p.count());
+	TEST_ASSERT_EQUAL_STRING("m5_begin", p.at(1).name);
+	TEST_ASSERT_EQUAL_UINT32(530000, p.atUs("first_frame"));
+	TEST_ASSERT_EQUAL_UINT32(BootProfiler::kNotFound, p.atUs("wifi"));
+}
+
+static void test_timeline_csv(void) {
+	BootProfiler p;
+	p.mark("setup", 1000);
+	p.mark("first_frame", 1500);
+	char buf[128];
+	const size_t n = p.formatTimeline(buf, sizeof(buf));
+	TEST_ASSERT_EQUAL_STRING("phase,at_us,delta_us\nsetup,1000,0\nfirst_frame,1500,500\n", buf);
+	TEST_ASSERT_EQUAL_UINT32(std::strlen(buf), n);
+}
+
+static void test_timeline_truncates_at_line_boundary(void) {
+	BootProfiler p;
+	p.mark("setup", 1000);
+	p.mark("first_frame", 1500);
+	char buf[36];
+	p.formatTimeline(buf, sizeof(buf));
+	TEST_ASSERT_EQUAL_STRING("phase,at_us,delta_us\nsetup,1000,0\n", buf);
+}
+
+static void test_overflow_is_counted_not_written(void) {
+	BootProfiler p;
+	for (size_t i = 0; i < BootProfiler::kMaxMarks + 3; ++i) p.mark("x", static_cast<uint32_t>(i));
+	TEST_ASSERT_EQUAL_UINT32(BootProfiler::kMaxMarks, p.count());
+	TEST_ASSERT_EQUAL_UINT32(3, p.dropped());
+}
+
+int main(int, char**) {
+	UNITY_BEGIN();
+	RUN_TEST(test_marks_are_recorded_in_order);
+	RUN_TEST(test_timeline_csv);
+	RUN_TEST(test_timeline_truncates_at_line_boundary);
+	RUN_TEST(test_overflow_is_counted_not_written);
+	return UNITY_END();
+}
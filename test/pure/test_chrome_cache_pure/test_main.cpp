@@ -0,0 +1,172 @@
+#include <unity.h>
+#include <cstdio>
+#include <memory>
+#include <vector>
+#include <ctime>
+#include "ChromeCache.h"
+#include "DisplayCommon.h"
+#include "StateManager.h"
+#include "MainDisplayState.h"
+#include "InputDisplayState.h"
+#include "InputLogic.h"
+#include "TimeLogic.h"
+#include "AlarmLogic.h"
+#include "MainDisplayViewImpl.h"
+#include "InputDisplayViewImpl.h"
+#include "../mock/RecordingDisplay.h"
+
+extern AlarmStore alarm_times;
+
+namespace {
+struct FixedClock : public ITimeService {
+    time_t t{1700000000};
+    time_t now() const override { return t; }
+    struct tm* localtime(time_t* p) const override { return ::localtime(p); }
+    bool setSystemTime(time_t v) override { t = v; return true; }
+    uint32_t monotonicMillis() const override { return 0; }
+};
+
+// MAIN → INPUT → MAIN on one display; returns the estimated SPI time of both transitions
+struct TransitionRig {
+    explicit TransitionRig(bool chromeCaching)
+        : display(chromeCaching), mainView(&display), inputView(&display),
+          clock(std::make_shared<FixedClock>()), inputLogic(clock),
+          input(&inputLogic, &inputView, clock.get()),
+          main(&manager, &input, &mainView, &timeLogic, &alarmLogic) {
+        input.setManager(&manager);
+        input.setMainDisplayState(&main);
+    }
+
+    // Boot: full clear (as M5.begin) and the first frame
+    void boot() {
+        display.clear();
+        manager.setState(&main);
+        main.onDraw();
+        display.reset();
+    }
+
+    uint32_t toInput() {
+        display.reset();
+        main.onButtonA(); // setState → onEnter
+        input.onDraw();
+        return display.transferUs();
+    }
+
+    uint32_t toMain() {
+        display.reset();
+        manager.setState(&main);
+        main.onDraw();
+        return display.transferUs();
+    }
+
+    RecordingDisplay display;
+    MainDisplayViewImpl mainView;
+    InputDisplayViewImpl inputView;
+    std::shared_ptr<FixedClock> clock;
+    InputLogic inputLogic;
+    TimeLogic timeLogic;
+    AlarmLogic alarmLogic;
+    StateManager manager;
+    InputDisplayState input;
+    MainDisplayState main;
+};
+} // namespace
+
+void setUp(void) {}
+void tearDown(void) { alarm_times.clear(); }
+
+void test_update_reports_changes_only() {
+    ChromeCache c;
+    TEST_ASSERT_TRUE(c.update(ChromeCache::TitleLabel, "MAIN"));
+    TEST_ASSERT_FALSE(c.update(ChromeCache::TitleLabel, "MAIN"));
+    TEST_ASSERT_TRUE(c.update(ChromeCache::TitleLabel, "INPUT"));
+    // nullptr and "" are the same empty cell
+    TEST_ASSERT_TRUE(c.update(ChromeCache::HintB, nullptr));
+    TEST_ASSERT_FALSE(c.update(ChromeCache::HintB, ""));
+    TEST_ASSERT_TRUE(c.updateRule(ChromeCache::TitleRule));
+    TEST_ASSERT_FALSE(c.updateRule(ChromeCache::TitleRule));
+}
+
+void test_invalidate_forgets_cells_and_rules() {
+    ChromeCache c;
+    c.update(ChromeCache::HintA, "UP");
+    c.updateRule(ChromeCache::HintRule);
+    c.invalidate();
+    TEST_ASSERT_TRUE(c.update(ChromeCache::HintA, "UP"));
+    TEST_ASSERT_TRUE(c.updateRule(ChromeCache::HintRule));
+}
+
+void test_cells_tile_the_bars_without_overlap() {
+    int width = 0;
+    for (int i = ChromeCache::HintA; i <= ChromeCache::HintC; ++i) {
+        const ChromeCell& cell = ChromeCache::cell(static_cast<ChromeCache::Cell>(i));
+        TEST_ASSERT_EQUAL_INT(width, cell.x);
+        TEST_ASSERT_TRUE(cell.y > SCREEN_HEIGHT - HINT_HEIGHT);            // below the rule
+        TEST_ASSERT_TRUE(cell.textX >= cell.x && cell.textX < cell.x + cell.w);
+        width += cell.w;
+    }
+    TEST_ASSERT_EQUAL_INT(SCREEN_WIDTH, width);
+    const ChromeCell& label = ChromeCache::cell(ChromeCache::TitleLabel);
+    const ChromeCell& battery = ChromeCache::cell(ChromeCache::Battery);
+    TEST_ASSERT_EQUAL_INT(SCREEN_WIDTH, label.w + battery.w);
+    TEST_ASSERT_TRUE(label.y + label.h <= TITLE_HEIGHT - 1);                 // above the rule
+}
+
+void test_only_changed_hint_cells_are_blitted() {
+    RecordingDisplay d;
+    drawButtonHintsGrid(&d, "UP", "DOWN", "DEL");
+    TEST_ASSERT_EQUAL_INT(3, d.cells);
+    d.reset();
+    drawButtonHintsGrid(&d, "UP", "DOWN", "SELECT");
+    TEST_ASSERT_EQUAL_INT(1, d.cells);
+    TEST_ASSERT_EQUAL_UINT32(1, d.windows); // no rule either
+    d.clear();
+    d.reset();
+    drawButtonHintsGrid(&d, "UP", "DOWN", "SELECT");
+    TEST_ASSERT_EQUAL_INT(3, d.cells);      // everything after a full clear
+}
+
+void test_unchanged_battery_is_not_redrawn() {
+    RecordingDisplay d;
+    drawTitleBar(&d, "MAIN", 80, false);
+    d.reset();
+    drawTitleBar(&d, "ALARM", 80, false);
+    TEST_ASSERT_EQUAL_INT(1, d.cells);
+    drawTitleBar(&d, "ALARM", 79, false);
+    TEST_ASSERT_EQUAL_INT(2, d.cells);
+}
+
+void test_main_input_main_transitions_touch_only_body_and_changed_chrome() {
+    TransitionRig cached(true);
+    TransitionRig legacy(false);
+    cached.boot();
+    legacy.boot();
+    const uint32_t cachedIn = cached.toInput();
+    const int cellsIn = cached.display.cells;
+    const uint32_t cachedOut = cached.toMain();
+    const uint32_t legacyIn = legacy.toInput();
+    const uint32_t legacyOut = legacy.toMain();
+    char msg[128];
+    std::snprintf(msg, sizeof(msg), "MAIN->INPUT %u us (was %u us), INPUT->MAIN %u us (was %u us)",
+                  (unsigned)cachedIn, (unsigned)legacyIn, (unsigned)cachedOut, (unsigned)legacyOut);
+    TEST_MESSAGE(msg);
+    // no full-screen clear; title + 3 hints change, battery and rules stay
+    TEST_ASSERT_EQUAL_INT(0, cached.display.clears);
+    TEST_ASSERT_EQUAL_INT(4, cellsIn);
+    TEST_ASSERT_TRUE(cachedIn < legacyIn);
+    TEST_ASSERT_TRUE(cachedOut < legacyOut);
+    // the saving is at least the cleared chrome bands (2 x 320x20 px at 16 bit)
+    const uint32_t bandsUs = static_cast<uint32_t>(2ULL * SCREEN_WIDTH * TITLE_HEIGHT * 16 * 1000000ULL / RecordingDisplay::kSpiHz);
+    TEST_ASSERT_TRUE(legacyIn - cachedIn >= bandsUs / 2);
+}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_update_reports_changes_only);
+    RUN_TEST(test_invalidate_forgets_cells_and_rules);
+    RUN_TEST(test_cells_tile_the_bars_without_overlap);
+    RUN_TEST(test_only_changed_hint_cells_are_blitted);
+    RUN_TEST(test_unchanged_battery_is_not_redrawn);
+    RUN_TEST(test_main_input_main_transitions_touch_only_body_and_changed_chrome);
+    return UNITY_END();
+}
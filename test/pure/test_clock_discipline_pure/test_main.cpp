@@ -0,0 +1,247 @@
+#include <unity.h>
+#include "ClockDiscipline.h"
+#include "ClockDriftEstimator.h"
+#include "SlewPlanner.h"
+
+void setUp() {}
+void tearDown() {}
+
+static const int64_t kEpochUs = 1754892700LL * 1000000LL;
+static const int64_t kHourUs = 3600LL * 1000000LL;
+
+// --- ClockDriftEstimator ---
+void test_estimator_first_sync_only_sets_reference() {
+    ClockDriftEstimator e;
+    TEST_ASSERT_FALSE(e.observe(kEpochUs, 5000));
+    TEST_ASSERT_TRUE(e.hasReference());
+    TEST_ASSERT_FALSE(e.hasEstimate());
+}
+
+void test_estimator_measures_ppm_over_baseline() {
+    ClockDriftEstimator e;
+    e.setReference(kEpochUs);
+    // 36 ms fast after 1 h = +10 ppm
+    TEST_ASSERT_TRUE(e.observe(kEpochUs + kHourUs, 36000));
+    TEST_ASSERT_EQUAL_INT32(10000, e.driftPpb());
+}
+
+void test_estimator_accumulates_short_intervals() {
+    ClockDriftEstimator e;
+    e.setReference(kEpochUs);
+    TEST_ASSERT_FALSE(e.observe(kEpochUs + kHourUs / 4, 9000));
+    TEST_ASSERT_TRUE(e.observe(kEpochUs + kHourUs, 27000));
+    TEST_ASSERT_EQUAL_INT32(10000, e.driftPpb());
+}
+
+void test_estimator_averages_later_updates() {
+    ClockDriftEstimator e;
+    e.restore(10000);
+    e.setReference(kEpochUs);
+    // residual +4 ppm on top of the compensated 10 ppm → moves half way
+    e.observe(kEpochUs + kHourUs, 14400);
+    TEST_ASSERT_EQUAL_INT32(12000, e.driftPpb());
+}
+
+void test_estimator_ignores_implausible_rate() {
+    ClockDriftEstimator e;
+    e.setReference(kEpochUs);
+    TEST_ASSERT_FALSE(e.observe(kEpochUs + kHourUs, 10LL * 1000000LL));
+    TEST_ASSERT_FALSE(e.hasEstimate());
+}
+
+void test_estimator_restore_is_clamped() {
+    ClockDriftEstimator e;
+    e.restore(900000);
+    TEST_ASSERT_EQUAL_INT32(ClockDriftEstimator::kMaxDriftPpb, e.driftPpb());
+}
+
+// --- SlewPlanner ---
+void test_slew_is_rate_limited() {
+    SlewPlanner p(5000);
+    p.start(1000);
+    TEST_ASSERT_EQUAL_INT64(310, p.take(62));
+    TEST_ASSERT_EQUAL_INT64(690, p.remainingUs());
+}
+
+void test_slew_negative_offset_and_completion() {
+    SlewPlanner p(5000);
+    p.start(-400);
+    TEST_ASSERT_EQUAL_INT64(-400, p.take(1000));
+    TEST_ASSERT_FALSE(p.active());
+    TEST_ASSERT_EQUAL_INT64(0, p.take(1000));
+}
+
+void test_slew_carries_fractional_budget() {
+    SlewPlanner p(1500);
+    p.start(100);
+    int64_t sum = 0;
+    for (int i = 0; i < 10; ++i) sum += p.take(1); // 1.5 µs per ms
+    TEST_ASSERT_EQUAL_INT64(15, sum);
+}
+
+void test_slew_remaining_ms() {
+    SlewPlanner p(5000);
+    p.start(-1000000);
+    TEST_ASSERT_EQUAL_UINT32(200000, p.remainingMs());
+}
+
+// --- ClockDiscipline ---
+void test_discipline_large_offset_steps() {
+    ClockDiscipline d;
+    bool updated = true;
+    TEST_ASSERT_EQUAL_INT((int)ClockDiscipline::SyncAction::Step, (int)d.onSync(0, kEpochUs, updated));
+    TEST_ASSERT_FALSE(updated);
+    TEST_ASSERT_EQUAL_INT64(0, d.pendingSlewUs());
+}
+
+void test_discipline_small_offset_slews() {
+    ClockDiscipline d;
+    bool updated = false;
+    TEST_ASSERT_EQUAL_INT((int)ClockDiscipline::SyncAction::Slew, (int)d.onSync(kEpochUs + 800000, kEpochUs, updated));
+    TEST_ASSERT_EQUAL_INT64(-800000, d.pendingSlewUs());
+}
+
+void test_discipline_pending_slew_counts_as_corrected() {
+    ClockDiscipline d;
+    bool updated = false;
+    d.onSync(kEpochUs + 800000, kEpochUs, updated);
+    // clock not yet slewed: still +800 ms locally, but nothing new to correct
+    d.onSync(kEpochUs + 1000000 + 800000, kEpochUs + 1000000, updated);
+    TEST_ASSERT_EQUAL_INT64(-800000, d.pendingSlewUs());
+}
+
+void test_discipline_external_step_drops_slew() {
+    ClockDiscipline d;
+    bool updated = false;
+    d.onSync(kEpochUs + 800000, kEpochUs, updated);
+    d.onExternalStep();
+    TEST_ASSERT_EQUAL_INT64(0, d.pendingSlewUs());
+}
+
+void test_discipline_step_threshold_scales_with_slew_rate() {
+    ClockDiscipline d;
+    TEST_ASSERT_EQUAL_INT64(900000, d.stepThresholdUs());
+    ClockDiscipline slow(500);
+    TEST_ASSERT_EQUAL_INT64(90000, slow.stepThresholdUs());
+    bool updated = false;
+    TEST_ASSERT_EQUAL_INT((int)ClockDiscipline::SyncAction::Step, (int)slow.onSync(kEpochUs + 90001, kEpochUs, updated));
+    TEST_ASSERT_EQUAL_INT((int)ClockDiscipline::SyncAction::Step, (int)d.onSync(kEpochUs - 900001, kEpochUs, updated));
+}
+
+// Worst-case slewed offset is fully corrected within kMaxSlewSec
+void test_discipline_slew_converges_within_bound() {
+    ClockDiscipline d;
+    bool updated = false;
+    const int64_t offsetUs = d.stepThresholdUs();
+    TEST_ASSERT_EQUAL_INT((int)ClockDiscipline::SyncAction::Slew, (int)d.onSync(kEpochUs + offsetUs, kEpochUs, updated));
+    uint32_t monoMs = 0;
+    d.correctionDue(monoMs);
+    int64_t applied = 0;
+    for (uint32_t ms = 0; ms < ClockDiscipline::kMaxSlewSec * 1000u; ms += 62) {
+        monoMs += 62;
+        applied += d.correctionDue(monoMs);
+    }
+    monoMs += 1000; // the last partial frame
+    applied += d.correctionDue(monoMs);
+    TEST_ASSERT_EQUAL_INT64(0, d.pendingSlewUs());
+    TEST_ASSERT_EQUAL_INT64(-offsetUs, applied);
+}
+
+// Simulated oscillator running +30 ppm fast, synced every 2 h with a perfect source.
+// Tick = 62.5 ms (frame rate). Returns |local - true| just before the final sync.
+static int64_t simulate(ClockDiscipline& d, int syncs, bool& monotonic, int64_t& maxStepUs) {
+    const int64_t driftPpb = 30000;
+    const int64_t tickUs = 62500;
+    const int64_t syncEveryTicks = 2 * kHourUs / tickUs;
+    int64_t trueUs = kEpochUs;
+    int64_t localUs = 0;       // unset clock at boot
+    int64_t fracPpbUs = 0;
+    uint32_t monoMs = 0;
+    int64_t monoUsAcc = 0;
+    int64_t lastErr = 0;
+    monotonic = true;
+    maxStepUs = 0;
+    for (int s = 0; s < syncs; ++s) {
+        lastErr = localUs - trueUs;
+        bool updated = false;
+        if (d.onSync(localUs, trueUs, updated) == ClockDiscipline::SyncAction::Step) {
+            localUs = trueUs;
+        }
+        for (int64_t t = 0; t < syncEveryTicks; ++t) {
+            trueUs += tickUs;
+            fracPpbUs += tickUs * (1000000000LL + driftPpb);
+            const int64_t rawStep = fracPpbUs / 1000000000LL;
+            fracPpbUs -= rawStep * 1000000000LL;
+            monoUsAcc += rawStep;
+            monoMs = static_cast<uint32_t>(monoUsAcc / 1000);
+            const int64_t corr = d.correctionDue(monoMs);
+            const int64_t advance = rawStep + corr;
+            if (advance <= 0) monotonic = false;
+            const int64_t dev = advance - tickUs;
+            if (dev > maxStepUs) maxStepUs = dev;
+            if (-dev > maxStepUs) maxStepUs = -dev;
+            localUs += advance;
+        }
+    }
+    return lastErr < 0 ? -lastErr : lastErr;
+}
+
+void test_simulated_drift_converges() {
+    ClockDiscipline d;
+    bool monotonic = false;
+    int64_t maxStep = 0;
+    simulate(d, 5, monotonic, maxStep);
+    TEST_ASSERT_INT_WITHIN(1000, 30000, d.driftPpb());
+}
+
+void test_simulated_drift_residual_is_small() {
+    ClockDiscipline d;
+    bool monotonic = false;
+    int64_t maxStep = 0;
+    const int64_t err = simulate(d, 6, monotonic, maxStep);
+    // Uncompensated error over 2 h at 30 ppm would be 216 ms
+    TEST_ASSERT_LESS_THAN(10000, err);
+}
+
+void test_simulated_clock_never_jumps_after_first_sync() {
+    ClockDiscipline d;
+    bool monotonic = false;
+    int64_t maxStep = 0;
+    simulate(d, 4, monotonic, maxStep);
+    TEST_ASSERT_TRUE(monotonic);
+    // per-tick deviation bounded by slew rate (5000 ppm of 62.5 ms) + drift
+    TEST_ASSERT_LESS_OR_EQUAL(320 + 5, maxStep);
+}
+
+void test_restored_drift_compensates_from_first_tick() {
+    ClockDiscipline d;
+    d.restoreDriftPpb(30000);
+    d.correctionDue(0);
+    // 1000 s at 30 ppm = 30 ms pulled back
+    TEST_ASSERT_EQUAL_INT64(-30000, d.correctionDue(1000000));
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_estimator_first_sync_only_sets_reference);
+    RUN_TEST(test_estimator_measures_ppm_over_baseline);
+    RUN_TEST(test_estimator_accumulates_short_intervals);
+    RUN_TEST(test_estimator_averages_later_updates);
+    RUN_TEST(test_estimator_ignores_implausible_rate);
+    RUN_TEST(test_estimator_restore_is_clamped);
+    RUN_TEST(test_slew_is_rate_limited);
+    RUN_TEST(test_slew_negative_offset_and_completion);
+    RUN_TEST(test_slew_carries_fractional_budget);
+    RUN_TEST(test_slew_remaining_ms);
+    RUN_TEST(test_discipline_large_offset_steps);
+    RUN_TEST(test_discipline_small_offset_slews);
+    RUN_TEST(test_discipline_pending_slew_counts_as_corrected);
+    RUN_TEST(test_discipline_external_step_drops_slew);
+    RUN_TEST(test_discipline_step_threshold_scales_with_slew_rate);
+    RUN_TEST(test_discipline_slew_converges_within_bound);
+    RUN_TEST(test_simulated_drift_converges);
+    RUN_TEST(test_simulated_drift_residual_is_small);
+    RUN_TEST(test_simulated_clock_never_jumps_after_first_sync);
+    RUN_TEST(test_restored_drift_compensates_from_first_tick);
+    return UNITY_END();
+}
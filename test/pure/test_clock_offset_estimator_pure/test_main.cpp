@@ -0,0 +1,115 @@
+#include <unity.h>
+#include "ClockOffsetEstimator.h"
+
+using ClockOffsetEstimator::Sample;
+using ClockOffsetEstimator::Estimate;
+
+void setUp() {}
+void tearDown() {}
+
+// Device monotonic ms m corresponds to client epoch ms (m + kShift)
+static const int64_t kShift = 1754892700000LL;
+
+// Sample whose request takes upMs, device holds holdMs, response takes downMs
+static Sample makeSample(uint32_t recvMono, uint32_t upMs, uint32_t holdMs, uint32_t downMs) {
+    Sample s{};
+    s.deviceRecvMs = recvMono;
+    s.deviceSendMs = recvMono + holdMs;
+    s.clientSendMs = static_cast<int64_t>(recvMono) + kShift - upMs;
+    s.clientRecvMs = static_cast<int64_t>(recvMono) + holdMs + kShift + downMs;
+    return s;
+}
+
+void test_symmetric_sample_is_exact() {
+    const Sample s[] = { makeSample(1000, 20, 3, 20) };
+    Estimate e{};
+    TEST_ASSERT_TRUE(ClockOffsetEstimator::estimate(s, 1, e));
+    TEST_ASSERT_EQUAL_INT64((1003 + kShift) * 1000, e.anchorEpochUs);
+    TEST_ASSERT_EQUAL_UINT32(1003, e.anchorMonoMs);
+    TEST_ASSERT_EQUAL_UINT32(40000, e.delayUs);
+}
+
+void test_asymmetry_error_is_half_the_difference() {
+    // 30ms up / 10ms down → client looks 10ms behind
+    const Sample s[] = { makeSample(1000, 30, 0, 10) };
+    Estimate e{};
+    TEST_ASSERT_TRUE(ClockOffsetEstimator::estimate(s, 1, e));
+    TEST_ASSERT_EQUAL_INT64((1000 + kShift - 10) * 1000, e.anchorEpochUs);
+}
+
+void test_min_delay_sample_wins_over_slow_outlier() {
+    const Sample s[] = { makeSample(1000, 300, 1, 20), makeSample(2000, 5, 1, 5) };
+    Estimate e{};
+    TEST_ASSERT_TRUE(ClockOffsetEstimator::estimate(s, 2, e));
+    TEST_ASSERT_EQUAL_UINT32(2001, e.anchorMonoMs);
+    TEST_ASSERT_EQUAL_INT64((2001 + kShift) * 1000, e.anchorEpochUs);
+    TEST_ASSERT_EQUAL_INT(1, (int)e.used);
+}
+
+void test_near_best_samples_are_averaged_to_sub_ms() {
+    // +1ms and 0ms asymmetric errors averaged → 0.5ms
+    const Sample s[] = { makeSample(1000, 6, 0, 4), makeSample(1100, 5, 0, 5) };
+    Estimate e{};
+    TEST_ASSERT_TRUE(ClockOffsetEstimator::estimate(s, 2, e));
+    TEST_ASSERT_EQUAL_INT(2, (int)e.used);
+    TEST_ASSERT_EQUAL_INT64((1000 + kShift) * 1000 - 500, e.anchorEpochUs);
+}
+
+void test_rejects_negative_round_trip() {
+    Sample s = makeSample(1000, 5, 0, 5);
+    s.clientRecvMs = s.clientSendMs - 1;
+    uint32_t d = 0;
+    TEST_ASSERT_FALSE(ClockOffsetEstimator::sampleDelayMs(s, d));
+}
+
+void test_rejects_hold_longer_than_round_trip() {
+    Sample s = makeSample(1000, 5, 0, 5);
+    s.deviceSendMs = s.deviceRecvMs + 50;
+    uint32_t d = 0;
+    TEST_ASSERT_FALSE(ClockOffsetEstimator::sampleDelayMs(s, d));
+}
+
+void test_rejects_too_slow_sample() {
+    const Sample s = makeSample(1000, 1500, 0, 1500);
+    uint32_t d = 0;
+    TEST_ASSERT_FALSE(ClockOffsetEstimator::sampleDelayMs(s, d));
+}
+
+void test_no_valid_sample_returns_false() {
+    const Sample s[] = { makeSample(1000, 1500, 0, 1500) };
+    Estimate e{};
+    TEST_ASSERT_FALSE(ClockOffsetEstimator::estimate(s, 1, e));
+    TEST_ASSERT_FALSE(ClockOffsetEstimator::estimate(s, 0, e));
+}
+
+void test_monotonic_wrap_between_samples() {
+    const Sample s[] = { makeSample(0xFFFFFFF0u, 5, 0, 5), makeSample(0x10u, 5, 0, 5) };
+    Estimate e{};
+    TEST_ASSERT_TRUE(ClockOffsetEstimator::estimate(s, 2, e));
+    TEST_ASSERT_EQUAL_INT(2, (int)e.used);
+    // 0x10 is 0x20 ms after 0xFFFFFFF0
+    TEST_ASSERT_EQUAL_INT64(ClockOffsetEstimator::epochUsAt(e, 0xFFFFFFF0u) + 0x20 * 1000,
+                            ClockOffsetEstimator::epochUsAt(e, 0x10u));
+}
+
+void test_epoch_at_projects_forward() {
+    const Sample s[] = { makeSample(1000, 10, 0, 10) };
+    Estimate e{};
+    ClockOffsetEstimator::estimate(s, 1, e);
+    TEST_ASSERT_EQUAL_INT64((1250 + kShift) * 1000, ClockOffsetEstimator::epochUsAt(e, 1250));
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_symmetric_sample_is_exact);
+    RUN_TEST(test_asymmetry_error_is_half_the_difference);
+    RUN_TEST(test_min_delay_sample_wins_over_slow_outlier);
+    RUN_TEST(test_near_best_samples_are_averaged_to_sub_ms);
+    RUN_TEST(test_rejects_negative_round_trip);
+    RUN_TEST(test_rejects_hold_longer_than_round_trip);
+    RUN_TEST(test_rejects_too_slow_sample);
+    RUN_TEST(test_no_valid_sample_returns_false);
+    RUN_TEST(test_monotonic_wrap_between_samples);
+    RUN_TEST(test_epoch_at_projects_forward);
+    return UNITY_END();
+}
@@ -0,0 +1,140 @@
+#include <unity.h>
+#include "CompiledTimeZone.h"
+#include "TimeZoneUtil.h"
+#include "../../../src/generated/TzDatabase.h"
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+
+void setUp() {}
+void tearDown() {}
+
+namespace {
+const TzZone* zone(const char* name) {
+    return TimeZoneUtil::findZone(kTzZones, kTzZoneCount, name, std::strlen(name));
+}
+} // namespace
+
+// --- transitions ---
+void test_new_york_2025_transitions() {
+    CompiledTimeZone tz;
+    tz.setRule(zone("America/New_York")->rule);
+    TEST_ASSERT_EQUAL_INT64(1741503600LL, CompiledTimeZone::transitionUtc(2025, tz.rule().dstStart, -300));
+    TEST_ASSERT_EQUAL_INT64(1762063200LL, CompiledTimeZone::transitionUtc(2025, tz.rule().dstEnd, -240));
+    TEST_ASSERT_EQUAL_INT(-300, tz.offsetMinutesAt(1741503599));
+    TEST_ASSERT_EQUAL_INT(-240, tz.offsetMinutesAt(1741503600));
+    TEST_ASSERT_EQUAL_INT(-240, tz.offsetMinutesAt(1762063199));
+    TEST_ASSERT_EQUAL_INT(-300, tz.offsetMinutesAt(1762063200));
+}
+
+void test_sydney_dst_wraps_new_year() {
+    CompiledTimeZone tz;
+    tz.setRule(zone("Australia/Sydney")->rule);
+    TEST_ASSERT_EQUAL_INT(660, tz.offsetMinutesAt(1735689600));     // 2025-01-01: summer
+    TEST_ASSERT_EQUAL_INT(660, tz.offsetMinutesAt(1743868799));
+    TEST_ASSERT_EQUAL_INT(600, tz.offsetMinutesAt(1743868800));     // 2025-04-06 03:00 AEDT
+    TEST_ASSERT_EQUAL_INT(600, tz.offsetMinutesAt(1759593599));
+    TEST_ASSERT_EQUAL_INT(660, tz.offsetMinutesAt(1759593600));     // 2025-10-05 02:00 AEST
+    TEST_ASSERT_EQUAL_INT(660, tz.offsetMinutesAt(1767225600));     // 2026-01-01
+}
+
+void test_dublin_negative_dst() {
+    // IST (+1) is standard time; GMT is the "DST" of the winter rule
+    CompiledTimeZone tz;
+    tz.setRule(zone("Europe/Dublin")->rule);
+    TEST_ASSERT_EQUAL_INT(0, tz.offsetMinutesAt(1735689600));
+    TEST_ASSERT_EQUAL_INT(0, tz.offsetMinutesAt(1743296399));
+    TEST_ASSERT_EQUAL_INT(60, tz.offsetMinutesAt(1743296400));
+    TEST_ASSERT_EQUAL_INT(60, tz.offsetMinutesAt(1761440399));
+    TEST_ASSERT_EQUAL_INT(0, tz.offsetMinutesAt(1761440400));
+}
+
+void test_chatham_quarter_hour_offsets() {
+    CompiledTimeZone tz;
+    tz.setRule(zone("Pacific/Chatham")->rule);
+    TEST_ASSERT_EQUAL_INT(825, tz.offsetMinutesAt(1735689600));
+    TEST_ASSERT_EQUAL_INT(765, tz.offsetMinutesAt(1751328000));     // 2025-07-01
+}
+
+void test_fixed_offset_and_default_utc() {
+    CompiledTimeZone tz;
+    TEST_ASSERT_EQUAL_INT(0, tz.offsetMinutesAt(1751328000));
+    tz.setFixedOffset(-570);
+    TEST_ASSERT_FALSE(tz.hasDst());
+    TEST_ASSERT_EQUAL_INT(-570, tz.offsetMinutesAt(1751328000));
+}
+
+// --- broken-down time ---
+void test_to_local_fields() {
+    CompiledTimeZone tz;
+    tz.setRule(zone("America/New_York")->rule);
+    struct tm t{};
+    tz.toLocal(1754892706, t); // 2025-08-11 06:11:46 UTC → 02:11:46 EDT (Monday)
+    TEST_ASSERT_EQUAL_INT(125, t.tm_year);
+    TEST_ASSERT_EQUAL_INT(7, t.tm_mon);
+    TEST_ASSERT_EQUAL_INT(11, t.tm_mday);
+    TEST_ASSERT_EQUAL_INT(2, t.tm_hour);
+    TEST_ASSERT_EQUAL_INT(11, t.tm_min);
+    TEST_ASSERT_EQUAL_INT(46, t.tm_sec);
+    TEST_ASSERT_EQUAL_INT(1, t.tm_wday);
+    TEST_ASSERT_EQUAL_INT(222, t.tm_yday);
+    TEST_ASSERT_EQUAL_INT(1, t.tm_isdst);
+}
+
+void test_matches_libc_for_every_zone() {
+    // libc parses the same rule as a POSIX string; both must agree hour by hour (2025-2027)
+    const char* savedTz = std::getenv("TZ");
+    const std::string saved = savedTz ? savedTz : "";
+    for (size_t i = 0; i < kTzZoneCount; ++i) {
+        CompiledTimeZone tz;
+        tz.setRule(kTzZones[i].rule);
+        const std::string posix = TimeZoneUtil::buildPosixTzFromRule(kTzZones[i].rule);
+        setenv("TZ", posix.c_str(), 1);
+        tzset();
+        for (time_t t = 1735689600; t < 1830297600; t += 3600) {
+            struct tm ours{};
+            struct tm ref{};
+            tz.toLocal(t, ours);
+            localtime_r(&t, &ref);
+            if (ours.tm_hour != ref.tm_hour || ours.tm_mday != ref.tm_mday || ours.tm_min != ref.tm_min ||
+                ours.tm_isdst != ref.tm_isdst) {
+                TEST_FAIL_MESSAGE(kTzZones[i].name);
+            }
+        }
+    }
+    if (savedTz) setenv("TZ", saved.c_str(), 1); else unsetenv("TZ");
+    tzset();
+}
+
+// --- lookup ---
+void test_find_zone() {
+    TEST_ASSERT_NOT_NULL(zone("Asia/Tokyo"));
+    TEST_ASSERT_EQUAL_INT(540, zone("Asia/Tokyo")->rule.stdOffsetMin);
+    TEST_ASSERT_NULL(zone("Asia/Tokyo2"));
+    TEST_ASSERT_NULL(zone("Asia/Tok"));
+    TEST_ASSERT_NULL(zone("Mars/Olympus_Mons"));
+    TEST_ASSERT_NULL(TimeZoneUtil::findZone(kTzZones, kTzZoneCount, nullptr, 0));
+    // not NUL-terminated view (as parsed from the /time/set body)
+    const char body[] = "Europe/Paris\",";
+    TEST_ASSERT_NOT_NULL(TimeZoneUtil::findZone(kTzZones, kTzZoneCount, body, 12));
+}
+
+void test_generated_table_is_sorted() {
+    for (size_t i = 1; i < kTzZoneCount; ++i) {
+        TEST_ASSERT_TRUE(std::strcmp(kTzZones[i - 1].name, kTzZones[i].name) < 0);
+    }
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_new_york_2025_transitions);
+    RUN_TEST(test_sydney_dst_wraps_new_year);
+    RUN_TEST(test_dublin_negative_dst);
+    RUN_TEST(test_chatham_quarter_hour_offsets);
+    RUN_TEST(test_fixed_offset_and_default_utc);
+    RUN_TEST(test_to_local_fields);
+    RUN_TEST(test_matches_libc_for_every_zone);
+    RUN_TEST(test_find_zone);
+    RUN_TEST(test_generated_table_is_sorted);
+    return UNITY_END();
+}
@@ -0,0 +1,90 @@
+#include <unity.h>
+#include "CpuFrequencyGovernor.h"
+#include "FrameLoadMeter.h"
+
+void setUp(void) {}
+void tearDown(void) {}
+
+typedef CpuFrequencyGovernor Gov;
+
+static uint16_t settle(Gov& g, Gov::Workload w, uint32_t busyPermille) {
+	for (int i = 0; i < Gov::kLowerHoldFrames; ++i) g.update(0, w, busyPermille);
+	return g.currentMhz();
+}
+
+static void test_meter_ewma_and_peak(void) {
+	FrameLoadMeter m;
+	m.addFrame(31250, 62500);
+	TEST_ASSERT_EQUAL_UINT32(500, m.busyPermille()); // first sample taken as is
+	m.addFrame(0, 62500);
+	TEST_ASSERT_EQUAL_UINT32(375, m.busyPermille());
+	m.addFrame(90000, 62500); // overrun clamps to 100%
+	TEST_ASSERT_EQUAL_UINT32(531, m.busyPermille());
+	TEST_ASSERT_EQUAL_UINT32(62500, m.peakBusyUs());
+	m.addFrame(10, 0); // ignored
+	TEST_ASSERT_EQUAL_UINT32(3, m.frames());
+}
+
+static void test_idle_main_screen_settles_at_80(void) {
+	Gov g;
+	TEST_ASSERT_EQUAL_UINT16(240, g.currentMhz()); // boot at full clock
+	TEST_ASSERT_EQUAL_UINT16(80, settle(g, Gov::Workload::Idle, 20));
+}
+
+static void test_workload_floor(void) {
+	Gov g;
+	TEST_ASSERT_EQUAL_UINT16(160, settle(g, Gov::Workload::Radio, 0));
+	TEST_ASSERT_EQUAL_UINT16(160, settle(g, Gov::Workload::Interactive, 0));
+}
+
+static void test_busy_ratio_raises_immediately(void) {
+	Gov g;
+	settle(g, Gov::Workload::Idle, 0);
+	// 80MHz で 60% → 96MHz 相当が必要 → 160
+	TEST_ASSERT_EQUAL_UINT16(160, g.update(0, Gov::Workload::Idle, 600));
+	// 160MHz でも 90% → 288MHz 相当 → 上限 240
+	TEST_ASSERT_EQUAL_UINT16(240, g.update(0, Gov::Workload::Idle, 900));
+}
+
+static void test_lowering_needs_consecutive_frames(void) {
+	Gov g;
+	for (int i = 0; i < Gov::kLowerHoldFrames - 1; ++i) {
+		TEST_ASSERT_EQUAL_UINT16(240, g.update(0, Gov::Workload::Idle, 10));
+	}
+	g.update(0, Gov::Workload::Idle, 400); // 240 * 0.4 / 0.5 = 192 → vote for 240 resets
+	for (int i = 0; i < Gov::kLowerHoldFrames - 1; ++i) g.update(0, Gov::Workload::Idle, 10);
+	TEST_ASSERT_EQUAL_UINT16(240, g.currentMhz());
+	TEST_ASSERT_EQUAL_UINT16(80, g.update(0, Gov::Workload::Idle, 10));
+}
+
+static void test_boost_holds_max_until_expiry(void) {
+	Gov g;
+	settle(g, Gov::Workload::Radio, 0);
+	g.boost(1000, 500);
+	TEST_ASSERT_TRUE(g.isBoosting());
+	TEST_ASSERT_EQUAL_UINT16(240, g.update(1499, Gov::Workload::Radio, 0));
+	g.update(1500, Gov::Workload::Radio, 0);
+	TEST_ASSERT_FALSE(g.isBoosting());
+	TEST_ASSERT_EQUAL_UINT16(160, settle(g, Gov::Workload::Radio, 0));
+}
+
+static void test_boost_is_extended_not_shortened(void) {
+	Gov g;
+	g.boost(0xFFFFFF00u, 1000);   // across the millis wrap
+	g.boost(0xFFFFFF00u, 10);
+	TEST_ASSERT_EQUAL_UINT16(240, g.update(0x00000100u, Gov::Workload::Idle, 0));
+	g.update(0x000002E8u, Gov::Workload::Idle, 0);
+	TEST_ASSERT_FALSE(g.isBoosting());
+}
+
+int main(int, char**) {
+	UNITY_BEGIN();
+	RUN_TEST(test_meter_ewma_and_peak);
+	RUN_TEST(test_idle_main_screen_settles_at_80);
+	RUN_TEST(test_workload_floor);
+	RUN_TEST(test_busy_ratio_raises_immediately);
+	RUN_TEST(test_lowering_needs_consecutive_frames);
+	RUN_TEST(test_boost_holds_max_until_expiry);
+	RUN_TEST(test_boost_is_extended_not_shortened);
+	return UNITY_END();
+}
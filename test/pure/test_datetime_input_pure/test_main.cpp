@@ -1,9 +1,10 @@
 #include <unity.h>
 #include "DateTimeInputState.h"
 #include "ITimeService.h"
+#include "AlarmStore.h"
 #include <memory>
 
-extern std::vector<time_t> alarm_times;
+extern AlarmStore alarm_times;
 
 const time_t kFixedTestTime = 1700000000;
 struct MockTimeService : public ITimeService {
@@ -0,0 +1,207 @@
+#include <unity.h>
+#include <string>
+#include "EventBus.h"
+#include "AlarmStore.h"
+#include "RtcTimeService.h"
+#include "TimeSyncLogic.h"
+#include "TimeSyncDisplayState.h"
+#include "settings/SettingsLogic.h"
+#include "../mock/MockTimeSyncView.h"
+#include "../mock/MockTimeSyncController.h"
+
+void setUp() {}
+void tearDown() {}
+
+namespace {
+class SeqRandom : public IRandomProvider {
+public:
+    uint64_t getRandom64() override { return ++n; }
+    uint64_t n = 0;
+};
+
+class FakeClock : public ITimeService {
+public:
+    time_t now() const override { return nowSec; }
+    struct tm* localtime(time_t* t) const override { return ::localtime(t); }
+    bool setSystemTime(time_t t) override { nowSec = t; return true; }
+    uint32_t monotonicMillis() const override { return 0; }
+    time_t nowSec = 1750000000;
+};
+
+class CountingState : public IState {
+public:
+    void onEnter() override { ++enters; }
+    void onExit() override {}
+    void onDraw() override {}
+    void onButtonA() override {}
+    void onButtonB() override {}
+    void onButtonC() override {}
+    void onButtonALongPress() override {}
+    void onButtonBLongPress() override {}
+    void onButtonCLongPress() override {}
+    int enters = 0;
+};
+} // namespace
+
+void test_delivers_only_subscribed_topics() {
+    EventBus bus;
+    const EventBus::SubscriberId alarms = bus.subscribe(EventBus::mask(EventTopic::AlarmAdded) | EventBus::mask(EventTopic::AlarmFired));
+    const EventBus::SubscriberId clock = bus.subscribe(EventBus::mask(EventTopic::TimeChanged));
+    bus.publish(EventTopic::AlarmAdded, 123);
+    bus.publish(EventTopic::TimeChanged, -60);
+    bus.publish(EventTopic::SettingsChanged, 1); // 購読者なし
+    BusEvent e;
+    TEST_ASSERT_TRUE(bus.poll(alarms, e));
+    TEST_ASSERT_TRUE(e.topic == EventTopic::AlarmAdded);
+    TEST_ASSERT_EQUAL_INT(123, (int)e.value);
+    TEST_ASSERT_FALSE(bus.poll(alarms, e));
+    TEST_ASSERT_TRUE(bus.poll(clock, e));
+    TEST_ASSERT_EQUAL_INT(-60, (int)e.value);
+    TEST_ASSERT_EQUAL_UINT32(1, bus.stats(EventTopic::SettingsChanged).published);
+    TEST_ASSERT_EQUAL_UINT32(0, bus.stats(EventTopic::SettingsChanged).delivered);
+}
+
+void test_full_queue_drops_oldest_and_counts_per_topic() {
+    EventBus bus;
+    const EventBus::SubscriberId id = bus.subscribe(EventBus::mask(EventTopic::AlarmAdded) | EventBus::mask(EventTopic::TimeChanged));
+    bus.publish(EventTopic::TimeChanged, 0);
+    for (int i = 1; i <= (int)EventBus::kQueueDepth; ++i) bus.publish(EventTopic::AlarmAdded, i);
+    TEST_ASSERT_EQUAL_INT((int)EventBus::kQueueDepth, (int)bus.pending(id));
+    TEST_ASSERT_EQUAL_UINT32(1, bus.stats(EventTopic::TimeChanged).dropped);
+    TEST_ASSERT_EQUAL_UINT32(0, bus.stats(EventTopic::AlarmAdded).dropped);
+    BusEvent e;
+    TEST_ASSERT_TRUE(bus.poll(id, e));
+    TEST_ASSERT_TRUE(e.topic == EventTopic::AlarmAdded);
+    TEST_ASSERT_EQUAL_INT(1, (int)e.value);
+    TEST_ASSERT_EQUAL_UINT32(1, bus.totalDropped());
+    bus.resetStats();
+    TEST_ASSERT_EQUAL_UINT32(0, bus.totalDropped());
+}
+
+void test_subscriber_table_is_fixed_and_drain_discards() {
+    EventBus bus;
+    for (size_t i = 0; i < EventBus::kMaxSubscribers; ++i) {
+        TEST_ASSERT_TRUE(bus.subscribe(EventBus::mask(EventTopic::AlarmFired)) != EventBus::kNoSubscriber);
+    }
+    TEST_ASSERT_TRUE(bus.subscribe(EventBus::mask(EventTopic::AlarmFired)) == EventBus::kNoSubscriber);
+    bus.publish(EventTopic::AlarmFired, 1);
+    TEST_ASSERT_EQUAL_UINT32(EventBus::kMaxSubscribers, bus.stats(EventTopic::AlarmFired).delivered);
+    bus.drain(0);
+    BusEvent e;
+    TEST_ASSERT_FALSE(bus.poll(0, e));
+    TEST_ASSERT_TRUE(bus.poll(1, e));
+    TEST_ASSERT_FALSE(bus.poll(EventBus::kNoSubscriber, e));
+}
+
+void test_alarm_store_publishes_changes() {
+    EventBus bus;
+    const EventBus::SubscriberId id = bus.subscribe(0xFFFF);
+    AlarmStore store;
+    store.setEventBus(&bus);
+    store.insert(100);
+    store.insert(200);
+    store.removeDue(50);   // 何も消化されない: 通知なし
+    store.removeDue(150);
+    store.erase(200);
+    BusEvent e;
+    TEST_ASSERT_TRUE(bus.poll(id, e));
+    TEST_ASSERT_TRUE(e.topic == EventTopic::AlarmAdded);
+    TEST_ASSERT_EQUAL_INT(100, (int)e.value);
+    TEST_ASSERT_TRUE(bus.poll(id, e));
+    TEST_ASSERT_TRUE(bus.poll(id, e));
+    TEST_ASSERT_TRUE(e.topic == EventTopic::AlarmFired);
+    TEST_ASSERT_EQUAL_INT(1, (int)e.value);
+    TEST_ASSERT_TRUE(bus.poll(id, e));
+    TEST_ASSERT_TRUE(e.topic == EventTopic::AlarmRemoved);
+    TEST_ASSERT_EQUAL_INT(200, (int)e.value);
+    TEST_ASSERT_FALSE(bus.poll(id, e));
+}
+
+void test_settings_reset_publishes_only_changed_values() {
+    EventBus bus;
+    const EventBus::SubscriberId id = bus.subscribe(EventBus::mask(EventTopic::SettingsChanged));
+    SettingsLogic settings;
+    settings.setEventBus(&bus);
+    settings.resetSettings(); // 既定値のまま: 通知なし
+    settings.loadSettings();
+    TEST_ASSERT_EQUAL_INT(0, (int)bus.pending(id));
+    settings.setLcdBrightness(100);
+    bus.drain(id);
+    settings.resetSettings(); // 輝度だけ戻る
+    BusEvent e;
+    TEST_ASSERT_TRUE(bus.poll(id, e));
+    TEST_ASSERT_EQUAL_INT((int)SettingsItem::LCD_BRIGHTNESS, (int)e.value);
+    TEST_ASSERT_FALSE(bus.poll(id, e));
+}
+
+void test_time_service_publishes_step() {
+    EventBus bus;
+    const EventBus::SubscriberId id = bus.subscribe(EventBus::mask(EventTopic::TimeChanged));
+    FakeClock clock;
+    RtcTimeService service(&clock, nullptr);
+    service.setEventBus(&bus);
+    TEST_ASSERT_TRUE(service.setSystemTime(clock.nowSec + 90));
+    BusEvent e;
+    TEST_ASSERT_TRUE(bus.poll(id, e));
+    TEST_ASSERT_EQUAL_INT(90, (int)e.value);
+}
+
+void test_sync_logic_publishes_transitions_once() {
+    EventBus bus;
+    const EventBus::SubscriberId id = bus.subscribe(EventBus::mask(EventTopic::SyncStatusChanged));
+    TimeSyncLogic logic;
+    logic.setEventBus(&bus);
+    SeqRandom rnd;
+    FakeClock clock;
+    logic.begin(&rnd, &clock);
+    logic.onStationConnected();
+    logic.onStationConnected(); // 変化なし
+    BusEvent e;
+    TEST_ASSERT_TRUE(bus.poll(id, e));
+    TEST_ASSERT_EQUAL_INT((int)TimeSyncLogic::Status::Step1, (int)e.value);
+    TEST_ASSERT_TRUE(bus.poll(id, e));
+    TEST_ASSERT_EQUAL_INT((int)TimeSyncLogic::Status::Step2, (int)e.value);
+    TEST_ASSERT_FALSE(bus.poll(id, e));
+}
+
+void test_time_sync_screen_acts_only_on_events() {
+    EventBus bus;
+    MockTimeSyncView view;
+    MockTimeSyncController controller;
+    StateManager manager;
+    CountingState mainState;
+    TimeSyncDisplayState state(&view, &controller);
+    state.setEventBus(&bus);
+    state.setManager(&manager);
+    state.setMainDisplayState(&mainState);
+    // 前回セッションの AppliedOk は入場時に捨てる
+    bus.publish(EventTopic::SyncStatusChanged, (int)ITimeSyncController::Status::AppliedOk);
+    manager.setState(&state);
+    controller.status = ITimeSyncController::Status::Step2;
+    state.onDraw();
+    TEST_ASSERT_FALSE(view.calledShowUrlQr); // 通知が来るまでステータスを見ない
+    TEST_ASSERT_EQUAL_INT(0, mainState.enters);
+    bus.publish(EventTopic::SyncStatusChanged, (int)ITimeSyncController::Status::Step2);
+    state.onDraw();
+    TEST_ASSERT_TRUE(view.calledShowUrlQr);
+    // 通知は起床の合図: 状態はコントローラの getStatus() から読む
+    controller.status = ITimeSyncController::Status::AppliedOk;
+    state.onDraw();
+    TEST_ASSERT_EQUAL_INT(0, mainState.enters);
+    bus.publish(EventTopic::SyncStatusChanged, (int)TimeSyncLogic::Status::AppliedOk);
+    state.onDraw();
+    TEST_ASSERT_EQUAL_INT(1, mainState.enters);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_delivers_only_subscribed_topics);
+    RUN_TEST(test_full_queue_drops_oldest_and_counts_per_topic);
+    RUN_TEST(test_subscriber_table_is_fixed_and_drain_discards);
+    RUN_TEST(test_alarm_store_publishes_changes);
+    RUN_TEST(test_settings_reset_publishes_only_changed_values);
+    RUN_TEST(test_time_service_publishes_step);
+    RUN_TEST(test_sync_logic_publishes_transitions_once);
+    RUN_TEST(test_time_sync_screen_acts_only_on_events);
+    return UNITY_END();
+}
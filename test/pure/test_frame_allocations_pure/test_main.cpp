@@ -0,0 +1,238 @@
+#include <unity.h>
+#include <memory>
+#include <vector>
+#include <ctime>
+#include "AllocationStats.h"
+#include "FrameArena.h"
+#include "StateManager.h"
+#include "MainDisplayState.h"
+#include "InputDisplayState.h"
+#include "AlarmDisplayState.h"
+#include "SettingsDisplayState.h"
+#include "DateTimeInputState.h"
+#include "AlarmActiveState.h"
+#include "TimeSyncDisplayState.h"
+#include "InputLogic.h"
+#include "TimeLogic.h"
+#include "AlarmLogic.h"
+#include "settings/SettingsLogic.h"
+#include "../mock/MockTimeSyncController.h"
+#include "../mock/MockBacklightAnimator.h"
+
+// 定常状態（入力なし・表示内容の変化なし）のフレームは 1 回もヒープ確保しないこと。
+// ビューはすべて呼び出し回数だけ数える（保存しない）モックなので、計測対象は状態とロジック層。
+
+extern AlarmStore alarm_times;
+
+namespace {
+const time_t kNow = 1700000000;
+const int kWarmupFrames = 3;
+const int kMeasuredFrames = 50;
+
+struct FixedClock : public ITimeService {
+    time_t t{kNow};
+    uint32_t ms{0};
+    time_t now() const override { return t; }
+    struct tm* localtime(time_t* p) const override { return ::localtime(p); }
+    bool setSystemTime(time_t v) override { t = v; return true; }
+    uint32_t monotonicMillis() const override { return ms; }
+};
+
+struct NullMainView : public IMainDisplayView {
+    int calls{0};
+    void showTitle(const char*, int, bool) override { ++calls; }
+    void showTime(const char*) override { ++calls; }
+    void showRemain(const char*) override { ++calls; }
+    void showProgress(int) override { ++calls; }
+    void showAlarmList(const FrameStringList&) override { ++calls; }
+    void showHints(const char*, const char*, const char*) override { ++calls; }
+    void clear() override { ++calls; }
+};
+struct NullInputView : public IInputDisplayView {
+    void showTitle(const char*, int, bool) override {}
+    void showHints(const char*, const char*, const char*) override {}
+    void showPreview(const char*) override {}
+    void clear() override {}
+    void showDigit(int, int, bool) override {}
+    void showColon() override {}
+};
+struct NullAlarmView : public IAlarmDisplayView {
+    void showTitle(const char*, int, bool) override {}
+    void showHints(const char*, const char*, const char*) override {}
+    void showAlarmList(const std::vector<time_t>&, size_t) override {}
+    void showNoAlarms() override {}
+    void clear() override {}
+};
+struct NullSettingsView : public ISettingsDisplayView {
+    void showTitle(const char*, int, bool) override {}
+    void showHints(const char*, const char*, const char*) override {}
+    void showSettingsList(const std::vector<std::string>&, size_t) override {}
+    void clear() override {}
+};
+struct NullDateTimeView : public IDateTimeInputView {
+    void clear() override {}
+    void showTitle(const char*, int, bool) override {}
+    void showHints(const char*, const char*, const char*) override {}
+    void showDateTimeString(const std::string&, int) override {}
+    void showErrorMessage(const std::string&) override {}
+};
+struct NullTimeSyncView : public ITimeSyncView {
+    void showTitle(const char*) override {}
+    void showHints(const char*, const char*, const char*) override {}
+    void showWifiQr(const char*) override {}
+    void showUrlQr(const char*) override {}
+    void showError(const char*) override {}
+};
+struct NullBacklight : public IBacklight {
+    void setBrightness(uint8_t) override {}
+};
+
+// One loop() iteration as on the device: the frame arena is reset at the frame boundary
+void drawFrame(IState& state) {
+    frameArena().reset();
+    state.onDraw();
+}
+
+// onEnter + warm-up, then the steady-state frames must not allocate
+uint32_t steadyStateAllocations(IState& state) {
+    state.onEnter();
+    for (int i = 0; i < kWarmupFrames; ++i) drawFrame(state);
+    FrameAllocationMonitor monitor;
+    for (int i = 0; i < kMeasuredFrames; ++i) {
+        monitor.beginFrame();
+        drawFrame(state);
+        monitor.endFrame();
+    }
+    return monitor.worstFrame().count;
+}
+
+// MainDisplayState reads the wall clock, so alarms are placed relative to it
+void resetAlarms(time_t base, int count) {
+    alarm_times.clear();
+    for (int i = 0; i < count; ++i) alarm_times.insert(base + 600 * (i + 1));
+}
+} // namespace
+
+void setUp(void) {}
+void tearDown(void) { alarm_times.clear(); }
+
+void test_hook_counts_new_and_monitor_tracks_frames() {
+    FrameAllocationMonitor monitor;
+    monitor.beginFrame();
+    std::unique_ptr<int[]> p(new int[16]);
+    const AllocationStats::Snapshot frame = monitor.endFrame();
+    TEST_ASSERT_EQUAL_UINT32(1, frame.count);
+    TEST_ASSERT_EQUAL_UINT32(16 * sizeof(int), frame.bytes);
+    monitor.beginFrame();
+    monitor.endFrame();
+    TEST_ASSERT_EQUAL_UINT32(2, monitor.frames());
+    TEST_ASSERT_EQUAL_UINT32(1, monitor.allocatingFrames());
+    TEST_ASSERT_EQUAL_UINT32(1, monitor.worstFrame().count);
+}
+
+void test_context_filter_excludes_other_contexts() {
+    AllocationStats::setContextFilter([]() { return false; });
+    const AllocationStats::Snapshot before = AllocationStats::snapshot();
+    std::unique_ptr<int> p(new int(1));
+    const AllocationStats::Snapshot after = AllocationStats::snapshot();
+    AllocationStats::setContextFilter(nullptr);
+    TEST_ASSERT_EQUAL_UINT32(before.count, after.count);
+}
+
+void test_main_display_steady_state_does_not_allocate() {
+    resetAlarms(time(nullptr), 3);
+    NullMainView view;
+    TimeLogic timeLogic;
+    AlarmLogic alarmLogic;
+    MainDisplayState state(nullptr, nullptr, &view, &timeLogic, &alarmLogic);
+    // the measured frames must draw a non-empty list (alarms seeded in the past are consumed)
+    state.onEnter();
+    drawFrame(state);
+    TEST_ASSERT_EQUAL_UINT32(3, alarm_times.size());
+    TEST_ASSERT_EQUAL_UINT32(0, steadyStateAllocations(state));
+    TEST_ASSERT_EQUAL_UINT32(3, alarm_times.size());
+    TEST_ASSERT_EQUAL_UINT32(0, frameArena().overflows());
+}
+
+void test_input_display_steady_state_does_not_allocate() {
+    FixedClock clock;
+    InputLogic logic(std::shared_ptr<ITimeService>(&clock, [](ITimeService*) {}));
+    NullInputView view;
+    InputDisplayState state(&logic, &view, &clock);
+    TEST_ASSERT_EQUAL_UINT32(0, steadyStateAllocations(state));
+}
+
+void test_input_display_relative_steady_state_does_not_allocate() {
+    FixedClock clock;
+    InputLogic logic(std::shared_ptr<ITimeService>(&clock, [](ITimeService*) {}));
+    NullInputView view;
+    InputDisplayState state(&logic, &view, &clock);
+    state.setRelativeMode(true);
+    state.onEnter();
+    logic.incrementInput(5);
+    TEST_ASSERT_EQUAL_UINT32(0, steadyStateAllocations(state));
+}
+
+void test_alarm_display_steady_state_does_not_allocate() {
+    resetAlarms(kNow, 4);
+    FixedClock clock;
+    NullAlarmView view;
+    AlarmDisplayState state(nullptr, &view, std::shared_ptr<ITimeService>(&clock, [](ITimeService*) {}));
+    clock.ms = 100000; // リアルタイム更新側（操作後の一時停止は経過済み）
+    TEST_ASSERT_EQUAL_UINT32(0, steadyStateAllocations(state));
+}
+
+void test_settings_display_steady_state_does_not_allocate() {
+    SettingsLogic logic;
+    NullSettingsView view;
+    SettingsDisplayState state(&logic, &view);
+    TEST_ASSERT_EQUAL_UINT32(0, steadyStateAllocations(state));
+}
+
+void test_datetime_input_steady_state_does_not_allocate() {
+    FixedClock clock;
+    NullDateTimeView view;
+    DateTimeInputState state(&clock, &view);
+    TEST_ASSERT_EQUAL_UINT32(0, steadyStateAllocations(state));
+}
+
+void test_alarm_active_steady_state_does_not_allocate() {
+    NullBacklight out;
+    MockBacklightAnimator anim(&out);
+    AlarmActiveState state(nullptr, nullptr, &anim, &out);
+    TEST_ASSERT_EQUAL_UINT32(0, steadyStateAllocations(state));
+}
+
+void test_time_sync_steady_state_does_not_allocate() {
+    MockTimeSyncController controller;
+    controller.setInitialCredentials("AIMATIX-1234", "abcdefgh");
+    controller.status = ITimeSyncController::Status::Step1;
+    NullTimeSyncView view;
+    TimeSyncDisplayState state(&view, &controller);
+    TEST_ASSERT_EQUAL_UINT32(0, steadyStateAllocations(state));
+    controller.status = ITimeSyncController::Status::Step2;
+    controller.urlPayload = "http://192.168.4.1/sync?t=0123456789abcdef";
+    drawFrame(state); // URL QR is drawn once on the transition
+    FrameAllocationMonitor monitor;
+    for (int i = 0; i < kMeasuredFrames; ++i) {
+        monitor.beginFrame();
+        drawFrame(state);
+        monitor.endFrame();
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, monitor.allocatingFrames());
+}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_hook_counts_new_and_monitor_tracks_frames);
+    RUN_TEST(test_context_filter_excludes_other_contexts);
+    RUN_TEST(test_main_display_steady_state_does_not_allocate);
+    RUN_TEST(test_input_display_steady_state_does_not_allocate);
+    RUN_TEST(test_input_display_relative_steady_state_does_not_allocate);
+    RUN_TEST(test_alarm_display_steady_state_does_not_allocate);
+    RUN_TEST(test_settings_display_steady_state_does_not_allocate);
+    RUN_TEST(test_datetime_input_steady_state_does_not_allocate);
+    RUN_TEST(test_alarm_active_steady_state_does_not_allocate);
+    RUN_TEST(test_time_sync_steady_state_does_not_allocate);
+    return UNITY_END();
+}
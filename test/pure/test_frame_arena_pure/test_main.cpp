@@ -0,0 +1,59 @@
+#include <unity.h>
+#include <cstdint>
+#include "FrameArena.h"
+#include "AllocationStats.h"
+
+void setUp(void) { frameArena().reset(); frameArena().resetStats(); }
+void tearDown(void) {}
+
+void test_bump_allocation_is_aligned_and_tracks_high_water() {
+    alignas(8) unsigned char block[64];
+    FrameArena arena(block, sizeof(block));
+    void* p1 = arena.allocate(3, 1);
+    void* p2 = arena.allocate(8, 8);
+    TEST_ASSERT_TRUE(arena.owns(p1));
+    TEST_ASSERT_EQUAL_UINT32(0, reinterpret_cast<uintptr_t>(p2) % 8);
+    TEST_ASSERT_EQUAL_UINT32(16, arena.used());
+    arena.reset();
+    TEST_ASSERT_EQUAL_UINT32(0, arena.used());
+    TEST_ASSERT_EQUAL_UINT32(16, arena.highWater());
+    TEST_ASSERT_TRUE(arena.allocate(4, 4) == p1); // the block is reused from the start
+}
+
+void test_exhausted_arena_falls_back_to_heap() {
+    alignas(8) unsigned char block[16];
+    FrameArena arena(block, sizeof(block));
+    arena.allocate(12, 4);
+    FrameAllocationMonitor monitor;
+    monitor.beginFrame();
+    void* p = arena.allocate(8, 4);
+    const AllocationStats::Snapshot frame = monitor.endFrame();
+    TEST_ASSERT_NOT_NULL(p);
+    TEST_ASSERT_FALSE(arena.owns(p));
+    TEST_ASSERT_EQUAL_UINT32(1, arena.overflows());
+    TEST_ASSERT_EQUAL_UINT32(1, frame.count); // visible to the allocation counters
+    arena.deallocate(p);
+    TEST_ASSERT_EQUAL_UINT32(12, arena.highWater());
+}
+
+void test_frame_containers_do_not_touch_the_heap() {
+    FrameAllocationMonitor monitor;
+    monitor.beginFrame();
+    {
+        FrameStringList list;
+        for (int i = 0; i < 5; ++i) list.emplace_back("a string longer than sso");
+        list.back() += "!";
+        TEST_ASSERT_EQUAL_STRING("a string longer than sso!", list.back().c_str());
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, monitor.endFrame().count);
+    TEST_ASSERT_TRUE(frameArena().highWater() > 0);
+    TEST_ASSERT_EQUAL_UINT32(0, frameArena().overflows());
+}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_bump_allocation_is_aligned_and_tracks_high_water);
+    RUN_TEST(test_exhausted_arena_falls_back_to_heap);
+    RUN_TEST(test_frame_containers_do_not_touch_the_heap);
+    return UNITY_END();
+}
@@ -27,11 +27,36 @@ static void test_fcp_reset_restores_first_step_to_62_ms(void) {
 	TEST_ASSERT_EQUAL_UINT32(62, fcp.nextDelayMs());
 }
 
+static void test_fcp_skipping_frames_keeps_the_grid(void) {
+	FrameClockPlanner paced(62500, 1000);
+	FrameClockPlanner steady(62500, 1000);
+	uint32_t sumPaced = paced.nextDelayMs();
+	uint32_t sumSteady = steady.nextDelayMs();
+	sumPaced += paced.nextDelayMs(16); // idle: one 1s step
+	for (int i = 0; i < 16; ++i) sumSteady += steady.nextDelayMs();
+	TEST_ASSERT_EQUAL_UINT32(sumSteady, sumPaced);
+	// back to full rate: same next step as a planner that never slowed down
+	TEST_ASSERT_EQUAL_UINT32(steady.nextDelayMs(), paced.nextDelayMs());
+}
+
+static void test_fcp_frames_to_cover_lands_on_first_frame_at_or_after(void) {
+	FrameClockPlanner fcp(62500, 1000);
+	(void)fcp.nextDelayMs(); // grid at 62ms (62.5us accumulated)
+	TEST_ASSERT_EQUAL_UINT32(1, fcp.framesToCover(0));
+	TEST_ASSERT_EQUAL_UINT32(1, fcp.framesToCover(63));  // 125ms - 62ms
+	TEST_ASSERT_EQUAL_UINT32(2, fcp.framesToCover(64));
+	const uint32_t frames = fcp.framesToCover(1000);
+	TEST_ASSERT_TRUE(fcp.nextDelayMs(frames) >= 1000);
+	TEST_ASSERT_EQUAL_UINT32(16, frames);
+}
+
 int main(int, char**) {
 	UNITY_BEGIN();
 	RUN_TEST(test_fcp_emits_approximate_intervals_62_63_ms);
 	RUN_TEST(test_fcp_cumulative_ms_matches_expected_over_10_frames);
 	RUN_TEST(test_fcp_reset_restores_first_step_to_62_ms);
+	RUN_TEST(test_fcp_skipping_frames_keeps_the_grid);
+	RUN_TEST(test_fcp_frames_to_cover_lands_on_first_frame_at_or_after);
 	return UNITY_END();
 }
 
@@ -0,0 +1,187 @@
+#include <unity.h>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <ctime>
+#include "FrameContext.h"
+#include "StateManager.h"
+#include "MainDisplayState.h"
+#include "InputDisplayState.h"
+#include "InputLogic.h"
+#include "TimeLogic.h"
+#include "AlarmLogic.h"
+
+extern AlarmStore alarm_times;
+
+namespace {
+const time_t kFrameNow = 1700000000; // 2023-11-14 22:13:20 UTC
+
+// 呼び出し回数を数える時計（フレームとは別の時刻を返す）
+struct CountingClock : public ITimeService {
+    int64_t wallUs{kFrameNow * 1000000LL + 250000};
+    int64_t monoUs{42000000};
+    mutable int nowCalls{0};
+    mutable int localtimeCalls{0};
+    time_t now() const override { ++nowCalls; return static_cast<time_t>(wallUs / 1000000); }
+    int64_t nowMicros() const override { ++nowCalls; return wallUs; }
+    struct tm* localtime(time_t* t) const override { ++localtimeCalls; return ::gmtime(t); }
+    bool setSystemTime(time_t v) override { wallUs = static_cast<int64_t>(v) * 1000000; return true; }
+    uint32_t monotonicMillis() const override { return static_cast<uint32_t>(monoUs / 1000); }
+    int64_t monotonicMicros() const override { return monoUs; }
+};
+
+struct TimeView : public IMainDisplayView {
+    std::string time;
+    std::string remain;
+    void showTitle(const char*, int, bool) override {}
+    void showTime(const char* t) override { time = t; }
+    void showRemain(const char* r) override { remain = r; }
+    void showProgress(int) override {}
+    void showAlarmList(const FrameStringList&) override {}
+    void showHints(const char*, const char*, const char*) override {}
+    void clear() override {}
+};
+struct NullInputView : public IInputDisplayView {
+    void showTitle(const char*, int, bool) override {}
+    void showHints(const char*, const char*, const char*) override {}
+    void showPreview(const char*) override {}
+    void clear() override {}
+    void showDigit(int, int, bool) override {}
+    void showColon() override {}
+};
+
+// 従来の入口だけを実装した状態（既定の転送を確認）
+struct LegacyState : public IState {
+    int draws{0};
+    int buttons{0};
+    void onEnter() override {}
+    void onExit() override {}
+    void onDraw() override { ++draws; }
+    void onButtonA() override { ++buttons; }
+    void onButtonB() override { ++buttons; }
+    void onButtonC() override { ++buttons; }
+    void onButtonALongPress() override { ++buttons; }
+    void onButtonBLongPress() override { ++buttons; }
+    void onButtonCLongPress() override { ++buttons; }
+};
+
+std::shared_ptr<ITimeService> borrow(ITimeService* clock) {
+    return std::shared_ptr<ITimeService>(clock, [](ITimeService*) {});
+}
+
+// 時:分 を入力（絶対モードは onEnter 済みの __:_0 から）
+void enterDigits(InputLogic& logic, int h1, int h2, int m1, int m2) {
+    logic.reset();
+    const int digits[4] = { h1, h2, m1, m2 };
+    for (int i = 0; i < 4; ++i) {
+        if (i > 0) logic.shiftDigits();
+        logic.incrementInput(digits[i]);
+    }
+}
+}
+
+void setUp(void) { alarm_times.clear(); }
+void tearDown(void) { alarm_times.clear(); }
+
+void test_capture_reads_the_clock_once() {
+    CountingClock clock;
+    const FrameContext frame = FrameContext::capture(&clock);
+    TEST_ASSERT_EQUAL_INT(1, clock.nowCalls);
+    TEST_ASSERT_EQUAL_INT(1, clock.localtimeCalls);
+    TEST_ASSERT_EQUAL_INT((int)kFrameNow, (int)frame.now);
+    TEST_ASSERT_TRUE(frame.nowUs == kFrameNow * 1000000LL + 250000);
+    TEST_ASSERT_TRUE(frame.monoUs == 42000000);
+    TEST_ASSERT_TRUE(frame.localValid);
+    TEST_ASSERT_EQUAL_INT(22, frame.local.tm_hour);
+    TEST_ASSERT_EQUAL_INT(13, frame.local.tm_min);
+    TEST_ASSERT_EQUAL_INT(20, frame.local.tm_sec);
+}
+
+void test_frame_time_service_is_pinned_to_the_frame() {
+    CountingClock clock;
+    const FrameContext frame = FrameContext::capture(&clock);
+    FrameTimeService pinned(frame, &clock);
+    clock.wallUs += 60LL * 1000000; // フレームの途中で分が変わっても
+    clock.monoUs += 60LL * 1000000;
+    time_t t = pinned.now();
+    TEST_ASSERT_EQUAL_INT((int)kFrameNow, (int)t);
+    TEST_ASSERT_TRUE(pinned.monotonicMicros() == 42000000);
+    const int before = clock.localtimeCalls;
+    TEST_ASSERT_EQUAL_INT(13, pinned.localtime(&t)->tm_min);
+    TEST_ASSERT_EQUAL_INT(before, clock.localtimeCalls); // キャッシュ済み
+    time_t other = kFrameNow + 3600;
+    TEST_ASSERT_EQUAL_INT(23, pinned.localtime(&other)->tm_hour); // 他の時刻は inner へ
+    TEST_ASSERT_EQUAL_INT(before + 1, clock.localtimeCalls);
+}
+
+void test_main_display_draws_the_injected_time() {
+    TimeView view;
+    TimeLogic timeLogic;
+    AlarmLogic alarmLogic;
+    MainDisplayState state(nullptr, nullptr, &view, &timeLogic, &alarmLogic);
+    alarm_times.insert(kFrameNow + 90);
+    state.onEnter();
+    state.onDraw(FrameContext::at(kFrameNow));
+    TEST_ASSERT_EQUAL_STRING("22:13", view.time.c_str());
+    TEST_ASSERT_EQUAL_STRING("00:01:30", view.remain.c_str());
+    state.onDraw(FrameContext::at(kFrameNow + 47));
+    TEST_ASSERT_EQUAL_STRING("22:14", view.time.c_str());
+    TEST_ASSERT_EQUAL_STRING("00:00:43", view.remain.c_str());
+}
+
+void test_input_submit_uses_the_frame_time() {
+    CountingClock clock;
+    clock.wallUs += 5LL * 3600 * 1000000; // 時計はフレームより 5 時間先
+    InputLogic logic(borrow(&clock));
+    NullInputView view;
+    InputDisplayState state(&logic, &view, &clock);
+    state.onEnter();
+    enterDigits(logic, 2, 3, 0, 0);
+    state.onButtonC(FrameContext::at(kFrameNow));
+    TEST_ASSERT_EQUAL_INT(1, (int)alarm_times.size());
+    TEST_ASSERT_EQUAL_INT((int)(kFrameNow + 46 * 60 + 40), (int)alarm_times.front()); // 同日 23:00:00
+}
+
+void test_relative_submit_uses_the_frame_time() {
+    CountingClock clock;
+    clock.wallUs += 5LL * 3600 * 1000000;
+    InputLogic logic(borrow(&clock));
+    NullInputView view;
+    InputDisplayState state(&logic, &view, &clock);
+    state.setRelativeMode(true);
+    state.onEnter();
+    enterDigits(logic, 0, 1, 3, 0);
+    state.onButtonC(FrameContext::at(kFrameNow));
+    TEST_ASSERT_EQUAL_INT(1, (int)alarm_times.size());
+    TEST_ASSERT_EQUAL_INT((int)(kFrameNow + 5400), (int)alarm_times.front());
+    TEST_ASSERT_TRUE(alarm_times.kind(0) == AlarmKind::Relative);
+}
+
+void test_state_manager_forwards_the_frame_to_legacy_states() {
+    StateManager manager;
+    LegacyState state;
+    manager.setState(&state);
+    const FrameContext frame = FrameContext::at(kFrameNow);
+    manager.draw(frame);
+    manager.handleButtonA(frame);
+    manager.handleButtonB(frame);
+    manager.handleButtonC(frame);
+    manager.handleButtonALongPress(frame);
+    manager.handleButtonBLongPress(frame);
+    manager.handleButtonCLongPress(frame);
+    TEST_ASSERT_EQUAL_INT(1, state.draws);
+    TEST_ASSERT_EQUAL_INT(6, state.buttons);
+}
+
+int main(int, char**) {
+    setenv("TZ", "UTC0", 1);
+    tzset();
+    UNITY_BEGIN();
+    RUN_TEST(test_capture_reads_the_clock_once);
+    RUN_TEST(test_frame_time_service_is_pinned_to_the_frame);
+    RUN_TEST(test_main_display_draws_the_injected_time);
+    RUN_TEST(test_input_submit_uses_the_frame_time);
+    RUN_TEST(test_relative_submit_uses_the_frame_time);
+    RUN_TEST(test_state_manager_forwards_the_frame_to_legacy_states);
+    return UNITY_END();
+}
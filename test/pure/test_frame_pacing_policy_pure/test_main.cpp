@@ -0,0 +1,60 @@
+#include <unity.h>
+#include "FramePacingPolicy.h"
+
+void setUp(void) {}
+void tearDown(void) {}
+
+namespace {
+const FramePacingPolicy::Activity kIdle = { false, false, false };
+const FramePacingPolicy::Activity kIdleCountdown = { false, false, true };
+const FramePacingPolicy::Activity kInput = { true, false, false };
+const FramePacingPolicy::Activity kBusy = { false, true, false };
+}
+
+static void test_first_frame_is_full_rate(void) {
+	FramePacingPolicy p;
+	TEST_ASSERT_TRUE(p.select(123456, kIdle) == FramePacingPolicy::Rate::Full);
+}
+
+static void test_idle_after_hold_off(void) {
+	FramePacingPolicy p;
+	p.select(0, kInput);
+	TEST_ASSERT_TRUE(p.select(FramePacingPolicy::kActiveHoldMs - 1, kIdle) == FramePacingPolicy::Rate::Full);
+	TEST_ASSERT_TRUE(p.select(FramePacingPolicy::kActiveHoldMs, kIdle) == FramePacingPolicy::Rate::Minutes);
+	TEST_ASSERT_TRUE(p.select(FramePacingPolicy::kActiveHoldMs, kIdleCountdown) == FramePacingPolicy::Rate::Seconds);
+}
+
+static void test_input_or_busy_restores_full_rate_immediately(void) {
+	FramePacingPolicy p;
+	p.select(0, kIdle);
+	TEST_ASSERT_TRUE(p.select(60000, kIdle) == FramePacingPolicy::Rate::Minutes);
+	TEST_ASSERT_TRUE(p.select(60001, kInput) == FramePacingPolicy::Rate::Full);
+	TEST_ASSERT_TRUE(p.select(60002, kIdle) == FramePacingPolicy::Rate::Full); // hold-off restarts
+	TEST_ASSERT_TRUE(p.select(120000, kBusy) == FramePacingPolicy::Rate::Full);
+}
+
+static void test_hold_off_is_wrap_safe(void) {
+	FramePacingPolicy p;
+	p.select(0xFFFFFF00u, kInput);
+	TEST_ASSERT_TRUE(p.select(0x00000100u, kIdle) == FramePacingPolicy::Rate::Full);
+	TEST_ASSERT_TRUE(p.select(0x00002000u, kIdle) == FramePacingPolicy::Rate::Minutes);
+}
+
+static void test_boundaries(void) {
+	typedef FramePacingPolicy P;
+	TEST_ASSERT_EQUAL_UINT32(0, P::msUntilBoundary(P::Rate::Full, 12345));
+	TEST_ASSERT_EQUAL_UINT32(655, P::msUntilBoundary(P::Rate::Seconds, 12345));
+	TEST_ASSERT_EQUAL_UINT32(1000, P::msUntilBoundary(P::Rate::Seconds, 13000));
+	TEST_ASSERT_EQUAL_UINT32(47655, P::msUntilBoundary(P::Rate::Minutes, 12345));
+	TEST_ASSERT_EQUAL_UINT32(60000, P::msUntilBoundary(P::Rate::Minutes, 0));
+}
+
+int main(int, char**) {
+	UNITY_BEGIN();
+	RUN_TEST(test_first_frame_is_full_rate);
+	RUN_TEST(test_idle_after_hold_off);
+	RUN_TEST(test_input_or_busy_restores_full_rate_immediately);
+	RUN_TEST(test_hold_off_is_wrap_safe);
+	RUN_TEST(test_boundaries);
+	return UNITY_END();
+}
@@ -1,5 +1,6 @@
 #include <vector>
 #include <ctime>
+#include "AlarmStore.h"
 
 // テスト用のグローバル変数定義
-std::vector<time_t> alarm_times; 
\ No newline at end of file
+AlarmStore alarm_times;
@@ -0,0 +1,89 @@
+#include <unity.h>
+#include "GzipSplice.h"
+#include <cstring>
+
+void setUp() {}
+void tearDown() {}
+
+static uint32_t crcOf(const char* s) {
+    return GzipSplice::crc32Update(0, reinterpret_cast<const uint8_t*>(s), strlen(s));
+}
+
+void test_crc32_check_value() {
+    TEST_ASSERT_EQUAL_HEX32(0xCBF43926u, crcOf("123456789"));
+}
+
+void test_crc32_update_is_chainable() {
+    const uint8_t* p = reinterpret_cast<const uint8_t*>("123456789");
+    const uint32_t c = GzipSplice::crc32Update(GzipSplice::crc32Update(0, p, 4), p + 4, 5);
+    TEST_ASSERT_EQUAL_HEX32(0xCBF43926u, c);
+}
+
+void test_crc32_combine_matches_direct() {
+    const uint32_t combined = GzipSplice::crc32Combine(crcOf("const TOKEN='"), crcOf("abc123';"), 8);
+    TEST_ASSERT_EQUAL_HEX32(crcOf("const TOKEN='abc123';"), combined);
+}
+
+void test_crc32_combine_empty_tail() {
+    TEST_ASSERT_EQUAL_HEX32(crcOf("abc"), GzipSplice::crc32Combine(crcOf("abc"), 0, 0));
+}
+
+void test_stored_block_header_bytes() {
+    uint8_t h[GzipSplice::kStoredBlockHeaderLen];
+    GzipSplice::writeStoredBlockHeader(0x0010, h);
+    const uint8_t expected[] = { 0x00, 0x10, 0x00, 0xEF, 0xFF };
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, h, sizeof(expected));
+}
+
+void test_trailer_little_endian() {
+    uint8_t t[GzipSplice::kTrailerLen];
+    GzipSplice::writeTrailer(0x11223344u, 0x00000258u, t);
+    const uint8_t expected[] = { 0x44, 0x33, 0x22, 0x11, 0x58, 0x02, 0x00, 0x00 };
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, t, sizeof(expected));
+}
+
+static const uint8_t kHead[] = { 1, 2, 3 };
+static const uint8_t kTail[] = { 4, 5 };
+
+static GzipSplice::SplicedAsset makeAsset() {
+    GzipSplice::SplicedAsset a{};
+    a.head = kHead; a.headLen = sizeof(kHead);
+    a.tail = kTail; a.tailLen = sizeof(kTail);
+    a.prefixCrc = crcOf("<p>"); a.prefixLen = 3;
+    a.suffixCrc = crcOf("</p>"); a.suffixLen = 4;
+    a.etag = "x";
+    return a;
+}
+
+void test_build_frame_content_length() {
+    GzipSplice::SpliceFrame f{};
+    TEST_ASSERT_TRUE(GzipSplice::buildFrame(makeAsset(), "tok", 3, f));
+    TEST_ASSERT_EQUAL_UINT32(3 + GzipSplice::kStoredBlockHeaderLen + 3 + 2 + GzipSplice::kTrailerLen, f.contentLength);
+}
+
+void test_build_frame_trailer_covers_whole_page() {
+    GzipSplice::SpliceFrame f{};
+    GzipSplice::buildFrame(makeAsset(), "tok", 3, f);
+    uint8_t expected[GzipSplice::kTrailerLen];
+    GzipSplice::writeTrailer(crcOf("<p>tok</p>"), 10, expected);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, f.trailer, sizeof(expected));
+}
+
+void test_build_frame_rejects_oversized_insert() {
+    GzipSplice::SpliceFrame f{};
+    TEST_ASSERT_FALSE(GzipSplice::buildFrame(makeAsset(), "x", 0x10000, f));
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_crc32_check_value);
+    RUN_TEST(test_crc32_update_is_chainable);
+    RUN_TEST(test_crc32_combine_matches_direct);
+    RUN_TEST(test_crc32_combine_empty_tail);
+    RUN_TEST(test_stored_block_header_bytes);
+    RUN_TEST(test_trailer_little_endian);
+    RUN_TEST(test_build_frame_content_length);
+    RUN_TEST(test_build_frame_trailer_covers_whole_page);
+    RUN_TEST(test_build_frame_rejects_oversized_insert);
+    return UNITY_END();
+}
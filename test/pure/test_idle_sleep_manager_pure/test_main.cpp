@@ -0,0 +1,140 @@
+#include <unity.h>
+#include "IdleSleepManager.h"
+
+void setUp() {}
+void tearDown() {}
+
+namespace {
+typedef IdleSleepManager::Action Action;
+typedef IdleSleepManager::Phase Phase;
+
+const uint8_t kA = ButtonEvents::bit(ButtonManager::BtnA);
+const uint8_t kB = ButtonEvents::bit(ButtonManager::BtnB);
+
+ButtonEvents down(uint8_t mask) { ButtonEvents e = { mask, 0, 0 }; return e; }
+ButtonEvents shortPress(uint8_t mask) { ButtonEvents e = { 0, mask, 0 }; return e; }
+ButtonEvents longPress(uint8_t mask) { ButtonEvents e = { 0, 0, mask }; return e; }
+
+// Drive the manager to sleep from t=0 without input
+uint32_t sleepFrom(IdleSleepManager& m, uint32_t startMs) {
+    const uint32_t dimAt = startMs + m.timeoutMs();
+    m.update(dimAt, false);
+    m.update(dimAt + IdleSleepManager::kDimMs, false);
+    return dimAt + IdleSleepManager::kDimMs;
+}
+} // namespace
+
+void test_dims_after_timeout_then_sleeps() {
+    IdleSleepManager m;
+    TEST_ASSERT_EQUAL_UINT32(IdleSleepManager::kDefaultTimeoutMs, m.timeoutMs());
+    TEST_ASSERT_TRUE(Action::None == m.update(IdleSleepManager::kDefaultTimeoutMs - 1, false));
+    TEST_ASSERT_TRUE(Action::Dim == m.update(IdleSleepManager::kDefaultTimeoutMs, false));
+    TEST_ASSERT_TRUE(m.isRendering());
+    TEST_ASSERT_TRUE(Action::None == m.update(IdleSleepManager::kDefaultTimeoutMs + IdleSleepManager::kDimMs - 1, false));
+    TEST_ASSERT_TRUE(Action::Sleep == m.update(IdleSleepManager::kDefaultTimeoutMs + IdleSleepManager::kDimMs, false));
+    TEST_ASSERT_FALSE(m.isRendering());
+    TEST_ASSERT_TRUE(Action::None == m.update(IdleSleepManager::kDefaultTimeoutMs * 10, false));
+}
+
+void test_input_restarts_timer() {
+    IdleSleepManager m;
+    ButtonEvents e = shortPress(kA);
+    m.onButtonEvents(200000, e);
+    TEST_ASSERT_TRUE(Action::None == m.update(200000 + IdleSleepManager::kDefaultTimeoutMs - 1, false));
+    TEST_ASSERT_TRUE(Action::Dim == m.update(200000 + IdleSleepManager::kDefaultTimeoutMs, false));
+}
+
+void test_hold_awake_blocks_and_wakes() {
+    IdleSleepManager m;
+    // countdown running: never sleeps
+    for (uint32_t t = 0; t < 3 * IdleSleepManager::kMaxTimeoutMs; t += 1000) {
+        TEST_ASSERT_TRUE(Action::None == m.update(t, true));
+    }
+    // asleep, then an alarm needs the screen
+    const uint32_t t = sleepFrom(m, 3 * IdleSleepManager::kMaxTimeoutMs);
+    TEST_ASSERT_TRUE(Phase::Asleep == m.phase());
+    TEST_ASSERT_TRUE(Action::Wake == m.update(t + 5, true));
+    TEST_ASSERT_TRUE(m.isRendering());
+}
+
+void test_press_while_dimmed_undims_and_passes_through() {
+    IdleSleepManager m;
+    m.update(IdleSleepManager::kDefaultTimeoutMs, false);
+    ButtonEvents e = down(kA);
+    TEST_ASSERT_TRUE(Action::Undim == m.onButtonEvents(IdleSleepManager::kDefaultTimeoutMs + 10, e));
+    TEST_ASSERT_EQUAL_UINT8(kA, e.pressDown);
+    TEST_ASSERT_TRUE(Phase::Awake == m.phase());
+}
+
+void test_waking_press_is_swallowed_until_released() {
+    IdleSleepManager m;
+    const uint32_t t = sleepFrom(m, 0);
+    ButtonEvents e = down(kA);
+    TEST_ASSERT_TRUE(Action::Wake == m.onButtonEvents(t + 100, e));
+    TEST_ASSERT_FALSE(e.any());
+    e = shortPress(kA);
+    TEST_ASSERT_TRUE(Action::None == m.onButtonEvents(t + 200, e));
+    TEST_ASSERT_FALSE(e.any());
+    // the next press acts normally
+    e = down(kA);
+    m.onButtonEvents(t + 400, e);
+    TEST_ASSERT_EQUAL_UINT8(kA, e.pressDown);
+    e = shortPress(kA);
+    m.onButtonEvents(t + 500, e);
+    TEST_ASSERT_EQUAL_UINT8(kA, e.shortPress);
+}
+
+void test_long_waking_press_and_other_buttons() {
+    IdleSleepManager m;
+    const uint32_t t = sleepFrom(m, 0);
+    ButtonEvents e = down(kA);
+    m.onButtonEvents(t, e);
+    e = longPress(kA);
+    m.onButtonEvents(t + 1000, e);
+    TEST_ASSERT_FALSE(e.any());
+    // B pressed after waking is not affected
+    e = down(kB);
+    m.onButtonEvents(t + 1100, e);
+    TEST_ASSERT_EQUAL_UINT8(kB, e.pressDown);
+}
+
+void test_timeout_is_clamped_to_spec_range() {
+    IdleSleepManager m;
+    m.setTimeoutMs(1000);
+    TEST_ASSERT_EQUAL_UINT32(IdleSleepManager::kMinTimeoutMs, m.timeoutMs());
+    m.setTimeoutMs(60u * 60u * 1000u);
+    TEST_ASSERT_EQUAL_UINT32(IdleSleepManager::kMaxTimeoutMs, m.timeoutMs());
+    m.setTimeoutMs(10u * 60u * 1000u);
+    TEST_ASSERT_EQUAL_UINT32(10u * 60u * 1000u, m.timeoutMs());
+}
+
+void test_millis_wrap() {
+    IdleSleepManager m;
+    ButtonEvents e = shortPress(kA);
+    m.onButtonEvents(0xFFFFFF00u, e);
+    TEST_ASSERT_TRUE(Action::None == m.update(0x00000100u, false));
+    TEST_ASSERT_TRUE(Action::Dim == m.update(0xFFFFFF00u + IdleSleepManager::kDefaultTimeoutMs, false));
+}
+
+void test_dim_pattern_starts_at_current_brightness() {
+    IdleSleepManager m;
+    const BacklightPattern& p = m.dimPattern(127);
+    TEST_ASSERT_EQUAL_UINT8(127, BacklightEngine::gammaToPwm(BacklightEngine::levelAt(p, 0)));
+    const uint8_t end = BacklightEngine::gammaToPwm(BacklightEngine::levelAt(p, IdleSleepManager::kDimFadeMs));
+    TEST_ASSERT_TRUE(end > 0 && end < 127);
+    TEST_ASSERT_EQUAL_UINT8(1, p.loops);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_dims_after_timeout_then_sleeps);
+    RUN_TEST(test_input_restarts_timer);
+    RUN_TEST(test_hold_awake_blocks_and_wakes);
+    RUN_TEST(test_press_while_dimmed_undims_and_passes_through);
+    RUN_TEST(test_waking_press_is_swallowed_until_released);
+    RUN_TEST(test_long_waking_press_and_other_buttons);
+    RUN_TEST(test_timeout_is_clamped_to_spec_range);
+    RUN_TEST(test_millis_wrap);
+    RUN_TEST(test_dim_pattern_starts_at_current_brightness);
+    return UNITY_END();
+}
@@ -14,7 +14,7 @@
 #include "IDisplay.h" // IDisplay.hのインクルードを追加
 
 // グローバル変数の宣言（定義はtest_globals.cppにある）
-extern std::vector<time_t> alarm_times;
+extern AlarmStore alarm_times;
 
 // テスト用の固定時刻
 const time_t kFixedTestTime = 1700000000; // 任意の固定値
@@ -0,0 +1,94 @@
+#include <unity.h>
+#include "LogicTick.h"
+#include "TickLatencyHistogram.h"
+
+void setUp(void) {}
+void tearDown(void) {}
+
+namespace {
+// Runs 10 ms ticks with button A at `levelA` until endMs; returns the merged events
+ButtonEvents runA(LogicTick& logic, ButtonEventQueue& queue, uint32_t& nowMs, uint32_t endMs, bool levelA) {
+    ButtonEvents merged = { 0, 0, 0 };
+    for (; nowMs < endMs; nowMs += LogicTick::kPeriodMs) {
+        logic.tick(static_cast<int64_t>(nowMs) * 1000, levelA, false, false);
+        ButtonEvents e;
+        while (queue.pop(e)) {
+            merged.pressDown |= e.pressDown;
+            merged.shortPress |= e.shortPress;
+            merged.longPress |= e.longPress;
+        }
+    }
+    return merged;
+}
+} // namespace
+
+void test_queue_is_fifo_and_drops_when_full() {
+    ButtonEventQueue queue;
+    for (size_t i = 0; i < ButtonEventQueue::kCapacity - 1; ++i) {
+        const ButtonEvents e = { static_cast<uint8_t>(i), 0, 0 };
+        TEST_ASSERT_TRUE(queue.push(e));
+    }
+    const ButtonEvents extra = { 1, 1, 1 };
+    TEST_ASSERT_FALSE(queue.push(extra));
+    TEST_ASSERT_EQUAL_UINT32(1, queue.dropped());
+    ButtonEvents out;
+    TEST_ASSERT_TRUE(queue.pop(out));
+    TEST_ASSERT_EQUAL_UINT8(0, out.pressDown);
+    TEST_ASSERT_TRUE(queue.pop(out));
+    TEST_ASSERT_EQUAL_UINT8(1, out.pressDown);
+}
+
+void test_short_press_is_queued_on_release() {
+    ButtonEventQueue queue;
+    LogicTick logic(&queue);
+    uint32_t now = 1000;
+    const ButtonEvents down = runA(logic, queue, now, 1200, true);
+    TEST_ASSERT_EQUAL_UINT8(ButtonEvents::bit(ButtonManager::BtnA), down.pressDown);
+    TEST_ASSERT_EQUAL_UINT8(0, down.shortPress);
+    TEST_ASSERT_TRUE(logic.anyHeld());
+    const ButtonEvents up = runA(logic, queue, now, 1400, false);
+    TEST_ASSERT_EQUAL_UINT8(ButtonEvents::bit(ButtonManager::BtnA), up.shortPress);
+    TEST_ASSERT_FALSE(logic.anyHeld());
+}
+
+void test_long_press_fires_once_while_held() {
+    ButtonEventQueue queue;
+    LogicTick logic(&queue);
+    uint32_t now = 1000;
+    const ButtonEvents held = runA(logic, queue, now, 2500, true);
+    TEST_ASSERT_EQUAL_UINT8(ButtonEvents::bit(ButtonManager::BtnA), held.longPress);
+    const ButtonEvents up = runA(logic, queue, now, 2700, false);
+    TEST_ASSERT_EQUAL_UINT8(0, up.shortPress);
+    TEST_ASSERT_EQUAL_UINT8(0, up.longPress);
+}
+
+void test_idle_ticks_queue_nothing() {
+    ButtonEventQueue queue;
+    LogicTick logic(&queue);
+    for (uint32_t t = 0; t < 1000; t += LogicTick::kPeriodMs) {
+        TEST_ASSERT_FALSE(logic.tick(static_cast<int64_t>(t) * 1000, false, false, false));
+    }
+}
+
+void test_histogram_percentiles_and_misses() {
+    TickLatencyHistogram h(10000);
+    TEST_ASSERT_EQUAL_UINT32(0, h.percentileUs(999));
+    for (int i = 0; i < 998; ++i) h.record(250);
+    h.record(9000);
+    h.record(15000);
+    TEST_ASSERT_EQUAL_UINT32(300, h.percentileUs(500));   // bin upper edge
+    TEST_ASSERT_EQUAL_UINT32(9100, h.percentileUs(999));
+    TEST_ASSERT_EQUAL_UINT32(15000, h.percentileUs(1000)); // overflow bin: observed max
+    TEST_ASSERT_EQUAL_UINT32(1, h.misses());
+    TEST_ASSERT_EQUAL_UINT32(1000, h.count());
+}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_queue_is_fifo_and_drops_when_full);
+    RUN_TEST(test_short_press_is_queued_on_release);
+    RUN_TEST(test_long_press_fires_once_while_held);
+    RUN_TEST(test_idle_ticks_queue_nothing);
+    RUN_TEST(test_histogram_percentiles_and_misses);
+    return UNITY_END();
+}
@@ -10,7 +10,7 @@
 #include "ITimeService.h"
 #include <memory>
 
-extern std::vector<time_t> alarm_times;
+extern AlarmStore alarm_times;
 
 const time_t kFixedTestTime = 1700000000;
 struct MockTimeService : public ITimeService {
@@ -60,9 +60,10 @@ public:
         lastProgress = percent;
     }
     
-    void showAlarmList(const std::vector<std::string>& alarmStrs) override {
+    void showAlarmList(const FrameStringList& alarmStrs) override {
         showAlarmListCallCount++;
-        lastAlarmList = alarmStrs;
+        lastAlarmList.clear();
+        for (const FrameString& s : alarmStrs) lastAlarmList.push_back(s.c_str());
     }
     
     void clear() override {
@@ -92,8 +93,11 @@ public:
 
 // 旧モックは未使用のため削除
 
+extern AlarmStore alarm_times;
+
 void setUp(void) {}
-void tearDown(void) {}
+// 時計を差したテストが途中で失敗しても後続へ残さない
+void tearDown(void) { alarm_times.setTimeSource(nullptr); }
 
 // MainDisplayStateテストケース（1テスト1観点）
 
@@ -257,16 +261,49 @@ void test_main_display_state_time_display_logic() {
     TEST_ASSERT_TRUE(true); // エラーが発生しなければ成功
 }
 
+namespace {
+// キャッシュ済み電池状態（generation は表示値が変わったときだけ進む）
+struct FakePowerTelemetry : public IPowerTelemetry {
+    BatteryStatus status{ 80, false, 3900 };
+    uint32_t gen = 1;
+    BatteryStatus batteryStatus() const override { return status; }
+    uint32_t generation() const override { return gen; }
+};
+}
+
 void test_main_display_state_battery_display_logic() {
-    // バッテリー表示ロジックのテスト（1観点）
+    // 電池表示: 入場時に表示し、表示値が変わったときだけタイトルを再描画
     auto mockView = std::unique_ptr<MockMainDisplayView>(new MockMainDisplayView());
-    // time provider not needed
-    MainDisplayState state(nullptr, nullptr, mockView.get(), nullptr, nullptr);
-    
-    // バッテリー表示処理をテスト
+    TimeLogic timeLogic;
+    AlarmLogic alarmLogic;
+    FakePowerTelemetry power;
+    MainDisplayState state(nullptr, nullptr, mockView.get(), &timeLogic, &alarmLogic);
+    state.setPowerTelemetry(&power);
+    extern AlarmStore alarm_times;
+    alarm_times.clear();
+
+    state.onEnter();
+    TEST_ASSERT_EQUAL_INT(1, mockView->showTitleCallCount);
+    TEST_ASSERT_EQUAL_INT(80, mockView->lastBatteryLevel);
+
     state.onDraw();
-    
-    TEST_ASSERT_TRUE(true); // エラーが発生しなければ成功
+    state.onDraw();
+    TEST_ASSERT_EQUAL_INT(1, mockView->showTitleCallCount);
+
+    power.status.percent = 79;
+    power.status.charging = true;
+    ++power.gen;
+    state.onDraw();
+    TEST_ASSERT_EQUAL_INT(2, mockView->showTitleCallCount);
+    TEST_ASSERT_EQUAL_INT(79, mockView->lastBatteryLevel);
+    TEST_ASSERT_TRUE(mockView->lastIsCharging);
+}
+
+void test_main_display_state_battery_unknown_without_telemetry() {
+    auto mockView = std::unique_ptr<MockMainDisplayView>(new MockMainDisplayView());
+    MainDisplayState state(nullptr, nullptr, mockView.get(), nullptr, nullptr);
+    state.onEnter();
+    TEST_ASSERT_EQUAL_INT(-1, mockView->lastBatteryLevel);
 }
 
 void test_main_display_state_alarm_list_display() {
@@ -389,7 +426,7 @@ void test_main_display_state_empty_alarm_list_branches() {
     MainDisplayState state(nullptr, nullptr, mockView.get(), nullptr, nullptr);
     
     // 空のアラームリストでのテスト
-    extern std::vector<time_t> alarm_times;
+    extern AlarmStore alarm_times;
     alarm_times.clear();
     
     state.onDraw();
@@ -403,16 +440,100 @@ void test_main_display_state_alarm_list_with_items_branches() {
     MainDisplayState state(nullptr, nullptr, mockView.get(), nullptr, nullptr);
     
     // アラームリストにアイテムがある場合のテスト
-    extern std::vector<time_t> alarm_times;
+    extern AlarmStore alarm_times;
     alarm_times.clear();
-    alarm_times.push_back(kFixedTestTime + 3600); // 1時間後
-    alarm_times.push_back(kFixedTestTime + 7200); // 2時間後
+    alarm_times.insert(kFixedTestTime + 3600); // 1時間後
+    alarm_times.insert(kFixedTestTime + 7200); // 2時間後
     
     state.onDraw();
     
     TEST_ASSERT_TRUE(true); // エラーが発生しなければ成功
 }
 
+// 壁時計と単調時計を別々に動かせる時計（時刻同期の段差の再現）
+class SteppableClock : public ITimeService {
+public:
+    SteppableClock() : wallUs(kFixedTestTime * 1000000LL), monoUs(5LL * 1000000) {}
+    time_t now() const override { return static_cast<time_t>(wallUs / 1000000); }
+    struct tm* localtime(time_t* t) const override { return ::localtime(t); }
+    int64_t nowMicros() const override { return wallUs; }
+    bool setSystemTime(time_t t) override { wallUs = static_cast<int64_t>(t) * 1000000; return true; }
+    uint32_t monotonicMillis() const override { return static_cast<uint32_t>(monoUs / 1000); }
+    int64_t monotonicMicros() const override { return monoUs; }
+    int64_t wallUs;
+    int64_t monoUs;
+};
+
+class RingingState : public IState {
+public:
+    int entered = 0;
+    void onEnter() override { ++entered; }
+    void onExit() override {}
+    void onDraw() override {}
+    void onButtonA() override {}
+    void onButtonB() override {}
+    void onButtonC() override {}
+    void onButtonALongPress() override {}
+    void onButtonBLongPress() override {}
+    void onButtonCLongPress() override {}
+};
+
+void test_main_display_state_wall_clock_step_does_not_ring_relative_alarm() {
+    // REL+ アラーム（10 分後）が残っている間に壁時計が 1 時間進んでも鳴らない
+    extern AlarmStore alarm_times;
+    SteppableClock clock;
+    alarm_times.clear();
+    alarm_times.setTimeSource(&clock);
+    alarm_times.insert(clock.now() + 600, AlarmKind::Relative);
+    MockMainDisplayView view;
+    TimeLogic timeLogic;
+    AlarmLogic alarmLogic;
+    StateManager manager;
+    RingingState ringing;
+    MainDisplayState state(&manager, nullptr, &view, &timeLogic, &alarmLogic);
+    state.setAlarmActiveState(&ringing);
+    manager.setState(&state);
+    manager.draw(FrameContext::capture(&clock));
+    clock.wallUs += 3600LL * 1000000;
+    alarm_times.rebase();
+    manager.draw(FrameContext::capture(&clock));
+    TEST_ASSERT_EQUAL_INT(0, ringing.entered);
+    TEST_ASSERT_EQUAL_INT(1, (int)alarm_times.size());
+    // 経過 10 分で鳴る
+    clock.wallUs += 600LL * 1000000;
+    clock.monoUs += 600LL * 1000000;
+    manager.draw(FrameContext::capture(&clock));
+    TEST_ASSERT_EQUAL_INT(1, ringing.entered);
+    TEST_ASSERT_TRUE(alarm_times.empty());
+}
+
+void test_main_display_state_rings_for_alarm_consumed_on_another_screen() {
+    // アラーム管理画面にいる間に消化されたアラームは、メインに戻ったときに鳴らす
+    extern AlarmStore alarm_times;
+    alarm_times.clear();
+    alarm_times.insert(kFixedTestTime + 60);
+    MockMainDisplayView view;
+    TimeLogic timeLogic;
+    AlarmLogic alarmLogic;
+    StateManager manager;
+    RingingState ringing;
+    RingingState other;
+    MainDisplayState state(&manager, nullptr, &view, &timeLogic, &alarmLogic);
+    state.setAlarmActiveState(&ringing);
+    manager.setState(&state);
+    manager.draw(FrameContext::at(kFixedTestTime));
+    manager.setState(&other);
+    AlarmLogic::removePastAlarms(alarm_times, kFixedTestTime + 60);
+    manager.setState(&state);
+    TEST_ASSERT_EQUAL_INT(0, ringing.entered);
+    manager.draw(FrameContext::at(kFixedTestTime + 61));
+    TEST_ASSERT_EQUAL_INT(1, ringing.entered);
+    // 鳴動から戻っても二度は鳴らない
+    manager.setState(&state);
+    manager.draw(FrameContext::at(kFixedTestTime + 62));
+    TEST_ASSERT_EQUAL_INT(1, ringing.entered);
+}
+
 int main(int argc, char **argv) {
     UNITY_BEGIN();
     
@@ -432,6 +553,7 @@ int main(int argc, char **argv) {
     RUN_TEST(test_main_display_state_error_handling);
     RUN_TEST(test_main_display_state_time_display_logic);
     RUN_TEST(test_main_display_state_battery_display_logic);
+    RUN_TEST(test_main_display_state_battery_unknown_without_telemetry);
     RUN_TEST(test_main_display_state_alarm_list_display);
     RUN_TEST(test_main_display_state_progress_display);
     RUN_TEST(test_main_display_state_remain_display);
@@ -445,6 +567,8 @@ int main(int argc, char **argv) {
     RUN_TEST(test_main_display_state_nullptr_settings_state_branches);
     RUN_TEST(test_main_display_state_empty_alarm_list_branches);
     RUN_TEST(test_main_display_state_alarm_list_with_items_branches);
+    RUN_TEST(test_main_display_state_wall_clock_step_does_not_ring_relative_alarm);
+    RUN_TEST(test_main_display_state_rings_for_alarm_consumed_on_another_screen);
     
     return UNITY_END();
 } 
\ No newline at end of file
@@ -117,7 +117,7 @@ void test_main_display_view_impl_show_alarm_list() {
     auto mockDisplay = std::make_shared<MockDisplay>();
     MainDisplayViewImpl view(mockDisplay.get());
     
-    std::vector<std::string> alarms = {"12:00", "13:30", "15:45"};
+    FrameStringList alarms = {"12:00", "13:30", "15:45"};
     view.showAlarmList(alarms);
     
     TEST_ASSERT_TRUE(mockDisplay->setTextDatumCalled);
@@ -129,7 +129,7 @@ void test_main_display_view_impl_show_alarm_list_empty() {
     auto mockDisplay = std::make_shared<MockDisplay>();
     MainDisplayViewImpl view(mockDisplay.get());
     
-    std::vector<std::string> alarms;
+    FrameStringList alarms;
     view.showAlarmList(alarms);
     
     TEST_ASSERT_TRUE(mockDisplay->setTextDatumCalled);
@@ -152,7 +152,7 @@ void test_main_display_view_impl_show_alarm_list_partial() {
     auto mockDisplay = std::make_shared<MockDisplay>();
     MainDisplayViewImpl view(mockDisplay.get());
     
-    std::vector<std::string> alarms = {"12:00"}; // 1つだけ
+    FrameStringList alarms = {"12:00"}; // 1つだけ
     view.showAlarmList(alarms);
     
     TEST_ASSERT_TRUE(mockDisplay->setTextDatumCalled);
@@ -0,0 +1,154 @@
+#include <unity.h>
+#include <memory>
+#include "../mock/MockVirtualClock.h"
+#include "../mock/MockVibrationOutput.h"
+#include "LogicTick.h"
+#include "TimeSyncLogic.h"
+#include "AlarmDisplayState.h"
+#include "AlarmStore.h"
+#include "IRandomProvider.h"
+#include "VibrationSequencer.h"
+
+extern AlarmStore alarm_times;
+
+// millis() が 2^32 で折り返す瞬間（約 49.7 日）の 10 分前から 20 分間を仮想時間で回す
+static const int64_t kWrapUs = 4294967296LL * 1000;
+static const int64_t kStartUs = kWrapUs - 10LL * 60 * 1000000;
+static const int64_t kEndUs = kWrapUs + 10LL * 60 * 1000000;
+
+class FixedRandom : public IRandomProvider {
+public:
+    uint64_t getRandom64() override { return 0x0123456789abcdefULL; }
+};
+
+class CountingAlarmView : public IAlarmDisplayView {
+public:
+    CountingAlarmView() : lists(0) {}
+    void showTitle(const char*, int, bool) override {}
+    void showHints(const char*, const char*, const char*) override {}
+    void showAlarmList(const std::vector<time_t>&, size_t) override { ++lists; }
+    void showNoAlarms() override { ++lists; }
+    void clear() override {}
+    int lists;
+};
+
+void setUp() {}
+void tearDown() { alarm_times.clear(); }
+
+void test_virtual_clock_really_wraps_millis() {
+    MockVirtualClock clock(kWrapUs - 1000);
+    TEST_ASSERT_EQUAL_UINT32(0xFFFFFFFFu, clock.monotonicMillis());
+    clock.advanceMs(1);
+    TEST_ASSERT_EQUAL_UINT32(0u, clock.monotonicMillis());
+    TEST_ASSERT_TRUE(clock.monotonicMicros() == kWrapUs);
+}
+
+// 100Hz ティックで 7 秒毎に短押し/長押しを交互に入れ、全て 1 回ずつ検出されること
+void test_buttons_through_wrap() {
+    MockVirtualClock clock(kStartUs);
+    ButtonEventQueue queue;
+    LogicTick logic(&queue);
+    const int cycles = static_cast<int>((kEndUs - kStartUs) / 7000000);
+    int shortPresses = 0;
+    int longPresses = 0;
+    for (int cycle = 0; cycle < cycles; ++cycle) {
+        const uint32_t holdMs = (cycle % 2 == 0) ? 120 : 900;
+        for (uint32_t ms = 0; ms < 7000; ms += LogicTick::kPeriodMs) {
+            const bool pressed = ms >= 1000 && ms < 1000 + holdMs;
+            logic.tick(clock.monotonicMicros(), pressed, false, false);
+            ButtonEvents e;
+            while (queue.pop(e)) {
+                if (e.shortPress) ++shortPresses;
+                if (e.longPress) ++longPresses;
+            }
+            clock.advanceMs(LogicTick::kPeriodMs);
+        }
+    }
+    TEST_ASSERT_TRUE(clock.monotonicMicros() > kWrapUs + 5LL * 60 * 1000000);
+    TEST_ASSERT_EQUAL_INT((cycles + 1) / 2, shortPresses);
+    TEST_ASSERT_EQUAL_INT(cycles / 2, longPresses);
+}
+
+// 折り返しをまたぐ 60 秒の受付窓が正しく縮み、正しく閉じること
+void test_time_sync_window_through_wrap() {
+    MockVirtualClock clock(kWrapUs - 30LL * 1000000);
+    FixedRandom rnd;
+    TimeSyncLogic logic;
+    logic.begin(&rnd, &clock, 60000);
+    uint32_t prevRemain = logic.getWindowRemainingMs(clock.monotonicMicros());
+    TEST_ASSERT_EQUAL_UINT32(60000, prevRemain);
+    for (int i = 0; i < 59; ++i) {
+        clock.advanceMs(1000);
+        const uint32_t remain = logic.getWindowRemainingMs(clock.monotonicMicros());
+        TEST_ASSERT_EQUAL_UINT32(prevRemain - 1000, remain);
+        TEST_ASSERT_FALSE(logic.isWindowExpired(clock.monotonicMicros()));
+        prevRemain = remain;
+    }
+    clock.advanceMs(1001);
+    TEST_ASSERT_EQUAL_UINT32(0, logic.getWindowRemainingMs(clock.monotonicMicros()));
+    TEST_ASSERT_TRUE(logic.isWindowExpired(clock.monotonicMicros()));
+}
+
+// 操作後 3 秒の描画停止は折り返しをまたいでも 3 秒で明ける
+void test_alarm_list_pause_through_wrap() {
+    std::shared_ptr<MockVirtualClock> clock = std::make_shared<MockVirtualClock>(kWrapUs - 1000000);
+    CountingAlarmView view;
+    StateManager manager;
+    AlarmDisplayState state(&manager, &view, clock);
+    alarm_times.insert(clock->now() + 3600);
+    state.onEnter();
+    state.onButtonA(); // 折り返しの 1 秒前に操作
+    alarm_times.insert(clock->now() + 7200); // 一覧が変わっても操作直後は描き直さない
+    const int before = view.lists;
+    for (int i = 0; i < 29; ++i) {
+        clock->advanceMs(100);
+        state.onDraw();
+    }
+    TEST_ASSERT_EQUAL_INT(before, view.lists); // 2.9 秒: まだ停止中
+    clock->advanceMs(200);
+    state.onDraw();
+    TEST_ASSERT_TRUE(view.lists > before);
+}
+
+// アクチュエータは 32bit ms の時間軸（差分で扱う）: 繰り返しパターンが折り返しで途切れない
+void test_vibration_pattern_through_wrap() {
+    MockVirtualClock clock(kWrapUs - 250000);
+    static const VibrationSequencer::Segment kPulse[] = { { 100, 100 }, { 100, 0 } };
+    VibrationSequencer seq;
+    MockVibrationOut out;
+    seq.loadPattern(kPulse, 2, true);
+    seq.start(clock.monotonicMillis());
+    int onEdges = 0;
+    uint8_t last = 0xFF;
+    for (int i = 0; i < 100; ++i) { // 1 秒（折り返しを含む）
+        seq.update(clock.monotonicMillis(), &out);
+        if (out.lastDuty != last && out.lastDuty == 100) ++onEdges;
+        last = out.lastDuty;
+        clock.advanceMs(10);
+    }
+    TEST_ASSERT_TRUE(seq.isActive());
+    TEST_ASSERT_EQUAL_INT(5, onEdges);
+}
+
+// 締め切りは 64bit µs: 折り返しをまたぐアラームがちょうどに鳴る
+void test_alarm_deadline_through_wrap() {
+    MockVirtualClock clock(kWrapUs - 5LL * 1000000);
+    AlarmStore store;
+    store.setTimeSource(&clock);
+    store.insert(clock.now() + 10, AlarmKind::Relative);
+    clock.advanceUs(10LL * 1000000 - 1);
+    TEST_ASSERT_EQUAL_INT(0, (int)store.removeDue(clock.now()));
+    clock.advanceUs(1);
+    TEST_ASSERT_EQUAL_INT(1, (int)store.removeDue(clock.now()));
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_virtual_clock_really_wraps_millis);
+    RUN_TEST(test_buttons_through_wrap);
+    RUN_TEST(test_time_sync_window_through_wrap);
+    RUN_TEST(test_alarm_list_pause_through_wrap);
+    RUN_TEST(test_vibration_pattern_through_wrap);
+    RUN_TEST(test_alarm_deadline_through_wrap);
+    return UNITY_END();
+}
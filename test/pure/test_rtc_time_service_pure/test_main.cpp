@@ -0,0 +1,240 @@
+#include <unity.h>
+#include "RtcTimeService.h"
+#include "IRtc.h"
+#include "ITimeService.h"
+#include <cstring>
+#include <string>
+
+void setUp() {}
+void tearDown() {}
+
+class FakeRtc : public IRtc {
+public:
+    FakeRtc() : present(true), integrityLost(false), value{2025, 8, 11, 6, 11, 46},
+                writes(0), written{}, hasTz(false), tz(0), tzName(), tzSaves(0) {}
+    bool read(RtcDateTime& out, bool& lost) override {
+        if (!present) return false;
+        out = value; lost = integrityLost; return true;
+    }
+    bool write(const RtcDateTime& v) override { ++writes; written = v; return true; }
+    bool loadTimeZone(char* name, size_t cap, int& out) override {
+        if (!hasTz) return false;
+        std::strncpy(name, tzName.c_str(), cap - 1);
+        name[cap - 1] = '\0';
+        out = tz;
+        return true;
+    }
+    void saveTimeZone(const char* name, size_t nameLen, int minutes) override {
+        ++tzSaves; hasTz = true; tzName.assign(name, nameLen); tz = minutes;
+    }
+
+    bool present;
+    bool integrityLost;
+    RtcDateTime value;
+    int writes;
+    RtcDateTime written;
+    bool hasTz;
+    int tz;
+    std::string tzName;
+    int tzSaves;
+};
+
+class FakeClock : public ITimeService {
+public:
+    FakeClock() : sec(0), setOk(true), sets(0), zoneName(), zoneOffset(0), zoneApplies(0) {}
+    time_t now() const override { return sec; }
+    struct tm* localtime(time_t* t) const override { return ::gmtime(t); }
+    bool setSystemTime(time_t t) override { ++sets; if (setOk) sec = t; return setOk; }
+    void applyTimeZone(const char* name, size_t len, int offsetMinutes) override {
+        ++zoneApplies; zoneName.assign(name, len); zoneOffset = offsetMinutes;
+    }
+    uint32_t monotonicMillis() const override { return 0; }
+    time_t sec;
+    bool setOk;
+    int sets;
+    std::string zoneName;
+    int zoneOffset;
+    int zoneApplies;
+};
+
+// --- calendar conversion ---
+void test_to_epoch_2025_new_year() {
+    const RtcDateTime dt{2025, 1, 1, 0, 0, 0};
+    time_t e = 0;
+    TEST_ASSERT_TRUE(RtcTimeService::toEpoch(dt, e));
+    TEST_ASSERT_EQUAL_INT64(1735689600LL, (int64_t)e);
+}
+
+void test_to_epoch_leap_day() {
+    const RtcDateTime dt{2028, 2, 29, 12, 0, 0};
+    time_t e = 0;
+    TEST_ASSERT_TRUE(RtcTimeService::toEpoch(dt, e));
+    TEST_ASSERT_EQUAL_INT64(1835438400LL, (int64_t)e);
+}
+
+void test_to_epoch_rejects_invalid_day() {
+    const RtcDateTime dt{2025, 2, 29, 0, 0, 0};
+    time_t e = 0;
+    TEST_ASSERT_FALSE(RtcTimeService::toEpoch(dt, e));
+}
+
+void test_to_epoch_rejects_invalid_time() {
+    const RtcDateTime dt{2025, 1, 1, 24, 0, 0};
+    time_t e = 0;
+    TEST_ASSERT_FALSE(RtcTimeService::toEpoch(dt, e));
+}
+
+void test_from_epoch_round_trip() {
+    RtcDateTime dt{};
+    RtcTimeService::fromEpoch(1754892706, dt);
+    TEST_ASSERT_EQUAL_INT(2025, dt.year);
+    TEST_ASSERT_EQUAL_INT(8, dt.month);
+    TEST_ASSERT_EQUAL_INT(11, dt.day);
+    TEST_ASSERT_EQUAL_INT(6, dt.hour);
+    TEST_ASSERT_EQUAL_INT(11, dt.minute);
+    TEST_ASSERT_EQUAL_INT(46, dt.second);
+}
+
+// --- boot read/validate policy ---
+void test_boot_restores_valid_rtc() {
+    FakeRtc rtc; FakeClock clock;
+    RtcTimeService svc(&clock, &rtc);
+    TEST_ASSERT_EQUAL_INT((int)RtcTimeService::BootResult::Restored, (int)svc.restoreAtBoot());
+    TEST_ASSERT_EQUAL_INT64(1754892706LL, (int64_t)clock.now());
+    TEST_ASSERT_EQUAL_INT(0, rtc.writes);
+}
+
+void test_boot_without_rtc() {
+    FakeRtc rtc; rtc.present = false; FakeClock clock;
+    RtcTimeService svc(&clock, &rtc);
+    TEST_ASSERT_EQUAL_INT((int)RtcTimeService::BootResult::NoRtc, (int)svc.restoreAtBoot());
+    TEST_ASSERT_EQUAL_INT(0, clock.sets);
+}
+
+void test_boot_null_rtc() {
+    FakeClock clock;
+    RtcTimeService svc(&clock, nullptr);
+    TEST_ASSERT_EQUAL_INT((int)RtcTimeService::BootResult::NoRtc, (int)svc.restoreAtBoot());
+}
+
+void test_boot_rejects_integrity_lost() {
+    FakeRtc rtc; rtc.integrityLost = true; FakeClock clock;
+    RtcTimeService svc(&clock, &rtc);
+    TEST_ASSERT_EQUAL_INT((int)RtcTimeService::BootResult::IntegrityLost, (int)svc.restoreAtBoot());
+    TEST_ASSERT_EQUAL_INT(0, clock.sets);
+}
+
+void test_boot_rejects_garbage_fields() {
+    FakeRtc rtc; rtc.value = RtcDateTime{2025, 13, 45, 0, 0, 0}; FakeClock clock;
+    RtcTimeService svc(&clock, &rtc);
+    TEST_ASSERT_EQUAL_INT((int)RtcTimeService::BootResult::InvalidFields, (int)svc.restoreAtBoot());
+}
+
+void test_boot_rejects_reset_value_before_minimum() {
+    // BM8563 power-on default is around 2000-01-01
+    FakeRtc rtc; rtc.value = RtcDateTime{2000, 1, 1, 0, 0, 0}; FakeClock clock;
+    RtcTimeService svc(&clock, &rtc);
+    TEST_ASSERT_EQUAL_INT((int)RtcTimeService::BootResult::OutOfRange, (int)svc.restoreAtBoot());
+}
+
+void test_boot_reports_apply_failure() {
+    FakeRtc rtc; FakeClock clock; clock.setOk = false;
+    RtcTimeService svc(&clock, &rtc);
+    TEST_ASSERT_EQUAL_INT((int)RtcTimeService::BootResult::ApplyFailed, (int)svc.restoreAtBoot());
+}
+
+// --- write-back on sync ---
+void test_sync_writes_rtc_rounded_to_second() {
+    FakeRtc rtc; FakeClock clock;
+    RtcTimeService svc(&clock, &rtc);
+    TEST_ASSERT_TRUE(svc.applySyncedTime(1754892706600000LL));
+    TEST_ASSERT_EQUAL_INT(1, rtc.writes);
+    TEST_ASSERT_EQUAL_INT(47, rtc.written.second);
+}
+
+void test_failed_sync_does_not_write_rtc() {
+    FakeRtc rtc; FakeClock clock; clock.setOk = false;
+    RtcTimeService svc(&clock, &rtc);
+    TEST_ASSERT_FALSE(svc.applySyncedTime(1754892706000000LL));
+    TEST_ASSERT_EQUAL_INT(0, rtc.writes);
+}
+
+void test_plain_set_does_not_write_rtc() {
+    // boot minimum correction must not overwrite a good RTC later
+    FakeRtc rtc; FakeClock clock;
+    RtcTimeService svc(&clock, &rtc);
+    svc.setSystemTime(1735689600);
+    TEST_ASSERT_EQUAL_INT(0, rtc.writes);
+}
+
+// --- timezone ---
+void test_time_zone_is_forwarded_and_remembered() {
+    FakeRtc rtc; FakeClock clock;
+    RtcTimeService svc(&clock, &rtc);
+    svc.applyTimeZone("Asia/Tokyo", 10, 540);
+    TEST_ASSERT_EQUAL_INT(1, clock.zoneApplies);
+    TEST_ASSERT_EQUAL_STRING("Asia/Tokyo", rtc.tzName.c_str());
+    TEST_ASSERT_EQUAL_INT(540, rtc.tz);
+}
+
+void test_time_zone_is_restored_into_inner_clock() {
+    FakeRtc rtc; rtc.hasTz = true; rtc.tzName = "Europe/Berlin"; rtc.tz = 60; FakeClock clock;
+    RtcTimeService svc(&clock, &rtc);
+    TEST_ASSERT_TRUE(svc.restoreTimeZone());
+    TEST_ASSERT_EQUAL_STRING("Europe/Berlin", clock.zoneName.c_str());
+    TEST_ASSERT_EQUAL_INT(60, clock.zoneOffset);
+}
+
+void test_offset_only_time_zone_round_trips() {
+    FakeRtc rtc; FakeClock clock;
+    RtcTimeService svc(&clock, &rtc);
+    svc.applyTimeZone(nullptr, 0, -300);
+    FakeClock fresh;
+    RtcTimeService next(&fresh, &rtc);
+    TEST_ASSERT_TRUE(next.restoreTimeZone());
+    TEST_ASSERT_EQUAL_STRING("", fresh.zoneName.c_str());
+    TEST_ASSERT_EQUAL_INT(-300, fresh.zoneOffset);
+}
+
+void test_overlong_time_zone_name_keeps_offset_only() {
+    FakeRtc rtc; FakeClock clock;
+    RtcTimeService svc(&clock, &rtc);
+    const std::string longName(RtcTimeService::kTzNameMaxLen + 1, 'x');
+    svc.applyTimeZone(longName.data(), longName.size(), 120);
+    TEST_ASSERT_EQUAL_STRING("", rtc.tzName.c_str());
+    TEST_ASSERT_EQUAL_INT(120, rtc.tz);
+}
+
+void test_time_zone_out_of_range_is_ignored() {
+    FakeRtc rtc; rtc.hasTz = true; rtc.tz = 2000; FakeClock clock;
+    RtcTimeService svc(&clock, &rtc);
+    TEST_ASSERT_FALSE(svc.restoreTimeZone());
+    TEST_ASSERT_EQUAL_INT(0, clock.zoneApplies);
+    svc.applyTimeZone("Etc/Bogus", 9, 2000);
+    TEST_ASSERT_EQUAL_INT(0, rtc.tzSaves);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_to_epoch_2025_new_year);
+    RUN_TEST(test_to_epoch_leap_day);
+    RUN_TEST(test_to_epoch_rejects_invalid_day);
+    RUN_TEST(test_to_epoch_rejects_invalid_time);
+    RUN_TEST(test_from_epoch_round_trip);
+    RUN_TEST(test_boot_restores_valid_rtc);
+    RUN_TEST(test_boot_without_rtc);
+    RUN_TEST(test_boot_null_rtc);
+    RUN_TEST(test_boot_rejects_integrity_lost);
+    RUN_TEST(test_boot_rejects_garbage_fields);
+    RUN_TEST(test_boot_rejects_reset_value_before_minimum);
+    RUN_TEST(test_boot_reports_apply_failure);
+    RUN_TEST(test_sync_writes_rtc_rounded_to_second);
+    RUN_TEST(test_failed_sync_does_not_write_rtc);
+    RUN_TEST(test_plain_set_does_not_write_rtc);
+    RUN_TEST(test_time_zone_is_forwarded_and_remembered);
+    RUN_TEST(test_time_zone_is_restored_into_inner_clock);
+    RUN_TEST(test_offset_only_time_zone_round_trips);
+    RUN_TEST(test_overlong_time_zone_name_keeps_offset_only);
+    RUN_TEST(test_time_zone_out_of_range_is_ignored);
+    return UNITY_END();
+}
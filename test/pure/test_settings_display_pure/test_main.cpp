@@ -1,11 +1,12 @@
 #include <unity.h>
 #include "SettingsDisplayState.h"
 #include "settings/SettingsLogic.h"
+#include "AlarmStore.h"
 #include <memory>
 #include <vector>
 #include <ctime>
 
-extern std::vector<time_t> alarm_times;
+extern AlarmStore alarm_times;
 
 const time_t kFixedTestTime = 1700000000;
 
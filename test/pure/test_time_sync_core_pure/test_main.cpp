@@ -1,6 +1,7 @@
 #include <unity.h>
 #include "TimeSyncCore.h"
 #include <string>
+#include <cstring>
 
 void setUp() {}
 void tearDown() {}
@@ -78,6 +79,251 @@ void test_build_posix_tz_half_hour(void) {
     TEST_ASSERT_EQUAL_STRING("LT-5:30", TimeSyncCore::buildPosixTZ(330).c_str());
 }
 
+static TimeSyncCore::ParseResult parseBody(const char* body, TimeSyncCore::TimeSetRequest& req) {
+    return TimeSyncCore::parseTimeSetRequest(body, std::strlen(body), req);
+}
+
+void test_parse_time_set_ok_fields(void) {
+    const char* body = "{\"epochMs\":1754892706965,\"tzOffsetMin\":540,\"token\":\"ABC\"}";
+    TimeSyncCore::TimeSetRequest req{};
+    TEST_ASSERT_EQUAL_INT((int)TimeSyncCore::ParseResult::Ok, (int)parseBody(body, req));
+    TEST_ASSERT_EQUAL_INT64(1754892706965LL, req.epochMs);
+    TEST_ASSERT_EQUAL_INT(540, req.tzOffsetMin);
+    TEST_ASSERT_EQUAL_INT(3, (int)req.tokenLen);
+    TEST_ASSERT_TRUE(std::strncmp("ABC", req.token, req.tokenLen) == 0);
+}
+
+void test_parse_time_set_token_is_view_into_body(void) {
+    const char* body = "{\"token\":\"XYZ\",\"epochMs\":1,\"tzOffsetMin\":-570}";
+    TimeSyncCore::TimeSetRequest req{};
+    TEST_ASSERT_EQUAL_INT((int)TimeSyncCore::ParseResult::Ok, (int)parseBody(body, req));
+    TEST_ASSERT_EQUAL_PTR(body + 10, req.token);
+}
+
+void test_parse_time_set_allows_whitespace(void) {
+    const char* body = " {\n \"epochMs\" : 5 ,\t\"tzOffsetMin\":-60 , \"token\" : \"t\" }\r\n";
+    TimeSyncCore::TimeSetRequest req{};
+    TEST_ASSERT_EQUAL_INT((int)TimeSyncCore::ParseResult::Ok, (int)parseBody(body, req));
+}
+
+void test_parse_time_set_ignores_key_text_inside_value(void) {
+    // jsonExtractRaw would match "epochMs" inside the token value
+    const char* body = "{\"token\":\"epochMs\",\"tzOffsetMin\":0,\"epochMs\":42}";
+    TimeSyncCore::TimeSetRequest req{};
+    TEST_ASSERT_EQUAL_INT((int)TimeSyncCore::ParseResult::Ok, (int)parseBody(body, req));
+    TEST_ASSERT_EQUAL_INT64(42, req.epochMs);
+}
+
+void test_parse_time_set_rejects_missing_key(void) {
+    TimeSyncCore::TimeSetRequest req{};
+    TEST_ASSERT_EQUAL_INT((int)TimeSyncCore::ParseResult::MissingKey,
+                          (int)parseBody("{\"epochMs\":1,\"token\":\"a\"}", req));
+}
+
+void test_parse_time_set_rejects_duplicate_key(void) {
+    TimeSyncCore::TimeSetRequest req{};
+    TEST_ASSERT_EQUAL_INT((int)TimeSyncCore::ParseResult::DuplicateKey,
+                          (int)parseBody("{\"epochMs\":1,\"epochMs\":2,\"tzOffsetMin\":0,\"token\":\"a\"}", req));
+}
+
+void test_parse_time_set_rejects_unknown_key(void) {
+    TimeSyncCore::TimeSetRequest req{};
+    TEST_ASSERT_EQUAL_INT((int)TimeSyncCore::ParseResult::UnknownKey,
+                          (int)parseBody("{\"epochMs\":1,\"tz\":0,\"token\":\"a\"}", req));
+}
+
+void test_parse_time_set_rejects_fraction(void) {
+    TimeSyncCore::TimeSetRequest req{};
+    TEST_ASSERT_EQUAL_INT((int)TimeSyncCore::ParseResult::BadNumber,
+                          (int)parseBody("{\"epochMs\":1.5,\"tzOffsetMin\":0,\"token\":\"a\"}", req));
+}
+
+void test_parse_time_set_rejects_leading_zero(void) {
+    TimeSyncCore::TimeSetRequest req{};
+    TEST_ASSERT_EQUAL_INT((int)TimeSyncCore::ParseResult::BadNumber,
+                          (int)parseBody("{\"epochMs\":01,\"tzOffsetMin\":0,\"token\":\"a\"}", req));
+}
+
+void test_parse_time_set_rejects_int64_overflow(void) {
+    TimeSyncCore::TimeSetRequest req{};
+    TEST_ASSERT_EQUAL_INT((int)TimeSyncCore::ParseResult::BadNumber,
+                          (int)parseBody("{\"epochMs\":9223372036854775808,\"tzOffsetMin\":0,\"token\":\"a\"}", req));
+}
+
+void test_parse_time_set_rejects_tz_beyond_int(void) {
+    TimeSyncCore::TimeSetRequest req{};
+    TEST_ASSERT_EQUAL_INT((int)TimeSyncCore::ParseResult::BadNumber,
+                          (int)parseBody("{\"epochMs\":1,\"tzOffsetMin\":4294967296,\"token\":\"a\"}", req));
+}
+
+void test_parse_time_set_rejects_string_number(void) {
+    TimeSyncCore::TimeSetRequest req{};
+    TEST_ASSERT_EQUAL_INT((int)TimeSyncCore::ParseResult::TypeMismatch,
+                          (int)parseBody("{\"epochMs\":\"1\",\"tzOffsetMin\":0,\"token\":\"a\"}", req));
+}
+
+void test_parse_time_set_rejects_escape_in_token(void) {
+    TimeSyncCore::TimeSetRequest req{};
+    TEST_ASSERT_EQUAL_INT((int)TimeSyncCore::ParseResult::BadString,
+                          (int)parseBody("{\"epochMs\":1,\"tzOffsetMin\":0,\"token\":\"a\\\"b\"}", req));
+}
+
+void test_parse_time_set_rejects_nested_value(void) {
+    TimeSyncCore::TimeSetRequest req{};
+    TEST_ASSERT_EQUAL_INT((int)TimeSyncCore::ParseResult::BadNumber,
+                          (int)parseBody("{\"epochMs\":{\"x\":1},\"tzOffsetMin\":0,\"token\":\"a\"}", req));
+}
+
+void test_parse_time_set_rejects_trailing_garbage(void) {
+    TimeSyncCore::TimeSetRequest req{};
+    TEST_ASSERT_EQUAL_INT((int)TimeSyncCore::ParseResult::Syntax,
+                          (int)parseBody("{\"epochMs\":1,\"tzOffsetMin\":0,\"token\":\"a\"}x", req));
+}
+
+void test_parse_time_set_rejects_trailing_comma(void) {
+    TimeSyncCore::TimeSetRequest req{};
+    TEST_ASSERT_EQUAL_INT((int)TimeSyncCore::ParseResult::Syntax,
+                          (int)parseBody("{\"epochMs\":1,\"tzOffsetMin\":0,\"token\":\"a\",}", req));
+}
+
+void test_parse_time_set_rejects_truncated_body(void) {
+    const char* body = "{\"epochMs\":1,\"tzOffsetMin\":0,\"token\":\"abc\"}";
+    TimeSyncCore::TimeSetRequest req{};
+    // length excludes the closing brace: must not read past len
+    TEST_ASSERT_EQUAL_INT((int)TimeSyncCore::ParseResult::Syntax,
+                          (int)TimeSyncCore::parseTimeSetRequest(body, std::strlen(body) - 1, req));
+}
+
+void test_parse_time_set_rejects_oversized_body(void) {
+    std::string body(TimeSyncCore::kTimeSetBodyMaxLen + 1, ' ');
+    TimeSyncCore::TimeSetRequest req{};
+    TEST_ASSERT_EQUAL_INT((int)TimeSyncCore::ParseResult::TooLarge,
+                          (int)TimeSyncCore::parseTimeSetRequest(body.data(), body.size(), req));
+}
+
+void test_parse_result_code(void) {
+    TEST_ASSERT_EQUAL_STRING("duplicate_key", TimeSyncCore::parseResultCode(TimeSyncCore::ParseResult::DuplicateKey));
+}
+
+void test_verify_token_view(void) {
+    const char* buf = "abcdXYZ";
+    TEST_ASSERT_TRUE(TimeSyncCore::verifyToken("abcd", buf, 4));
+    TEST_ASSERT_FALSE(TimeSyncCore::verifyToken("abcd", buf, 5));
+}
+
+void test_parse_time_set_samples() {
+    const char* body = "{\"epochMs\":1,\"tzOffsetMin\":0,\"token\":\"a\","
+                       "\"samples\":[[100,7,8,120],[200,4294967295,0,230]]}";
+    TimeSyncCore::TimeSetRequest req{};
+    TEST_ASSERT_EQUAL_INT((int)TimeSyncCore::ParseResult::Ok, (int)parseBody(body, req));
+    TEST_ASSERT_EQUAL_INT(2, (int)req.sampleCount);
+    TEST_ASSERT_EQUAL_INT64(120, req.samples[0].clientRecvMs);
+    TEST_ASSERT_EQUAL_UINT32(4294967295u, req.samples[1].deviceRecvMs);
+}
+
+void test_parse_time_set_without_samples_has_zero_count() {
+    TimeSyncCore::TimeSetRequest req{};
+    req.sampleCount = 3;
+    parseBody("{\"epochMs\":1,\"tzOffsetMin\":0,\"token\":\"a\"}", req);
+    TEST_ASSERT_EQUAL_INT(0, (int)req.sampleCount);
+}
+
+void test_parse_time_set_rejects_too_many_samples() {
+    std::string body = "{\"epochMs\":1,\"tzOffsetMin\":0,\"token\":\"a\",\"samples\":[";
+    for (size_t i = 0; i <= TimeSyncCore::kTimeSetMaxSamples; ++i) {
+        body += (i == 0) ? "[1,2,3,4]" : ",[1,2,3,4]";
+    }
+    body += "]}";
+    TimeSyncCore::TimeSetRequest req{};
+    TEST_ASSERT_EQUAL_INT((int)TimeSyncCore::ParseResult::TooManySamples, (int)parseBody(body.c_str(), req));
+}
+
+void test_parse_time_set_rejects_device_stamp_out_of_range() {
+    TimeSyncCore::TimeSetRequest req{};
+    TEST_ASSERT_EQUAL_INT((int)TimeSyncCore::ParseResult::BadNumber,
+                          (int)parseBody("{\"epochMs\":1,\"tzOffsetMin\":0,\"token\":\"a\",\"samples\":[[1,-2,3,4]]}", req));
+}
+
+void test_parse_time_set_rejects_short_sample() {
+    TimeSyncCore::TimeSetRequest req{};
+    TEST_ASSERT_EQUAL_INT((int)TimeSyncCore::ParseResult::Syntax,
+                          (int)parseBody("{\"epochMs\":1,\"tzOffsetMin\":0,\"token\":\"a\",\"samples\":[[1,2,3]]}", req));
+}
+
+void test_parse_time_set_tz_name() {
+    const char* body = "{\"epochMs\":1,\"tzOffsetMin\":-300,\"token\":\"a\",\"tzName\":\"America/New_York\"}";
+    TimeSyncCore::TimeSetRequest req{};
+    TEST_ASSERT_EQUAL_INT((int)TimeSyncCore::ParseResult::Ok, (int)parseBody(body, req));
+    TEST_ASSERT_EQUAL_INT(16, (int)req.tzNameLen);
+    TEST_ASSERT_EQUAL_INT(0, strncmp(req.tzName, "America/New_York", 16));
+}
+
+void test_parse_time_set_without_tz_name() {
+    TimeSyncCore::TimeSetRequest req{};
+    parseBody("{\"epochMs\":1,\"tzOffsetMin\":0,\"token\":\"a\"}", req);
+    TEST_ASSERT_NULL(req.tzName);
+    TEST_ASSERT_EQUAL_INT(0, (int)req.tzNameLen);
+}
+
+void test_parse_time_set_rejects_bad_tz_name() {
+    TimeSyncCore::TimeSetRequest req{};
+    const std::string tooLong(TimeSyncCore::kTimeSetTzNameMaxLen + 1, 'x');
+    const std::string body = "{\"epochMs\":1,\"tzOffsetMin\":0,\"token\":\"a\",\"tzName\":\"" + tooLong + "\"}";
+    TEST_ASSERT_EQUAL_INT((int)TimeSyncCore::ParseResult::BadString, (int)parseBody(body.c_str(), req));
+    TEST_ASSERT_EQUAL_INT((int)TimeSyncCore::ParseResult::TypeMismatch,
+                          (int)parseBody("{\"epochMs\":1,\"tzOffsetMin\":0,\"token\":\"a\",\"tzName\":9}", req));
+}
+
+void test_build_probe_response() {
+    char buf[160];
+    const size_t n = TimeSyncCore::buildProbeResponse(7, 8, buf, sizeof(buf));
+    TEST_ASSERT_TRUE(n > 0);
+    TEST_ASSERT_NOT_NULL(strstr(buf, "Content-Length: 15\r\n"));
+    TEST_ASSERT_EQUAL_STRING("\r\n\r\n{\"t1\":7,\"t2\":8}", buf + n - 19);
+}
+
+// Raw captive HTTP responses
+void test_build_redirect_response() {
+    char buf[160];
+    const size_t n = TimeSyncCore::buildRedirectResponse("abc123", buf, sizeof(buf));
+    TEST_ASSERT_EQUAL_STRING(
+        "HTTP/1.1 302 Found\r\n"
+        "Location: /sync?t=abc123\r\n"
+        "Cache-Control: no-store\r\n"
+        "Content-Length: 0\r\n"
+        "Connection: close\r\n\r\n", buf);
+    TEST_ASSERT_EQUAL_UINT32(strlen(buf), n);
+}
+
+void test_build_redirect_response_overflow_returns_zero() {
+    char buf[16];
+    TEST_ASSERT_EQUAL_UINT32(0, TimeSyncCore::buildRedirectResponse("abc123", buf, sizeof(buf)));
+}
+
+void test_build_gzip_page_header() {
+    char buf[192];
+    const size_t n = TimeSyncCore::buildGzipPageResponseHeader(470, "\"e1-t\"", buf, sizeof(buf));
+    TEST_ASSERT_TRUE(n > 0);
+    TEST_ASSERT_NOT_NULL(strstr(buf, "HTTP/1.1 200 OK\r\n"));
+    TEST_ASSERT_NOT_NULL(strstr(buf, "Content-Encoding: gzip\r\n"));
+    TEST_ASSERT_NOT_NULL(strstr(buf, "Content-Length: 470\r\n"));
+    TEST_ASSERT_NOT_NULL(strstr(buf, "ETag: \"e1-t\"\r\n"));
+    TEST_ASSERT_EQUAL_STRING("\r\n\r\n", buf + n - 4);
+}
+
+void test_build_not_modified_response() {
+    char buf[128];
+    const size_t n = TimeSyncCore::buildNotModifiedResponse("\"e1-t\"", buf, sizeof(buf));
+    TEST_ASSERT_TRUE(n > 0);
+    TEST_ASSERT_EQUAL_INT(0, strncmp(buf, "HTTP/1.1 304 Not Modified\r\n", 27));
+}
+
+void test_build_session_etag() {
+    char buf[32];
+    TimeSyncCore::buildSessionEtag("0123abcd", "tok", buf, sizeof(buf));
+    TEST_ASSERT_EQUAL_STRING("\"0123abcd-tok\"", buf);
+}
+
 int main() {
     UNITY_BEGIN();
     RUN_TEST(test_build_wifi_qr_payload_basic);
@@ -95,6 +341,43 @@ int main() {
     RUN_TEST(test_json_extracts);
     RUN_TEST(test_build_posix_tz_whole_hour);
     RUN_TEST(test_build_posix_tz_half_hour);
+    // Single-pass /time/set parser
+    RUN_TEST(test_parse_time_set_ok_fields);
+    RUN_TEST(test_parse_time_set_token_is_view_into_body);
+    RUN_TEST(test_parse_time_set_allows_whitespace);
+    RUN_TEST(test_parse_time_set_ignores_key_text_inside_value);
+    RUN_TEST(test_parse_time_set_rejects_missing_key);
+    RUN_TEST(test_parse_time_set_rejects_duplicate_key);
+    RUN_TEST(test_parse_time_set_rejects_unknown_key);
+    RUN_TEST(test_parse_time_set_rejects_fraction);
+    RUN_TEST(test_parse_time_set_rejects_leading_zero);
+    RUN_TEST(test_parse_time_set_rejects_int64_overflow);
+    RUN_TEST(test_parse_time_set_rejects_tz_beyond_int);
+    RUN_TEST(test_parse_time_set_rejects_string_number);
+    RUN_TEST(test_parse_time_set_rejects_escape_in_token);
+    RUN_TEST(test_parse_time_set_rejects_nested_value);
+    RUN_TEST(test_parse_time_set_rejects_trailing_garbage);
+    RUN_TEST(test_parse_time_set_rejects_trailing_comma);
+    RUN_TEST(test_parse_time_set_rejects_truncated_body);
+    RUN_TEST(test_parse_time_set_rejects_oversized_body);
+    RUN_TEST(test_parse_result_code);
+    RUN_TEST(test_verify_token_view);
+    // Raw captive HTTP responses
+    RUN_TEST(test_build_redirect_response);
+    RUN_TEST(test_build_redirect_response_overflow_returns_zero);
+    RUN_TEST(test_build_gzip_page_header);
+    RUN_TEST(test_build_not_modified_response);
+    RUN_TEST(test_build_session_etag);
+    // Round-trip samples
+    RUN_TEST(test_parse_time_set_samples);
+    RUN_TEST(test_parse_time_set_without_samples_has_zero_count);
+    RUN_TEST(test_parse_time_set_rejects_too_many_samples);
+    RUN_TEST(test_parse_time_set_rejects_device_stamp_out_of_range);
+    RUN_TEST(test_parse_time_set_rejects_short_sample);
+    RUN_TEST(test_parse_time_set_tz_name);
+    RUN_TEST(test_parse_time_set_without_tz_name);
+    RUN_TEST(test_parse_time_set_rejects_bad_tz_name);
+    RUN_TEST(test_build_probe_response);
     return UNITY_END();
 }
 
@@ -22,11 +22,15 @@ private:
 
 class TestTimeService : public ITimeService {
 public:
-    TestTimeService() : nowMs(0), nowSec(0), setOk(true) {}
+    TestTimeService() : nowMs(0), nowSec(0), setOk(true), lastMicros(0), zoneName(), zoneOffset(0), zoneApplies(0) {}
     uint32_t monotonicMillis() const override { return nowMs; }
     time_t now() const override { return nowSec; }
     struct tm* localtime(time_t* t) const override { return ::localtime(t); }
     bool setSystemTime(time_t t) override { nowSec = t; return setOk; }
+    bool setSystemTimeMicros(int64_t us) override { lastMicros = us; return setSystemTime(static_cast<time_t>(us / 1000000)); }
+    void applyTimeZone(const char* name, size_t len, int offsetMinutes) override {
+        ++zoneApplies; zoneName.assign(name != nullptr ? name : "", len); zoneOffset = offsetMinutes;
+    }
     void setMillis(uint32_t v) { nowMs = v; }
     void setTime(time_t v) { nowSec = v; }
     void setSucceed(bool v) { setOk = v; }
@@ -34,6 +38,11 @@ private:
     uint32_t nowMs;
     time_t nowSec;
     bool setOk;
+public:
+    int64_t lastMicros;
+    std::string zoneName;
+    int zoneOffset;
+    int zoneApplies;
 };
 
 // helpers
@@ -185,6 +194,81 @@ void test_apply_failed_reason() {
     TEST_ASSERT_EQUAL_STRING("apply_failed", logic.getErrorMessage());
 }
 
+// 15) parsed request overload (token view) => AppliedOk
+void test_parsed_request_applies_ok_status() {
+    TimeSyncLogic logic; FixedRandomProvider rnd(7); TestTimeService ts; ts.setMillis(1000);
+    begin_session(logic, rnd, ts, 60000);
+    const std::string body = std::string("{\"epochMs\":1735689601000,\"tzOffsetMin\":540,\"token\":\"")
+        + logic.getCredentials().token + "\"}";
+    TimeSyncCore::TimeSetRequest req{};
+    TEST_ASSERT_EQUAL_INT((int)TimeSyncCore::ParseResult::Ok,
+                          (int)TimeSyncCore::parseTimeSetRequest(body.data(), body.size(), req));
+    ts.setMillis(1500);
+    (void)logic.handleTimeSetRequest(req, &ts);
+    TEST_ASSERT_EQUAL_INT((int)TimeSyncLogic::Status::AppliedOk, (int)logic.getStatus());
+}
+
+// 16) parsed request overload with token prefix => invalid_token
+void test_parsed_request_token_prefix_rejected() {
+    TimeSyncLogic logic; FixedRandomProvider rnd(8); TestTimeService ts; ts.setMillis(1000);
+    begin_session(logic, rnd, ts, 60000);
+    const std::string& token = logic.getCredentials().token;
+    TimeSyncCore::TimeSetRequest req{1735689601000LL, 0, token.data(), token.size() - 1};
+    ts.setMillis(1500);
+    (void)logic.handleTimeSetRequest(req, &ts);
+    TEST_ASSERT_EQUAL_STRING("invalid_token", logic.getErrorMessage());
+}
+
+// 17) round-trip samples => client clock projected to the apply moment (µs)
+void test_samples_project_client_clock_to_apply_time() {
+    TimeSyncLogic logic; FixedRandomProvider rnd(9); TestTimeService ts; ts.setMillis(1000);
+    begin_session(logic, rnd, ts, 60000);
+    const std::string& token = logic.getCredentials().token;
+    TimeSyncCore::TimeSetRequest req{1735689600000LL, 0, token.data(), token.size()};
+    // device t2=1201 ↔ client 1735689700200.5 (RTT 9ms, hold 1ms); 300ms later at apply
+    req.samples[0] = ClockOffsetEstimator::Sample{1735689700195LL, 1200, 1201, 1735689700205LL};
+    req.sampleCount = 1;
+    ts.setMillis(1501);
+    (void)logic.handleTimeSetRequest(req, &ts);
+    TEST_ASSERT_EQUAL_INT64(1735689700500500LL, ts.lastMicros);
+}
+
+// 18) unusable samples => epochMs applied as is
+void test_invalid_samples_fall_back_to_epoch() {
+    TimeSyncLogic logic; FixedRandomProvider rnd(10); TestTimeService ts; ts.setMillis(1000);
+    begin_session(logic, rnd, ts, 60000);
+    const std::string& token = logic.getCredentials().token;
+    TimeSyncCore::TimeSetRequest req{1735689601234LL, 0, token.data(), token.size()};
+    req.samples[0] = ClockOffsetEstimator::Sample{1735689700206LL, 1200, 1201, 1735689700195LL};
+    req.sampleCount = 1;
+    ts.setMillis(1500);
+    (void)logic.handleTimeSetRequest(req, &ts);
+    TEST_ASSERT_EQUAL_INT64(1735689601234000LL, ts.lastMicros);
+}
+
+// 19) IANA zone name + offset are handed to the time service on success only
+void test_time_zone_applied_on_success() {
+    TimeSyncLogic logic; FixedRandomProvider rnd(11); TestTimeService ts; ts.setMillis(1000);
+    begin_session(logic, rnd, ts, 60000);
+    const std::string& token = logic.getCredentials().token;
+    TimeSyncCore::TimeSetRequest req{1735689600000LL, 60, token.data(), token.size()};
+    req.tzName = "Europe/Berlin";
+    req.tzNameLen = 13;
+    TEST_ASSERT_TRUE(logic.handleTimeSetRequest(req, &ts));
+    TEST_ASSERT_EQUAL_INT(1, ts.zoneApplies);
+    TEST_ASSERT_EQUAL_STRING("Europe/Berlin", ts.zoneName.c_str());
+    TEST_ASSERT_EQUAL_INT(60, ts.zoneOffset);
+}
+
+void test_time_zone_not_applied_on_failure() {
+    TimeSyncLogic logic; FixedRandomProvider rnd(12); TestTimeService ts; ts.setMillis(1000);
+    begin_session(logic, rnd, ts, 60000);
+    ts.setSucceed(false);
+    const std::string& token = logic.getCredentials().token;
+    TEST_ASSERT_FALSE(logic.handleTimeSetRequest(1735689600000LL, 60, token, &ts));
+    TEST_ASSERT_EQUAL_INT(0, ts.zoneApplies);
+}
+
 int main() {
     UNITY_BEGIN();
     RUN_TEST(test_begin_sets_step1);
@@ -201,6 +285,12 @@ int main() {
     RUN_TEST(test_tz_out_of_range_reason);
     RUN_TEST(test_apply_failed_status_error);
     RUN_TEST(test_apply_failed_reason);
+    RUN_TEST(test_parsed_request_applies_ok_status);
+    RUN_TEST(test_parsed_request_token_prefix_rejected);
+    RUN_TEST(test_samples_project_client_clock_to_apply_time);
+    RUN_TEST(test_invalid_samples_fall_back_to_epoch);
+    RUN_TEST(test_time_zone_applied_on_success);
+    RUN_TEST(test_time_zone_not_applied_on_failure);
     return UNITY_END();
 }
 
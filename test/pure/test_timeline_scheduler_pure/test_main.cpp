@@ -0,0 +1,229 @@
+#include <unity.h>
+#include <vector>
+#include "TimelineScheduler.h"
+#include "ActuatorTimeline.h"
+#include "AlertPatterns.h"
+#include "../mock/MockVibrationOutput.h"
+
+void setUp() {}
+void tearDown() {}
+
+namespace {
+// Records service order; reschedules after periodMs (0 = one-shot)
+struct RecordingTrack : public ITimelineTrack {
+    RecordingTrack(int tag, std::vector<int>* log, uint32_t periodMs = 0) : tag(tag), log(log), periodMs(periodMs) {}
+    bool onDeadline(uint32_t nowMs, uint32_t& nextMs) override {
+        log->push_back(tag);
+        lastMs = nowMs;
+        if (periodMs == 0) return false;
+        nextMs = nowMs + periodMs;
+        return true;
+    }
+    int tag;
+    std::vector<int>* log;
+    uint32_t periodMs;
+    uint32_t lastMs = 0;
+};
+
+struct PastDeadlineTrack : public ITimelineTrack {
+    bool onDeadline(uint32_t nowMs, uint32_t& nextMs) override { ++calls; nextMs = nowMs - 5; return true; }
+    int calls = 0;
+};
+
+struct CountingBacklight : public IBacklight {
+    void setBrightness(uint8_t b) override { last = b; ++calls; }
+    uint8_t last = 0;
+    int calls = 0;
+};
+
+// Run a timeline the way the device timer does: wake only at deadlines
+int runUntil(ActuatorTimeline& t, uint32_t endMs) {
+    int wakeups = 0;
+    uint32_t due = 0;
+    while (t.nextDeadline(due) && static_cast<int32_t>(due - endMs) <= 0) {
+        t.runDue(due);
+        ++wakeups;
+    }
+    return wakeups;
+}
+} // namespace
+
+void test_empty_scheduler_has_no_deadline() {
+    TimelineScheduler s;
+    uint32_t due = 0;
+    TEST_ASSERT_FALSE(s.nextDeadline(due));
+    TEST_ASSERT_EQUAL_INT(0, (int)s.runDue(1000));
+}
+
+void test_services_earliest_first() {
+    std::vector<int> log;
+    RecordingTrack a(1, &log), b(2, &log), c(3, &log);
+    TimelineScheduler s;
+    const TimelineScheduler::TrackId ia = s.addTrack(&a);
+    const TimelineScheduler::TrackId ib = s.addTrack(&b);
+    const TimelineScheduler::TrackId ic = s.addTrack(&c);
+    s.schedule(ia, 30);
+    s.schedule(ib, 10);
+    s.schedule(ic, 20);
+    uint32_t due = 0;
+    TEST_ASSERT_TRUE(s.nextDeadline(due));
+    TEST_ASSERT_EQUAL_UINT32(10, due);
+    TEST_ASSERT_EQUAL_INT(2, (int)s.runDue(25));
+    TEST_ASSERT_EQUAL_INT(2, log.size());
+    TEST_ASSERT_EQUAL_INT(2, log[0]);
+    TEST_ASSERT_EQUAL_INT(3, log[1]);
+    TEST_ASSERT_TRUE(s.nextDeadline(due));
+    TEST_ASSERT_EQUAL_UINT32(30, due);
+}
+
+void test_reschedule_and_cancel() {
+    std::vector<int> log;
+    RecordingTrack a(1, &log), b(2, &log), c(3, &log);
+    TimelineScheduler s;
+    const TimelineScheduler::TrackId ia = s.addTrack(&a);
+    const TimelineScheduler::TrackId ib = s.addTrack(&b);
+    const TimelineScheduler::TrackId ic = s.addTrack(&c);
+    s.schedule(ia, 10);
+    s.schedule(ib, 20);
+    s.schedule(ic, 30);
+    s.schedule(ic, 5);   // earlier: becomes the head
+    s.schedule(ia, 40);  // later
+    s.cancel(ib);
+    TEST_ASSERT_FALSE(s.isScheduled(ib));
+    s.runDue(100);
+    TEST_ASSERT_EQUAL_INT(2, log.size());
+    TEST_ASSERT_EQUAL_INT(3, log[0]);
+    TEST_ASSERT_EQUAL_INT(1, log[1]);
+}
+
+void test_periodic_track_stays_queued() {
+    std::vector<int> log;
+    RecordingTrack a(1, &log, 25);
+    TimelineScheduler s;
+    const TimelineScheduler::TrackId ia = s.addTrack(&a);
+    s.schedule(ia, 0);
+    s.runDue(0);
+    uint32_t due = 0;
+    TEST_ASSERT_TRUE(s.nextDeadline(due));
+    TEST_ASSERT_EQUAL_UINT32(25, due);
+}
+
+void test_past_deadline_does_not_spin() {
+    PastDeadlineTrack t;
+    TimelineScheduler s;
+    const TimelineScheduler::TrackId id = s.addTrack(&t);
+    s.schedule(id, 10);
+    TEST_ASSERT_EQUAL_INT(1, (int)s.runDue(10));
+    uint32_t due = 0;
+    TEST_ASSERT_TRUE(s.nextDeadline(due));
+    TEST_ASSERT_EQUAL_UINT32(11, due);
+}
+
+void test_capacity_is_fixed() {
+    std::vector<int> log;
+    RecordingTrack t(0, &log);
+    TimelineScheduler s;
+    for (size_t i = 0; i < TimelineScheduler::kMaxTracks; ++i) {
+        TEST_ASSERT_TRUE(s.addTrack(&t) != TimelineScheduler::kNoTrack);
+    }
+    TEST_ASSERT_TRUE(s.addTrack(&t) == TimelineScheduler::kNoTrack);
+}
+
+void test_order_is_wrap_safe() {
+    std::vector<int> log;
+    RecordingTrack a(1, &log), b(2, &log);
+    TimelineScheduler s;
+    const TimelineScheduler::TrackId ia = s.addTrack(&a);
+    const TimelineScheduler::TrackId ib = s.addTrack(&b);
+    s.schedule(ia, 0x00000010u);   // after the wrap
+    s.schedule(ib, 0xFFFFFFF0u);   // before the wrap
+    uint32_t due = 0;
+    s.nextDeadline(due);
+    TEST_ASSERT_EQUAL_UINT32(0xFFFFFFF0u, due);
+    TEST_ASSERT_EQUAL_INT(1, (int)s.runDue(0xFFFFFFF8u));
+    TEST_ASSERT_EQUAL_INT(2, log[0]);
+}
+
+// --- ActuatorTimeline ---
+void test_button_pulse_wakes_only_at_edges() {
+    CountingBacklight bl; MockVibrationOut vib;
+    ActuatorTimeline t(&bl, &vib);
+    t.playHaptics(AlertPatterns::kButtonPress, 500);
+    TEST_ASSERT_EQUAL_INT(2, runUntil(t, 10000)); // on at 500, off at 600
+    TEST_ASSERT_EQUAL_UINT8(0, vib.lastDuty);
+    TEST_ASSERT_EQUAL_INT(2, vib.writes);
+    uint32_t due = 0;
+    TEST_ASSERT_FALSE(t.nextDeadline(due)); // idle: no further wakeups
+}
+
+void test_alert_edges_coincide() {
+    CountingBacklight bl; MockVibrationOut vib;
+    ActuatorTimeline t(&bl, &vib);
+    t.playAlert(AlertPatterns::kAlarmFlash, AlertPatterns::kAlarmPulse, 77);
+    // every wakeup serves both tracks: edges are shared, so outputs never disagree
+    uint32_t due = 0;
+    while (t.nextDeadline(due) && due < 77 + 4000) {
+        t.runDue(due);
+        TEST_ASSERT_EQUAL_UINT8(bl.last == 255 ? 100 : 0, vib.lastDuty);
+    }
+}
+
+void test_alarm_pulse_ends_with_the_flash() {
+    CountingBacklight bl; MockVibrationOut vib;
+    ActuatorTimeline t(&bl, &vib);
+    t.playAlert(AlertPatterns::kAlarmFlash, AlertPatterns::kAlarmPulse, 0);
+    runUntil(t, 3999);
+    TEST_ASSERT_TRUE(t.isHapticsActive());
+    runUntil(t, 10000);
+    TEST_ASSERT_FALSE(t.isHapticsActive());
+    TEST_ASSERT_EQUAL_UINT8(0, vib.lastDuty);
+    uint32_t due = 0;
+    TEST_ASSERT_FALSE(t.nextDeadline(due)); // nothing keeps the motor pulsing
+}
+
+void test_long_press_feedback_differs_from_press() {
+    CountingBacklight bl; MockVibrationOut vib;
+    ActuatorTimeline t(&bl, &vib);
+    t.playHaptics(AlertPatterns::kButtonLongPress, 0);
+    runUntil(t, 10000);
+    TEST_ASSERT_EQUAL_INT(4, vib.writes); // on, off, on, off
+    TEST_ASSERT_EQUAL_UINT8(0, vib.lastDuty);
+}
+
+void test_stop_all_switches_vibration_off_and_goes_idle() {
+    CountingBacklight bl; MockVibrationOut vib;
+    ActuatorTimeline t(&bl, &vib);
+    t.playAlert(AlertPatterns::kAlarmFlash, AlertPatterns::kAlarmPulse, 0);
+    t.runDue(0);
+    t.stopAll();
+    TEST_ASSERT_EQUAL_UINT8(0, vib.lastDuty);
+    uint32_t due = 0;
+    TEST_ASSERT_FALSE(t.nextDeadline(due));
+}
+
+void test_missing_vibration_output_is_ignored() {
+    CountingBacklight bl;
+    ActuatorTimeline t(&bl, nullptr);
+    t.playAlert(AlertPatterns::kAlarmFlash, AlertPatterns::kAlarmPulse, 0);
+    t.runDue(0);
+    TEST_ASSERT_EQUAL_UINT8(255, bl.last);
+    TEST_ASSERT_FALSE(t.isHapticsActive());
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_empty_scheduler_has_no_deadline);
+    RUN_TEST(test_services_earliest_first);
+    RUN_TEST(test_reschedule_and_cancel);
+    RUN_TEST(test_periodic_track_stays_queued);
+    RUN_TEST(test_past_deadline_does_not_spin);
+    RUN_TEST(test_capacity_is_fixed);
+    RUN_TEST(test_order_is_wrap_safe);
+    RUN_TEST(test_button_pulse_wakes_only_at_edges);
+    RUN_TEST(test_alarm_pulse_ends_with_the_flash);
+    RUN_TEST(test_long_press_feedback_differs_from_press);
+    RUN_TEST(test_alert_edges_coincide);
+    RUN_TEST(test_stop_all_switches_vibration_off_and_goes_idle);
+    RUN_TEST(test_missing_vibration_output_is_ignored);
+    return UNITY_END();
+}
@@ -35,11 +35,89 @@ int main(int, char**) {
         seq.update(350, &out);
         TEST_ASSERT_FALSE(seq.isActive());
     };
+    auto test_no_redundant_writes = [](){
+        VibrationSequencer seq; MockVibrationOut out;
+        seq.loadPattern({ {100, 50}, {100, 0} }, false);
+        seq.start(0);
+        for (uint32_t t = 0; t < 200; t += 10) seq.update(t, &out);
+        TEST_ASSERT_EQUAL_INT(2, out.writes); // 50 → 0
+    };
+    auto test_equal_neighbours_are_merged = [](){
+        VibrationSequencer seq;
+        seq.loadPattern({ {100, 80}, {0, 10}, {50, 80}, {100, 0} }, false);
+        seq.start(1000);
+        TEST_ASSERT_EQUAL_UINT32(250, seq.totalDurationMs());
+        TEST_ASSERT_EQUAL_UINT32(1150, seq.nextChangeAtMs(1000));
+    };
+    auto test_segment_lookup_on_long_pattern = [](){
+        std::vector<VibrationSequencer::Segment> p;
+        for (int i = 0; i < 200; ++i) p.push_back({ 7, static_cast<uint8_t>(i % 2 ? 0 : 100) });
+        VibrationSequencer seq; MockVibrationOut out;
+        seq.loadPattern(p, false);
+        seq.start(0);
+        seq.update(7 * 123 + 6, &out);
+        TEST_ASSERT_EQUAL_UINT8(0, out.lastDuty);
+        seq.update(7 * 124, &out);
+        TEST_ASSERT_EQUAL_UINT8(100, out.lastDuty);
+    };
+    auto test_next_change_oneshot = [](){
+        VibrationSequencer seq;
+        seq.loadPattern({ {100, 50}, {30, 0}, {20, 50} }, false);
+        seq.start(5000);
+        TEST_ASSERT_EQUAL_UINT32(5100, seq.nextChangeAtMs(5000));
+        TEST_ASSERT_EQUAL_UINT32(5100, seq.nextChangeAtMs(5099));
+        TEST_ASSERT_EQUAL_UINT32(5130, seq.nextChangeAtMs(5100));
+        TEST_ASSERT_EQUAL_UINT32(5150, seq.nextChangeAtMs(5140));
+    };
+    auto test_next_change_repeat_wraps = [](){
+        VibrationSequencer seq; MockVibrationOut out;
+        seq.loadPattern({ {100, 50}, {100, 0} }, true);
+        seq.start(0);
+        TEST_ASSERT_EQUAL_UINT32(1000, seq.nextChangeAtMs(950));
+        TEST_ASSERT_EQUAL_UINT32(1100, seq.nextChangeAtMs(1000));
+        seq.update(1050, &out);
+        TEST_ASSERT_EQUAL_UINT8(50, out.lastDuty);
+        TEST_ASSERT_TRUE(seq.isActive());
+    };
+    auto test_millis_wrap = [](){
+        VibrationSequencer seq; MockVibrationOut out;
+        seq.loadPattern({ {100, 50}, {100, 0} }, false);
+        seq.start(0xFFFFFFF0u);
+        seq.update(0x00000010u, &out); // 32ms after start
+        TEST_ASSERT_EQUAL_UINT8(50, out.lastDuty);
+        TEST_ASSERT_EQUAL_UINT32(0x00000054u, seq.nextChangeAtMs(0x00000010u));
+    };
+    auto test_restart_rewrites_duty = [](){
+        VibrationSequencer seq; MockVibrationOut out;
+        seq.loadPattern({ {100, 100} }, false);
+        seq.start(0);
+        seq.update(0, &out);
+        seq.start(50);
+        seq.update(50, &out);
+        TEST_ASSERT_EQUAL_INT(2, out.writes);
+    };
+    auto test_stop_turns_output_off = [](){
+        VibrationSequencer seq; MockVibrationOut out;
+        seq.loadPattern({ {100, 100} }, true);
+        seq.start(0);
+        seq.update(10, &out);
+        seq.stop(&out);
+        TEST_ASSERT_FALSE(seq.isActive());
+        TEST_ASSERT_EQUAL_UINT8(0, out.lastDuty);
+    };
 
     RUN_TEST(test_starts_active);
     RUN_TEST(test_duty_in_first_segment);
     RUN_TEST(test_duty_in_second_segment);
     RUN_TEST(test_stops_after_oneshot);
+    RUN_TEST(test_no_redundant_writes);
+    RUN_TEST(test_equal_neighbours_are_merged);
+    RUN_TEST(test_segment_lookup_on_long_pattern);
+    RUN_TEST(test_next_change_oneshot);
+    RUN_TEST(test_next_change_repeat_wraps);
+    RUN_TEST(test_millis_wrap);
+    RUN_TEST(test_restart_rewrites_duty);
+    RUN_TEST(test_stop_turns_output_off);
 
     return UNITY_END();
 }
@@ -0,0 +1,126 @@
+#include <unity.h>
+#include <cstdio>
+#include <vector>
+#include <ctime>
+#include "ViewModelDiffer.h"
+#include "MainDisplayState.h"
+#include "SettingsDisplayState.h"
+#include "TimeLogic.h"
+#include "AlarmLogic.h"
+#include "settings/SettingsLogic.h"
+
+extern AlarmStore alarm_times;
+
+namespace {
+struct PairModel {
+    enum Field : uint8_t { Name, Count, kFieldCount };
+    char name[8];
+    int count;
+    uint32_t fingerprint(size_t field) const {
+        return field == Name ? ViewFingerprint::ofString(name) : static_cast<uint32_t>(count);
+    }
+};
+
+struct CountingMainView : public IMainDisplayView {
+    int time{0}, remain{0}, progress{0}, list{0};
+    void showTitle(const char*, int, bool) override {}
+    void showTime(const char*) override { ++time; }
+    void showRemain(const char*) override { ++remain; }
+    void showProgress(int) override { ++progress; }
+    void showAlarmList(const FrameStringList&) override { ++list; }
+    void showHints(const char*, const char*, const char*) override {}
+    void clear() override {}
+    void reset() { time = remain = progress = list = 0; }
+};
+
+struct CountingSettingsView : public ISettingsDisplayView {
+    int lists{0};
+    void showTitle(const char*, int, bool) override {}
+    void showHints(const char*, const char*, const char*) override {}
+    void showSettingsList(const std::vector<std::string>&, size_t) override { ++lists; }
+    void clear() override {}
+};
+} // namespace
+
+void setUp(void) {}
+void tearDown(void) { alarm_times.clear(); }
+
+void test_first_diff_reports_every_field() {
+    ViewModelDiffer<PairModel> d;
+    PairModel m = { "MAIN", 3 };
+    TEST_ASSERT_EQUAL_UINT32(0x3u, d.diff(m));
+    TEST_ASSERT_EQUAL_UINT32(0u, d.diff(m));
+}
+
+void test_only_changed_fields_are_reported() {
+    ViewModelDiffer<PairModel> d;
+    PairModel m = { "MAIN", 3 };
+    d.diff(m);
+    m.count = 4;
+    const ViewModelDiffer<PairModel>::Mask changed = d.diff(m);
+    TEST_ASSERT_FALSE(ViewModelDiffer<PairModel>::has(changed, PairModel::Name));
+    TEST_ASSERT_TRUE(ViewModelDiffer<PairModel>::has(changed, PairModel::Count));
+    std::snprintf(m.name, sizeof(m.name), "INPUT");
+    TEST_ASSERT_EQUAL_UINT32(ViewModelDiffer<PairModel>::bit(PairModel::Name), d.diff(m));
+}
+
+void test_invalidate_reports_everything_again() {
+    ViewModelDiffer<PairModel> d;
+    PairModel m = { "MAIN", 3 };
+    d.diff(m);
+    d.invalidate();
+    TEST_ASSERT_EQUAL_UINT32(0x3u, d.diff(m));
+}
+
+void test_fingerprints_see_order_and_length() {
+    const time_t a[] = { 100, 200 };
+    const time_t b[] = { 200, 100 };
+    TEST_ASSERT_TRUE(ViewFingerprint::ofTimes(a, 2) != ViewFingerprint::ofTimes(b, 2));
+    TEST_ASSERT_TRUE(ViewFingerprint::ofTimes(a, 1) != ViewFingerprint::ofTimes(a, 2));
+    TEST_ASSERT_TRUE(ViewFingerprint::ofString("12:00") != ViewFingerprint::ofString("12:01"));
+}
+
+void test_main_steady_frame_hands_nothing_to_the_view() {
+    CountingMainView view;
+    TimeLogic timeLogic;
+    AlarmLogic alarmLogic;
+    MainDisplayState state(nullptr, nullptr, &view, &timeLogic, &alarmLogic);
+    state.onEnter();
+    state.onDraw();
+    TEST_ASSERT_EQUAL_INT(1, view.list);
+    view.reset();
+    state.onDraw();
+    TEST_ASSERT_EQUAL_INT(0, view.remain);
+    TEST_ASSERT_EQUAL_INT(0, view.progress);
+    TEST_ASSERT_EQUAL_INT(0, view.list);
+    TEST_ASSERT_TRUE(view.time <= 1); // only if the wall clock crossed a minute
+    // a new alarm changes the list (and the countdown), not the clock
+    alarm_times.insert(time(nullptr) + 3600);
+    state.onDraw();
+    TEST_ASSERT_EQUAL_INT(1, view.list);
+    TEST_ASSERT_EQUAL_INT(1, view.remain);
+}
+
+void test_settings_value_change_redraws_without_selection_change() {
+    CountingSettingsView view;
+    SettingsLogic logic;
+    SettingsDisplayState state(&logic, &view);
+    state.onEnter();
+    TEST_ASSERT_EQUAL_INT(1, view.lists);
+    state.onDraw();
+    TEST_ASSERT_EQUAL_INT(1, view.lists);
+    logic.setSoundEnabled(!logic.isSoundEnabled());
+    state.onDraw();
+    TEST_ASSERT_EQUAL_INT(2, view.lists);
+}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_first_diff_reports_every_field);
+    RUN_TEST(test_only_changed_fields_are_reported);
+    RUN_TEST(test_invalidate_reports_everything_again);
+    RUN_TEST(test_fingerprints_see_order_and_length);
+    RUN_TEST(test_main_steady_frame_hands_nothing_to_the_view);
+    RUN_TEST(test_settings_value_change_redraws_without_selection_change);
+    return UNITY_END();
+}